@@ -124,6 +124,35 @@
  */
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
+/**
+ * Disable cache of number to string conversion results
+ */
+// #define CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE
+
+/**
+ * Number of entries in the number to string conversion cache (should be a power of 2)
+ */
+#define CONFIG_ECMA_NUMBER_TO_STRING_CACHE_SIZE (32)
+
+/**
+ * Number of entries in the cache of function templates (should be a power of 2)
+ */
+#define CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE (16)
+
+/**
+ * Default limit of memory, occupied by the compiled eval code cache's entries, in bytes
+ * (the limit can be changed with jerry_api_set_eval_cache_size_limit; zero limit disables the cache)
+ */
+#ifndef CONFIG_ECMA_EVAL_CACHE_SIZE_LIMIT
+# define CONFIG_ECMA_EVAL_CACHE_SIZE_LIMIT (4096)
+#endif /* !CONFIG_ECMA_EVAL_CACHE_SIZE_LIMIT */
+
+/**
+ * Maximum number of arguments of a bound function's call (bound and passed arguments together),
+ * for which the merged arguments list is placed on stack, instead of heap
+ */
+#define CONFIG_ECMA_BOUND_FUNCTION_MAX_ON_STACK_ARGS (8)
+
 /**
  * Share of newly allocated since last GC objects among all currently allocated objects,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
@@ -157,11 +186,34 @@
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ANNEXB_BUILTIN
 #endif /* CONFIG_ECMA_COMPACT_PROFILE */
 
+/**
+ * Maximum number of instructions in the NFA program, translated from RegExp bytecode for backtracking-free matching
+ *
+ * Patterns, which would need a larger program (for example, because of large counted iterations),
+ * are matched by the backtracking matcher.
+ */
+#define CONFIG_ECMA_REGEXP_NFA_MAX_INSTRS (128)
+
+/**
+ * Maximum number of saved positions, which can be kept by all threads of the NFA RegExp matcher
+ * (number of threads multiplied by number of capture group bounds)
+ */
+#define CONFIG_ECMA_REGEXP_NFA_MAX_SAVED_POSITIONS (1024)
+
 /**
  * Number of ecma-values inlined into VM stack frame
  */
 #define CONFIG_VM_STACK_FRAME_INLINED_VALUES_NUMBER (16)
 
+/**
+ * Number of value slots, reserved for call arguments after register variables of a VM stack frame
+ *
+ * Note:
+ *      the slots are shared by nested calls in argument lists of the frame's calls,
+ *      argument lists not fitting into the remaining slots are placed on heap
+ */
+#define CONFIG_VM_STACK_FRAME_ARGS_AREA_SIZE (8)
+
 /**
  * Run GC after execution of each byte-code instruction
  */
@@ -172,4 +224,23 @@
  */
 #define CONFIG_PARSER_ENABLE_PARSE_TIME_BYTE_CODE_OPTIMIZER
 
+/**
+ * Size of first chunk of parser's memory arena (see also: jsp_mm_alloc)
+ *
+ * Each next chunk is twice as large as the previous one, until CONFIG_PARSER_ARENA_MAX_CHUNK_SIZE is reached.
+ */
+#define CONFIG_PARSER_ARENA_MIN_CHUNK_SIZE (512)
+
+/**
+ * Maximum size of a chunk of parser's memory arena
+ */
+#define CONFIG_PARSER_ARENA_MAX_CHUNK_SIZE (4096)
+
+/**
+ * Log2 of maximum size of a block, allocated by parser from the arena's chunks
+ *
+ * Larger blocks are allocated separately from the heap.
+ */
+#define CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE_LOG (10)
+
 #endif /* !CONFIG_H */
@@ -25,6 +25,8 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-eval.h"
+#include "ecma-function-object.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
@@ -233,6 +235,20 @@ ecma_gc_init (void)
   ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
 } /* ecma_gc_init */
 
+/**
+ * Add memory regions, containing garbage collector's state, to list of heap image's regions
+ */
+void
+ecma_gc_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_image_regions_add (regions_p, ecma_gc_objects_lists, sizeof (ecma_gc_objects_lists));
+  mem_image_regions_add (regions_p, &ecma_gc_visited_flip_flag, sizeof (ecma_gc_visited_flip_flag));
+  mem_image_regions_add (regions_p, &ecma_gc_objects_number, sizeof (ecma_gc_objects_number));
+  mem_image_regions_add (regions_p,
+                         &ecma_gc_new_objects_since_last_gc,
+                         sizeof (ecma_gc_new_objects_since_last_gc));
+} /* ecma_gc_get_image_regions */
+
 /**
  * Mark objects as visited starting from specified object as root
  */
@@ -367,22 +383,46 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
               break;
             }
 
-            case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS: /* a collection of ecma-values */
+            case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS: /* an array of ecma-values */
             {
-              ecma_collection_header_t *bound_arg_list_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t,
+              ecma_values_array_header_t *values_array_p = ECMA_GET_NON_NULL_POINTER (ecma_values_array_header_t,
                                                                                       property_value);
+              ecma_value_t *values_p = ecma_get_values_array_data (values_array_p);
+
+              for (ecma_length_t i = 0; i < values_array_p->unit_number; i++)
+              {
+                if (ecma_is_value_object (values_p[i]))
+                {
+                  ecma_object_t *obj_p = ecma_get_object_from_value (values_p[i]);
+
+                  ecma_gc_set_object_visited (obj_p, true);
+                }
+              }
+
+              break;
+            }
+
+            case ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES: /* a collection of ecma-values */
+            {
+              ecma_collection_header_t *values_list_p = ECMA_GET_POINTER (ecma_collection_header_t,
+                                                                          property_value);
+
+              if (values_list_p == NULL)
+              {
+                break;
+              }
 
-              ecma_collection_iterator_t bound_args_iterator;
-              ecma_collection_iterator_init (&bound_args_iterator, bound_arg_list_p);
+              ecma_collection_iterator_t values_iterator;
+              ecma_collection_iterator_init (&values_iterator, values_list_p);
 
-              for (ecma_length_t i = 0; i < bound_arg_list_p->unit_number; i++)
+              for (ecma_length_t i = 0; i < values_list_p->unit_number; i++)
               {
-                bool is_moved = ecma_collection_iterator_next (&bound_args_iterator);
+                bool is_moved = ecma_collection_iterator_next (&values_iterator);
                 JERRY_ASSERT (is_moved);
 
-                if (ecma_is_value_object (*bound_args_iterator.current_value_p))
+                if (ecma_is_value_object (*values_iterator.current_value_p))
                 {
-                  ecma_object_t *obj_p = ecma_get_object_from_value (*bound_args_iterator.current_value_p);
+                  ecma_object_t *obj_p = ecma_get_object_from_value (*values_iterator.current_value_p);
 
                   ecma_gc_set_object_visited (obj_p, true);
                 }
@@ -392,6 +432,8 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             }
 
             case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_TARGET_FUNCTION: /* an object */
+            case ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE: /* an object */
+            case ECMA_INTERNAL_PROPERTY_FUNCTION_TEMPLATE: /* an object */
             case ECMA_INTERNAL_PROPERTY_SCOPE: /* a lexical environment */
             case ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP: /* an object */
             {
@@ -586,6 +628,8 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
 
     /* Freeing as much memory as we currently can */
     ecma_lcache_invalidate_all ();
+    ecma_op_function_template_cache_invalidate_all ();
+    ecma_eval_cache_invalidate_all ();
 
     ecma_gc_run ();
   }
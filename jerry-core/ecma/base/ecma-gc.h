@@ -27,6 +27,7 @@
 #include "mem-allocator.h"
 
 extern void ecma_gc_init (void);
+extern void ecma_gc_get_image_regions (mem_image_regions_t *);
 extern void ecma_init_gc_info (ecma_object_t *);
 extern void ecma_ref_object (ecma_object_t *);
 extern void ecma_deref_object (ecma_object_t *);
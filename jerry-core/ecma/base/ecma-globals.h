@@ -221,6 +221,9 @@ typedef enum
   ECMA_INTERNAL_PROPERTY_CODE_BYTECODE, /**< first part of [[Code]] - compressed pointer to bytecode array */
   ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET, /**< second part of [[Code]] - offset in bytecode array and code flags
                                                  *   (see also: ecma_pack_code_internal_property_value) */
+  ECMA_INTERNAL_PROPERTY_FUNCTION_TEMPLATE, /**< template object, shared between Function objects, created
+                                             *   from the same function literal (see also:
+                                             *   ecma_op_create_function_template) */
   ECMA_INTERNAL_PROPERTY_NATIVE_CODE, /**< native handler location descriptor */
   ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE, /**< native handle associated with an object */
   ECMA_INTERNAL_PROPERTY_FREE_CALLBACK, /**< object's native free callback */
@@ -266,6 +269,11 @@ typedef enum
    */
   ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE,
 
+  /** Not yet materialized Arguments object's internal properties
+   *  (see also: ecma_op_create_arguments_object) */
+  ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES, /**< collection of arguments' values */
+  ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE, /**< callee function object */
+
   /**
    * Number of internal properties' types
    */
@@ -760,6 +768,19 @@ typedef struct
   mem_cpointer_t last_chunk_cp;
 } ecma_collection_header_t;
 
+/**
+ * Description of a values array's header
+ *
+ * Note:
+ *      unlike collection, values array is stored in one heap block,
+ *      with the values placed right after the header
+ */
+typedef struct
+{
+  /** Number of elements in the array */
+  ecma_length_t unit_number;
+} ecma_values_array_header_t;
+
 /**
  * Description of non-first chunk in a collection's chain of chunks
  */
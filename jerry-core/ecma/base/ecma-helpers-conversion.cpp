@@ -326,6 +326,100 @@
  * @}
  */
 
+/**
+ * Maximum number of digits in a decimal integer, converted with the integer-only fast path
+ * of string to number conversion (10^9 - 1 fits into uint32_t)
+ */
+#define ECMA_NUMBER_CONVERSION_FAST_INTEGER_MAX_DIGITS (9)
+
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+/**
+ * Powers of ten, which are exactly representable as ecma-number
+ */
+static const ecma_number_t ecma_number_exact_powers_of_ten[] =
+{
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * Maximum decimal exponent, for which the power of ten is exactly representable as ecma-number
+ */
+#define ECMA_NUMBER_MAX_EXACT_POWER_OF_TEN_EXP (22)
+
+/**
+ * Try to convert decimal mantissa and exponent to ecma-number with
+ * a single floating-point multiplication or division (Clinger's fast path).
+ *
+ * Note:
+ *      if both the mantissa and the power of ten are exactly representable,
+ *      the only rounding is performed by the operation itself, so the result is correctly rounded
+ *
+ * See also:
+ *          William D. Clinger, How to Read Floating Point Numbers Accurately, PLDI 1990
+ *
+ * @return true - if the number was converted,
+ *         false - otherwise (the exact conversion should be used)
+ */
+static bool
+ecma_number_try_make_from_decimal (uint64_t fraction, /**< decimal mantissa */
+                                   int32_t decimal_exp, /**< decimal exponent */
+                                   ecma_number_t *out_num_p) /**< out: ecma-number */
+{
+  JERRY_ASSERT (fraction != 0);
+
+  while (decimal_exp < 0 && fraction % 10 == 0)
+  {
+    fraction /= 10;
+    decimal_exp++;
+  }
+
+  if (decimal_exp == 0)
+  {
+    /* conversion of integer is correctly rounded */
+    *out_num_p = (ecma_number_t) fraction;
+    return true;
+  }
+
+  const uint64_t max_exact_fraction = 1ull << (ECMA_NUMBER_FRACTION_WIDTH + 1);
+
+  if (fraction > max_exact_fraction)
+  {
+    return false;
+  }
+
+  if (decimal_exp < 0)
+  {
+    if (decimal_exp < -ECMA_NUMBER_MAX_EXACT_POWER_OF_TEN_EXP)
+    {
+      return false;
+    }
+
+    *out_num_p = (ecma_number_t) fraction / ecma_number_exact_powers_of_ten[-decimal_exp];
+    return true;
+  }
+
+  if (decimal_exp > ECMA_NUMBER_MAX_EXACT_POWER_OF_TEN_EXP)
+  {
+    /* moving part of the exponent to the mantissa, if the mantissa stays exact */
+    while (decimal_exp > ECMA_NUMBER_MAX_EXACT_POWER_OF_TEN_EXP
+           && fraction * 10 <= max_exact_fraction)
+    {
+      fraction *= 10;
+      decimal_exp--;
+    }
+
+    if (decimal_exp > ECMA_NUMBER_MAX_EXACT_POWER_OF_TEN_EXP)
+    {
+      return false;
+    }
+  }
+
+  *out_num_p = (ecma_number_t) fraction * ecma_number_exact_powers_of_ten[decimal_exp];
+  return true;
+} /* ecma_number_try_make_from_decimal */
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
 /**
  * ECMA-defined conversion of string to Number.
  *
@@ -456,6 +550,28 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     return ecma_number_make_nan ();
   }
 
+  /* Fast path for short decimal integers */
+  if (end_p - begin_p < ECMA_NUMBER_CONVERSION_FAST_INTEGER_MAX_DIGITS)
+  {
+    uint32_t num_uint32 = 0;
+    const lit_utf8_byte_t *iter_p = begin_p;
+
+    while (iter_p <= end_p
+           && *iter_p >= dec_digits_range[0]
+           && *iter_p <= dec_digits_range[1])
+    {
+      num_uint32 = num_uint32 * 10 + (uint32_t) (*iter_p - dec_digits_range[0]);
+      iter_p++;
+    }
+
+    if (iter_p > end_p)
+    {
+      ecma_number_t num = ecma_uint32_to_number (num_uint32);
+
+      return sign ? ecma_number_negate (num) : num;
+    }
+  }
+
   /* Checking if significant part of parse string is equal to "Infinity" */
   const lit_utf8_byte_t *infinity_zt_str_p = lit_get_magic_string_utf8 (LIT_MAGIC_STRING_INFINITY_UL);
 
@@ -626,6 +742,13 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
   }
 
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  ecma_number_t num;
+
+  if (ecma_number_try_make_from_decimal (fraction_uint64, e_sign ? -e : e, &num))
+  {
+    return sign ? ecma_number_negate (num) : num;
+  }
+
   int32_t binary_exponent = 33;
 
   /*
@@ -965,227 +1088,875 @@ ecma_number_to_int32 (ecma_number_t num) /**< ecma-number */
 } /* ecma_number_to_int32 */
 
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+/*
+ * \addtogroup ecmahelpersgrisu Grisu3 algorithm of shortest decimal representation calculation
+ * @{
+ *
+ * See also:
+ *          Florian Loitsch, Printing Floating-Point Numbers Quickly and Accurately with Integers, PLDI 2010
+ */
+
 /**
-  * Perform conversion of 128-bit binary representation of number
-  * to decimal representation with decimal exponent.
-  */
-static void
-ecma_number_helper_binary_to_decimal (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ARG (fraction_uint128), /**< mantissa */
-                                      int32_t binary_exponent, /**< binary exponent */
-                                      int32_t *out_decimal_exp_p) /**< out: decimal exponent */
+ * Floating-point value with 64-bit significand: f * 2^e
+ */
+typedef struct
 {
-  int32_t decimal_exp = 0;
+  uint64_t f; /**< significand */
+  int32_t e; /**< binary exponent */
+} ecma_number_diy_fp_t;
 
-  if (binary_exponent > 0)
-  {
-    while (binary_exponent > 0)
-    {
-      if (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124))
-      {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INC (fraction_uint128);
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128);
-        binary_exponent++;
-      }
-      else
-      {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER (fraction_uint128_tmp);
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_COPY (fraction_uint128_tmp, fraction_uint128);
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_DIV_10 (fraction_uint128_tmp);
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10 (fraction_uint128_tmp);
+/**
+ * Cached power of ten: significand * 2^binary_exp ~ 10^decimal_exp
+ */
+typedef struct
+{
+  uint64_t significand; /**< normalized significand */
+  int16_t binary_exp; /**< binary exponent */
+  int16_t decimal_exp; /**< decimal exponent */
+} ecma_number_cached_power_t;
 
-        if (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ARE_EQUAL (fraction_uint128, fraction_uint128_tmp)
-            && ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 123))
-        {
-          ECMA_NUMBER_CONVERSION_128BIT_INTEGER_LEFT_SHIFT (fraction_uint128);
-          binary_exponent--;
-        }
-        else
-        {
-          ECMA_NUMBER_CONVERSION_128BIT_INTEGER_DIV_10 (fraction_uint128);
-          decimal_exp++;
-        }
-      }
-    }
+/**
+ * Powers of ten from 10^-348 to 10^340, with step of ECMA_NUMBER_CACHED_POWERS_DECIMAL_EXP_STEP
+ */
+static const ecma_number_cached_power_t ecma_number_cached_powers[] =
+{
+  { 0xfa8fd5a0081c0288ull, -1220, -348 },
+  { 0xbaaee17fa23ebf76ull, -1193, -340 },
+  { 0x8b16fb203055ac76ull, -1166, -332 },
+  { 0xcf42894a5dce35eaull, -1140, -324 },
+  { 0x9a6bb0aa55653b2dull, -1113, -316 },
+  { 0xe61acf033d1a45dfull, -1087, -308 },
+  { 0xab70fe17c79ac6caull, -1060, -300 },
+  { 0xff77b1fcbebcdc4full, -1034, -292 },
+  { 0xbe5691ef416bd60cull, -1007, -284 },
+  { 0x8dd01fad907ffc3cull, -980, -276 },
+  { 0xd3515c2831559a83ull, -954, -268 },
+  { 0x9d71ac8fada6c9b5ull, -927, -260 },
+  { 0xea9c227723ee8bcbull, -901, -252 },
+  { 0xaecc49914078536dull, -874, -244 },
+  { 0x823c12795db6ce57ull, -847, -236 },
+  { 0xc21094364dfb5637ull, -821, -228 },
+  { 0x9096ea6f3848984full, -794, -220 },
+  { 0xd77485cb25823ac7ull, -768, -212 },
+  { 0xa086cfcd97bf97f4ull, -741, -204 },
+  { 0xef340a98172aace5ull, -715, -196 },
+  { 0xb23867fb2a35b28eull, -688, -188 },
+  { 0x84c8d4dfd2c63f3bull, -661, -180 },
+  { 0xc5dd44271ad3cdbaull, -635, -172 },
+  { 0x936b9fcebb25c996ull, -608, -164 },
+  { 0xdbac6c247d62a584ull, -582, -156 },
+  { 0xa3ab66580d5fdaf6ull, -555, -148 },
+  { 0xf3e2f893dec3f126ull, -529, -140 },
+  { 0xb5b5ada8aaff80b8ull, -502, -132 },
+  { 0x87625f056c7c4a8bull, -475, -124 },
+  { 0xc9bcff6034c13053ull, -449, -116 },
+  { 0x964e858c91ba2655ull, -422, -108 },
+  { 0xdff9772470297ebdull, -396, -100 },
+  { 0xa6dfbd9fb8e5b88full, -369, -92 },
+  { 0xf8a95fcf88747d94ull, -343, -84 },
+  { 0xb94470938fa89bcfull, -316, -76 },
+  { 0x8a08f0f8bf0f156bull, -289, -68 },
+  { 0xcdb02555653131b6ull, -263, -60 },
+  { 0x993fe2c6d07b7facull, -236, -52 },
+  { 0xe45c10c42a2b3b06ull, -210, -44 },
+  { 0xaa242499697392d3ull, -183, -36 },
+  { 0xfd87b5f28300ca0eull, -157, -28 },
+  { 0xbce5086492111aebull, -130, -20 },
+  { 0x8cbccc096f5088ccull, -103, -12 },
+  { 0xd1b71758e219652cull, -77, -4 },
+  { 0x9c40000000000000ull, -50, 4 },
+  { 0xe8d4a51000000000ull, -24, 12 },
+  { 0xad78ebc5ac620000ull, 3, 20 },
+  { 0x813f3978f8940984ull, 30, 28 },
+  { 0xc097ce7bc90715b3ull, 56, 36 },
+  { 0x8f7e32ce7bea5c70ull, 83, 44 },
+  { 0xd5d238a4abe98068ull, 109, 52 },
+  { 0x9f4f2726179a2245ull, 136, 60 },
+  { 0xed63a231d4c4fb27ull, 162, 68 },
+  { 0xb0de65388cc8ada8ull, 189, 76 },
+  { 0x83c7088e1aab65dbull, 216, 84 },
+  { 0xc45d1df942711d9aull, 242, 92 },
+  { 0x924d692ca61be758ull, 269, 100 },
+  { 0xda01ee641a708deaull, 295, 108 },
+  { 0xa26da3999aef774aull, 322, 116 },
+  { 0xf209787bb47d6b85ull, 348, 124 },
+  { 0xb454e4a179dd1877ull, 375, 132 },
+  { 0x865b86925b9bc5c2ull, 402, 140 },
+  { 0xc83553c5c8965d3dull, 428, 148 },
+  { 0x952ab45cfa97a0b3ull, 455, 156 },
+  { 0xde469fbd99a05fe3ull, 481, 164 },
+  { 0xa59bc234db398c25ull, 508, 172 },
+  { 0xf6c69a72a3989f5cull, 534, 180 },
+  { 0xb7dcbf5354e9beceull, 561, 188 },
+  { 0x88fcf317f22241e2ull, 588, 196 },
+  { 0xcc20ce9bd35c78a5ull, 614, 204 },
+  { 0x98165af37b2153dfull, 641, 212 },
+  { 0xe2a0b5dc971f303aull, 667, 220 },
+  { 0xa8d9d1535ce3b396ull, 694, 228 },
+  { 0xfb9b7cd9a4a7443cull, 720, 236 },
+  { 0xbb764c4ca7a44410ull, 747, 244 },
+  { 0x8bab8eefb6409c1aull, 774, 252 },
+  { 0xd01fef10a657842cull, 800, 260 },
+  { 0x9b10a4e5e9913129ull, 827, 268 },
+  { 0xe7109bfba19c0c9dull, 853, 276 },
+  { 0xac2820d9623bf429ull, 880, 284 },
+  { 0x80444b5e7aa7cf85ull, 907, 292 },
+  { 0xbf21e44003acdd2dull, 933, 300 },
+  { 0x8e679c2f5e44ff8full, 960, 308 },
+  { 0xd433179d9c8cb841ull, 986, 316 },
+  { 0x9e19db92b4e31ba9ull, 1013, 324 },
+  { 0xeb96bf6ebadf77d9ull, 1039, 332 },
+  { 0xaf87023b9bf0ee6bull, 1066, 340 },
+};
+
+/**
+ * Decimal exponent of the first cached power of ten
+ */
+#define ECMA_NUMBER_CACHED_POWERS_MIN_DECIMAL_EXP (-348)
+
+/**
+ * Difference between decimal exponents of adjacent cached powers of ten
+ */
+#define ECMA_NUMBER_CACHED_POWERS_DECIMAL_EXP_STEP (8)
+
+/**
+ * Minimum binary exponent of the scaled number, from which digits are generated
+ */
+#define ECMA_NUMBER_GRISU_MIN_TARGET_EXP (-60)
+
+/**
+ * Maximum binary exponent of the scaled number, from which digits are generated
+ */
+#define ECMA_NUMBER_GRISU_MAX_TARGET_EXP (-32)
+
+/**
+ * Multiply two 64-bit significand values, rounding the result to 64 bits
+ *
+ * @return product
+ */
+static ecma_number_diy_fp_t
+ecma_number_diy_fp_multiply (ecma_number_diy_fp_t a, /**< first operand */
+                             ecma_number_diy_fp_t b) /**< second operand */
+{
+  const uint64_t mask32 = 0xFFFFFFFFull;
+
+  const uint64_t a_high = a.f >> 32u, a_low = a.f & mask32;
+  const uint64_t b_high = b.f >> 32u, b_low = b.f & mask32;
+
+  const uint64_t high_high = a_high * b_high;
+  const uint64_t high_low = a_high * b_low;
+  const uint64_t low_high = a_low * b_high;
+  const uint64_t low_low = a_low * b_low;
+
+  /* the 1u << 31 term rounds the lower half of the 128-bit product */
+  const uint64_t middle = (low_low >> 32u) + (high_low & mask32) + (low_high & mask32) + (1ull << 31u);
+
+  ecma_number_diy_fp_t ret;
+  ret.f = high_high + (high_low >> 32u) + (low_high >> 32u) + (middle >> 32u);
+  ret.e = a.e + b.e + 64;
+
+  return ret;
+} /* ecma_number_diy_fp_multiply */
+
+/**
+ * Shift significand of the value left, until its highest bit is set
+ *
+ * @return normalized value
+ */
+static ecma_number_diy_fp_t
+ecma_number_diy_fp_normalize (ecma_number_diy_fp_t value) /**< value */
+{
+  JERRY_ASSERT (value.f != 0);
+
+  while ((value.f & (1ull << 63u)) == 0)
+  {
+    value.f <<= 1u;
+    value.e--;
   }
-  else if (binary_exponent < 0)
+
+  return value;
+} /* ecma_number_diy_fp_normalize */
+
+/**
+ * Get cached power of ten, scaling a normalized value with the specified binary exponent
+ * into the [ECMA_NUMBER_GRISU_MIN_TARGET_EXP, ECMA_NUMBER_GRISU_MAX_TARGET_EXP] range
+ *
+ * @return cached power of ten
+ */
+static ecma_number_diy_fp_t
+ecma_number_grisu_get_cached_power (int32_t binary_exp, /**< binary exponent of normalized value */
+                                    int32_t *out_decimal_exp_p) /**< out: decimal exponent of the power */
+{
+  const int32_t min_exp = ECMA_NUMBER_GRISU_MIN_TARGET_EXP - (binary_exp + 64);
+
+  /* k = ceil ((min_exp + 63) * log10 (2)), where log10 (2) is approximated with 78913 / 2^18 */
+  const int32_t scaled = (min_exp + 63) * 78913;
+  const int32_t k = (scaled >= 0) ? ((scaled + (1 << 18) - 1) >> 18) : -((-scaled) >> 18);
+
+  const int32_t index = ((-ECMA_NUMBER_CACHED_POWERS_MIN_DECIMAL_EXP + k - 1)
+                         / ECMA_NUMBER_CACHED_POWERS_DECIMAL_EXP_STEP + 1);
+
+  JERRY_ASSERT (index >= 0
+                && (uint32_t) index < sizeof (ecma_number_cached_powers) / sizeof (ecma_number_cached_powers[0]));
+
+  const ecma_number_cached_power_t *cached_power_p = &ecma_number_cached_powers[index];
+
+  ecma_number_diy_fp_t ret;
+  ret.f = cached_power_p->significand;
+  ret.e = cached_power_p->binary_exp;
+
+  JERRY_ASSERT (ECMA_NUMBER_GRISU_MIN_TARGET_EXP <= binary_exp + ret.e + 64
+                && binary_exp + ret.e + 64 <= ECMA_NUMBER_GRISU_MAX_TARGET_EXP);
+
+  *out_decimal_exp_p = cached_power_p->decimal_exp;
+
+  return ret;
+} /* ecma_number_grisu_get_cached_power */
+
+/**
+ * Get the biggest power of ten that is less or equal to the number
+ */
+static void
+ecma_number_grisu_biggest_power_ten (uint32_t number, /**< number */
+                                     uint32_t number_bits, /**< number of significant bits in the number */
+                                     uint32_t *out_power_p, /**< out: power of ten */
+                                     int32_t *out_exponent_plus_one_p) /**< out: exponent of the power plus one */
+{
+  static const uint32_t small_powers_of_ten[] =
   {
-    while (binary_exponent < 0)
-    {
-      if (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_LOW_BIT_MASK_ZERO (fraction_uint128, 0)
-          || !ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128, 124))
-      {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128);
+    0, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+  };
 
-        binary_exponent++;
-      }
-      else
-      {
-        ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10 (fraction_uint128);
+  JERRY_ASSERT (number_bits <= 32 && (uint64_t) number < (1ull << (number_bits + 1)));
 
-        decimal_exp--;
-      }
-    }
+  /* 1233 / 4096 approximates log10 (2) */
+  uint32_t exponent_plus_one = (((number_bits + 1) * 1233) >> 12) + 1;
+
+  if (number < small_powers_of_ten[exponent_plus_one])
+  {
+    exponent_plus_one--;
   }
 
-  *out_decimal_exp_p = decimal_exp;
-} /* ecma_number_helper_binary_to_decimal */
+  *out_power_p = small_powers_of_ten[exponent_plus_one];
+  *out_exponent_plus_one_p = (int32_t) exponent_plus_one;
+} /* ecma_number_grisu_biggest_power_ten */
 
-#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+/**
+ * Adjust the last generated digit, moving the digits closer to the number,
+ * and check that the digits are inside of the safe interval (so, they are both the shortest and the closest).
+ *
+ * @return true - if the digits are guaranteed to be correct,
+ *         false - otherwise
+ */
+static bool
+ecma_number_grisu_round_weed (uint64_t *digits_p, /**< in-out: generated digits */
+                              uint64_t distance_too_high_w, /**< distance between too_high and the number */
+                              uint64_t unsafe_interval, /**< size of the unsafe interval */
+                              uint64_t rest, /**< distance between too_high and the digits */
+                              uint64_t ten_kappa, /**< weight of the last digit */
+                              uint64_t unit) /**< imprecision unit */
+{
+  const uint64_t small_distance = distance_too_high_w - unit;
+  const uint64_t big_distance = distance_too_high_w + unit;
+
+  while (rest < small_distance
+         && unsafe_interval - rest >= ten_kappa
+         && (rest + ten_kappa < small_distance
+             || small_distance - rest >= rest + ten_kappa - small_distance))
+  {
+    (*digits_p)--;
+    rest += ten_kappa;
+  }
+
+  if (rest < big_distance
+      && unsafe_interval - rest >= ten_kappa
+      && (rest + ten_kappa < big_distance
+          || big_distance - rest > rest + ten_kappa - big_distance))
+  {
+    return false;
+  }
+
+  return (2 * unit <= rest && rest <= unsafe_interval - 4 * unit);
+} /* ecma_number_grisu_round_weed */
 
 /**
-  * Perform conversion of ecma-number to decimal representation with decimal exponent
-  *
-  * Note:
-  *      The calculated values correspond to s, n, k parameters in ECMA-262 v5, 9.8.1, item 5:
-  *         - s represents digits of the number;
-  *         - k is the number of digits;
-  *         - n is the decimal exponent.
-  */
-void
-ecma_number_to_decimal (ecma_number_t num, /**< ecma-number */
-                        uint64_t *out_digits_p, /**< out: digits */
-                        int32_t *out_digits_num_p, /**< out: number of digits */
-                        int32_t *out_decimal_exp_p) /**< out: decimal exponent */
+ * Generate the shortest digits in the interval (low, high), approximating the scaled number
+ *
+ * @return true - if the digits are guaranteed to be correct,
+ *         false - otherwise
+ */
+static bool
+ecma_number_grisu_digit_gen (ecma_number_diy_fp_t low, /**< lower boundary */
+                             ecma_number_diy_fp_t w, /**< scaled number */
+                             ecma_number_diy_fp_t high, /**< upper boundary */
+                             uint64_t *out_digits_p, /**< out: digits */
+                             int32_t *out_digits_num_p, /**< out: number of digits */
+                             int32_t *out_kappa_p) /**< out: decimal exponent of the last digit */
 {
-  JERRY_ASSERT (!ecma_number_is_nan (num));
-  JERRY_ASSERT (!ecma_number_is_zero (num));
-  JERRY_ASSERT (!ecma_number_is_infinity (num));
+  JERRY_ASSERT (low.e == w.e && w.e == high.e);
+  JERRY_ASSERT (low.f + 1 <= high.f - 1);
+  JERRY_ASSERT (ECMA_NUMBER_GRISU_MIN_TARGET_EXP <= w.e && w.e <= ECMA_NUMBER_GRISU_MAX_TARGET_EXP);
 
-#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
-  ecma_number_t num_m1 = ecma_number_get_prev (num);
-  ecma_number_t num_p1 = ecma_number_get_next (num);
+  /* the boundaries are imprecise, so the interval is extended by one unit in both directions */
+  uint64_t unit = 1;
+  const uint64_t too_low = low.f - unit;
+  const uint64_t too_high = high.f + unit;
+  uint64_t unsafe_interval = too_high - too_low;
 
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER (fraction_uint128);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER (fraction_uint128_m1);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER (fraction_uint128_p1);
+  const uint32_t one_shift = (uint32_t) -w.e;
+  const uint64_t one = 1ull << one_shift;
+
+  uint32_t integrals = (uint32_t) (too_high >> one_shift);
+  uint64_t fractionals = too_high & (one - 1);
 
-  uint64_t fraction_uint64, fraction_uint64_m1, fraction_uint64_p1;
-  int32_t binary_exponent, binary_exponent_m1, binary_exponent_p1;
-  int32_t decimal_exp, decimal_exp_m1, decimal_exp_p1;
-  int32_t dot_shift, dot_shift_m1, dot_shift_p1;
+  uint32_t divisor;
+  int32_t kappa;
+  ecma_number_grisu_biggest_power_ten (integrals, 64 - one_shift, &divisor, &kappa);
 
-  dot_shift_m1 = ecma_number_get_fraction_and_exponent (num_m1, &fraction_uint64_m1, &binary_exponent_m1);
-  dot_shift = ecma_number_get_fraction_and_exponent (num, &fraction_uint64, &binary_exponent);
-  dot_shift_p1 = ecma_number_get_fraction_and_exponent (num_p1, &fraction_uint64_p1, &binary_exponent_p1);
+  uint64_t digits = 0;
+  int32_t digits_num = 0;
 
-  binary_exponent_m1 -= dot_shift_m1;
-  binary_exponent -= dot_shift;
-  binary_exponent_p1 -= dot_shift_p1;
+  while (kappa > 0)
+  {
+    digits = digits * 10 + integrals / divisor;
+    digits_num++;
 
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INIT (fraction_uint128,
-                                              0ull,
-                                              0ull,
-                                              (fraction_uint64) >> 32u,
-                                              ((fraction_uint64) << 32u) >> 32u);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INIT (fraction_uint128_m1,
-                                              0ull,
-                                              0ull,
-                                              (fraction_uint64_m1) >> 32u,
-                                              ((fraction_uint64_m1) << 32u) >> 32u);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_INIT (fraction_uint128_p1,
-                                              0ull,
-                                              0ull,
-                                              (fraction_uint64_p1) >> 32u,
-                                              ((fraction_uint64_p1) << 32u) >> 32u);
-
-  ecma_number_helper_binary_to_decimal (fraction_uint128, binary_exponent, &decimal_exp);
-  ecma_number_helper_binary_to_decimal (fraction_uint128_m1, binary_exponent_m1, &decimal_exp_m1);
-  ecma_number_helper_binary_to_decimal (fraction_uint128_p1, binary_exponent_p1, &decimal_exp_p1);
-
-  if (ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_ZERO (fraction_uint128_m1))
-  {
-    decimal_exp_m1 = decimal_exp;
-  }
-
-  while (decimal_exp != decimal_exp_m1
-         || decimal_exp != decimal_exp_p1)
-  {
-    while (decimal_exp > decimal_exp_m1
-           || decimal_exp > decimal_exp_p1)
+    integrals %= divisor;
+    kappa--;
+
+    const uint64_t rest = ((uint64_t) integrals << one_shift) + fractionals;
+
+    if (rest < unsafe_interval)
     {
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10 (fraction_uint128);
-      decimal_exp--;
+      bool is_correct = ecma_number_grisu_round_weed (&digits,
+                                                      too_high - w.f,
+                                                      unsafe_interval,
+                                                      rest,
+                                                      (uint64_t) divisor << one_shift,
+                                                      unit);
+
+      *out_digits_p = digits;
+      *out_digits_num_p = digits_num;
+      *out_kappa_p = kappa;
+
+      return is_correct;
     }
-    while (decimal_exp_m1 > decimal_exp
-           || decimal_exp_m1 > decimal_exp_p1)
+
+    divisor /= 10;
+  }
+
+  while (true)
+  {
+    JERRY_ASSERT (digits_num < 19);
+
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+
+    digits = digits * 10 + (fractionals >> one_shift);
+    digits_num++;
+
+    fractionals &= one - 1;
+    kappa--;
+
+    if (fractionals < unsafe_interval)
     {
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10 (fraction_uint128_m1);
-      decimal_exp_m1--;
+      bool is_correct = ecma_number_grisu_round_weed (&digits,
+                                                      (too_high - w.f) * unit,
+                                                      unsafe_interval,
+                                                      fractionals,
+                                                      one,
+                                                      unit);
+
+      *out_digits_p = digits;
+      *out_digits_num_p = digits_num;
+      *out_kappa_p = kappa;
+
+      return is_correct;
     }
-    while (decimal_exp_p1 > decimal_exp
-           || decimal_exp_p1 > decimal_exp_m1)
+  }
+} /* ecma_number_grisu_digit_gen */
+
+/**
+ * Calculate the shortest decimal representation of ecma-number with Grisu3 algorithm
+ *
+ * Note:
+ *      the algorithm fails for about 0.5% of numbers, for which a correct result is not guaranteed
+ *
+ * @return true - if the representation was calculated,
+ *         false - otherwise
+ */
+static bool
+ecma_number_to_decimal_grisu3 (ecma_number_t num, /**< ecma-number */
+                               uint64_t *out_digits_p, /**< out: digits */
+                               int32_t *out_digits_num_p, /**< out: number of digits */
+                               int32_t *out_decimal_exp_p) /**< out: decimal exponent */
+{
+  JERRY_ASSERT (num > 0 && !ecma_number_is_infinity (num));
+
+  union
+  {
+    uint64_t u64_value;
+    ecma_number_t float_value;
+  } u;
+
+  u.float_value = num;
+
+  const int32_t exponent_bias = 1023;
+
+  const uint64_t fraction_field = u.u64_value & ((1ull << ECMA_NUMBER_FRACTION_WIDTH) - 1);
+  const uint32_t biased_exp = (uint32_t) (u.u64_value >> ECMA_NUMBER_FRACTION_WIDTH);
+
+  /* num = v.f * 2^v.e */
+  ecma_number_diy_fp_t v;
+
+  if (biased_exp == 0)
+  {
+    v.f = fraction_field;
+    v.e = 1 - exponent_bias - ECMA_NUMBER_FRACTION_WIDTH;
+  }
+  else
+  {
+    v.f = fraction_field | (1ull << ECMA_NUMBER_FRACTION_WIDTH);
+    v.e = (int32_t) biased_exp - exponent_bias - ECMA_NUMBER_FRACTION_WIDTH;
+  }
+
+  /* boundaries are the middles between the number and its neighbours */
+  ecma_number_diy_fp_t boundary_plus, boundary_minus;
+
+  boundary_plus.f = (v.f << 1u) + 1;
+  boundary_plus.e = v.e - 1;
+  boundary_plus = ecma_number_diy_fp_normalize (boundary_plus);
+
+  if (fraction_field == 0 && biased_exp > 1)
+  {
+    /* the previous number has smaller exponent, so the lower boundary is closer */
+    boundary_minus.f = (v.f << 2u) - 1;
+    boundary_minus.e = v.e - 2;
+  }
+  else
+  {
+    boundary_minus.f = (v.f << 1u) - 1;
+    boundary_minus.e = v.e - 1;
+  }
+
+  boundary_minus.f <<= boundary_minus.e - boundary_plus.e;
+  boundary_minus.e = boundary_plus.e;
+
+  const ecma_number_diy_fp_t w = ecma_number_diy_fp_normalize (v);
+  JERRY_ASSERT (w.e == boundary_plus.e);
+
+  int32_t ten_mk_decimal_exp;
+  const ecma_number_diy_fp_t ten_mk = ecma_number_grisu_get_cached_power (w.e, &ten_mk_decimal_exp);
+
+  int32_t kappa;
+  bool is_correct = ecma_number_grisu_digit_gen (ecma_number_diy_fp_multiply (boundary_minus, ten_mk),
+                                                 ecma_number_diy_fp_multiply (w, ten_mk),
+                                                 ecma_number_diy_fp_multiply (boundary_plus, ten_mk),
+                                                 out_digits_p,
+                                                 out_digits_num_p,
+                                                 &kappa);
+
+  /* num ~ digits * 10^(kappa - ten_mk_decimal_exp) */
+  *out_decimal_exp_p = kappa - ten_mk_decimal_exp + *out_digits_num_p;
+
+  return is_correct;
+} /* ecma_number_to_decimal_grisu3 */
+
+/**
+ * @}
+ */
+
+/*
+ * \addtogroup ecmahelpersbignum Exact calculation of shortest decimal representation with big integers
+ * @{
+ *
+ * See also:
+ *          Robert G. Burger, R. Kent Dybvig, Printing Floating-Point Numbers Quickly and Accurately, PLDI 1996
+ */
+
+/**
+ * Number of 32-bit digits in big integers, used for the calculation
+ *
+ * Note:
+ *      the values, used during the calculation, are less than 2 ^ 1100
+ */
+#define ECMA_NUMBER_BIGNUM_DIGITS (36)
+
+/**
+ * Unsigned big integer
+ */
+typedef struct
+{
+  uint32_t digits[ECMA_NUMBER_BIGNUM_DIGITS]; /**< digits in base 2 ^ 32, starting from the least significant */
+  uint32_t size; /**< number of used digits */
+} ecma_number_bignum_t;
+
+/**
+ * Initialize big integer with a value
+ */
+static void
+ecma_number_bignum_init (ecma_number_bignum_t *bignum_p, /**< out: big integer */
+                         uint64_t value) /**< value */
+{
+  bignum_p->size = 0;
+
+  while (value != 0)
+  {
+    bignum_p->digits[bignum_p->size++] = (uint32_t) value;
+    value >>= 32u;
+  }
+} /* ecma_number_bignum_init */
+
+/**
+ * Multiply big integer by a 32-bit value
+ */
+static void
+ecma_number_bignum_multiply (ecma_number_bignum_t *bignum_p, /**< in-out: big integer */
+                             uint32_t multiplier) /**< multiplier */
+{
+  uint64_t carry = 0;
+
+  for (uint32_t i = 0; i < bignum_p->size; i++)
+  {
+    carry += (uint64_t) bignum_p->digits[i] * multiplier;
+    bignum_p->digits[i] = (uint32_t) carry;
+    carry >>= 32u;
+  }
+
+  if (carry != 0)
+  {
+    JERRY_ASSERT (bignum_p->size < ECMA_NUMBER_BIGNUM_DIGITS);
+
+    bignum_p->digits[bignum_p->size++] = (uint32_t) carry;
+  }
+} /* ecma_number_bignum_multiply */
+
+/**
+ * Multiply big integer by a power of two
+ */
+static void
+ecma_number_bignum_shift_left (ecma_number_bignum_t *bignum_p, /**< in-out: big integer */
+                               uint32_t shift) /**< exponent of the power of two */
+{
+  while (shift >= 31)
+  {
+    ecma_number_bignum_multiply (bignum_p, 1u << 31u);
+    shift -= 31;
+  }
+
+  ecma_number_bignum_multiply (bignum_p, 1u << shift);
+} /* ecma_number_bignum_shift_left */
+
+/**
+ * Multiply big integer by a power of ten
+ */
+static void
+ecma_number_bignum_multiply_pow10 (ecma_number_bignum_t *bignum_p, /**< in-out: big integer */
+                                   uint32_t exp) /**< exponent of the power of ten */
+{
+  const uint32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+  while (exp >= 9)
+  {
+    ecma_number_bignum_multiply (bignum_p, pow10[9]);
+    exp -= 9;
+  }
+
+  ecma_number_bignum_multiply (bignum_p, pow10[exp]);
+} /* ecma_number_bignum_multiply_pow10 */
+
+/**
+ * Calculate sum of two big integers
+ */
+static void
+ecma_number_bignum_add (ecma_number_bignum_t *out_sum_p, /**< out: sum */
+                        const ecma_number_bignum_t *a_p, /**< first operand */
+                        const ecma_number_bignum_t *b_p) /**< second operand */
+{
+  uint64_t carry = 0;
+  uint32_t size = JERRY_MAX (a_p->size, b_p->size);
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    carry += (i < a_p->size) ? a_p->digits[i] : 0;
+    carry += (i < b_p->size) ? b_p->digits[i] : 0;
+    out_sum_p->digits[i] = (uint32_t) carry;
+    carry >>= 32u;
+  }
+
+  if (carry != 0)
+  {
+    JERRY_ASSERT (size < ECMA_NUMBER_BIGNUM_DIGITS);
+
+    out_sum_p->digits[size++] = (uint32_t) carry;
+  }
+
+  out_sum_p->size = size;
+} /* ecma_number_bignum_add */
+
+/**
+ * Subtract big integer from another one, which is not less
+ */
+static void
+ecma_number_bignum_subtract (ecma_number_bignum_t *bignum_p, /**< in-out: minuend */
+                             const ecma_number_bignum_t *subtrahend_p) /**< subtrahend */
+{
+  JERRY_ASSERT (bignum_p->size >= subtrahend_p->size);
+
+  uint32_t borrow = 0;
+
+  for (uint32_t i = 0; i < bignum_p->size; i++)
+  {
+    uint64_t subtrahend = (uint64_t) ((i < subtrahend_p->size) ? subtrahend_p->digits[i] : 0) + borrow;
+
+    borrow = (bignum_p->digits[i] < subtrahend) ? 1 : 0;
+    bignum_p->digits[i] = (uint32_t) (bignum_p->digits[i] - subtrahend);
+  }
+
+  JERRY_ASSERT (borrow == 0);
+
+  while (bignum_p->size != 0 && bignum_p->digits[bignum_p->size - 1] == 0)
+  {
+    bignum_p->size--;
+  }
+} /* ecma_number_bignum_subtract */
+
+/**
+ * Compare two big integers
+ *
+ * @return negative value - if first operand is less than second,
+ *         zero - if operands are equal,
+ *         positive value - if first operand is greater than second
+ */
+static int
+ecma_number_bignum_compare (const ecma_number_bignum_t *a_p, /**< first operand */
+                            const ecma_number_bignum_t *b_p) /**< second operand */
+{
+  if (a_p->size != b_p->size)
+  {
+    return (a_p->size < b_p->size) ? -1 : 1;
+  }
+
+  for (uint32_t i = a_p->size; i > 0; i--)
+  {
+    if (a_p->digits[i - 1] != b_p->digits[i - 1])
     {
-      ECMA_NUMBER_CONVERSION_128BIT_INTEGER_MUL_10 (fraction_uint128_p1);
-      decimal_exp_p1--;
+      return (a_p->digits[i - 1] < b_p->digits[i - 1]) ? -1 : 1;
     }
   }
 
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ADD (fraction_uint128_m1, fraction_uint128);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128_m1);
+  return 0;
+} /* ecma_number_bignum_compare */
 
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ADD (fraction_uint128_p1, fraction_uint128);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_RIGHT_SHIFT (fraction_uint128_p1);
+/**
+ * Check whether the upper boundary of a number is not less than the scale
+ *
+ * @return true - if (value + boundary) >= scale, and the boundary belongs to the number's rounding interval,
+ *                or (value + boundary) > scale,
+ *         false - otherwise
+ */
+static bool
+ecma_number_bignum_is_high_reached (const ecma_number_bignum_t *value_p, /**< value */
+                                    const ecma_number_bignum_t *boundary_p, /**< distance to the boundary */
+                                    const ecma_number_bignum_t *scale_p, /**< scale */
+                                    bool is_boundary_included) /**< is the boundary in the rounding interval */
+{
+  ecma_number_bignum_t sum;
+  ecma_number_bignum_add (&sum, value_p, boundary_p);
 
-  /* While fraction doesn't fit to integer, divide it by 10
-       and simultaneously increment decimal exponent */
-  uint64_t digits_min, digits_max;
+  int cmp = ecma_number_bignum_compare (&sum, scale_p);
 
-  while (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128_m1, 63))
+  return is_boundary_included ? (cmp >= 0) : (cmp > 0);
+} /* ecma_number_bignum_is_high_reached */
+
+/**
+ * Calculate the shortest decimal representation of ecma-number, that is nearest to the number,
+ * with exact big integer arithmetic
+ */
+static void
+ecma_number_to_decimal_bignum (ecma_number_t num, /**< ecma-number */
+                               uint64_t *out_digits_p, /**< out: digits */
+                               int32_t *out_digits_num_p, /**< out: number of digits */
+                               int32_t *out_decimal_exp_p) /**< out: decimal exponent */
+{
+  JERRY_ASSERT (num > 0 && !ecma_number_is_infinity (num));
+
+  union
+  {
+    uint64_t u64_value;
+    ecma_number_t float_value;
+  } u;
+
+  u.float_value = num;
+
+  const int32_t exponent_bias = 1023;
+
+  const uint64_t fraction_field = u.u64_value & ((1ull << ECMA_NUMBER_FRACTION_WIDTH) - 1);
+  const uint32_t biased_exp = (uint32_t) (u.u64_value >> ECMA_NUMBER_FRACTION_WIDTH);
+
+  /* num = fraction * 2^binary_exp */
+  uint64_t fraction;
+  int32_t binary_exp;
+
+  if (biased_exp == 0)
   {
-    ECMA_NUMBER_CONVERSION_128BIT_INTEGER_DIV_10 (fraction_uint128_m1);
-    decimal_exp_m1++;
+    fraction = fraction_field;
+    binary_exp = 1 - exponent_bias - ECMA_NUMBER_FRACTION_WIDTH;
   }
-  while (!ECMA_NUMBER_CONVERSION_128BIT_INTEGER_IS_HIGH_BIT_MASK_ZERO (fraction_uint128_p1, 63))
+  else
   {
-    ECMA_NUMBER_CONVERSION_128BIT_INTEGER_DIV_10 (fraction_uint128_p1);
-    decimal_exp_p1++;
+    fraction = fraction_field | (1ull << ECMA_NUMBER_FRACTION_WIDTH);
+    binary_exp = (int32_t) biased_exp - exponent_bias - ECMA_NUMBER_FRACTION_WIDTH;
   }
 
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ROUND_MIDDLE_AND_LOW_TO_UINT64 (fraction_uint128_m1, digits_min);
-  ECMA_NUMBER_CONVERSION_128BIT_INTEGER_ROUND_MIDDLE_AND_LOW_TO_UINT64 (fraction_uint128_p1, digits_max);
+  /* numbers with even fraction are chosen, when rounding ties, so boundaries belong to their rounding intervals */
+  const bool is_boundary_included = ((fraction & 1) == 0);
+
+  /*
+   * num = value / scale, and the middles between the number and its neighbours are
+   * (value + high) / scale and (value - low) / scale
+   */
+  ecma_number_bignum_t value, scale, high, low;
 
-  digits_min++;
+  ecma_number_bignum_init (&value, fraction << 2u);
+  ecma_number_bignum_init (&scale, 4);
+  ecma_number_bignum_init (&high, 2);
 
-  if (decimal_exp_m1 < decimal_exp_p1)
-  {
-    JERRY_ASSERT (decimal_exp_m1 == decimal_exp_p1 - 1);
+  /* the previous number has smaller exponent, so the lower boundary is closer */
+  ecma_number_bignum_init (&low, (fraction_field == 0 && biased_exp > 1) ? 1 : 2);
 
-    digits_min /= 10;
-    decimal_exp_m1++;
+  if (binary_exp >= 0)
+  {
+    ecma_number_bignum_shift_left (&value, (uint32_t) binary_exp);
+    ecma_number_bignum_shift_left (&high, (uint32_t) binary_exp);
+    ecma_number_bignum_shift_left (&low, (uint32_t) binary_exp);
   }
-  else if (decimal_exp_m1 > decimal_exp_p1)
+  else
   {
-    JERRY_ASSERT (decimal_exp_m1 == decimal_exp_p1 + 1);
+    ecma_number_bignum_shift_left (&scale, (uint32_t) -binary_exp);
+  }
+
+  /* estimate of the decimal exponent: floor (log10 (2) * floor (log2 (num))), which is never too large */
+  int32_t log2_num = binary_exp;
 
-    digits_max /= 10;
-    decimal_exp_p1++;
+  for (uint64_t t = fraction; t > 1; t >>= 1u)
+  {
+    log2_num++;
   }
 
-  JERRY_ASSERT (digits_max >= digits_min);
+  int32_t decimal_exp = (log2_num >= 0) ? ((log2_num * 1233) >> 12) : -(((-log2_num) * 1233 + 4095) >> 12);
+
+  if (decimal_exp >= 0)
+  {
+    ecma_number_bignum_multiply_pow10 (&scale, (uint32_t) decimal_exp);
+  }
+  else
+  {
+    ecma_number_bignum_multiply_pow10 (&value, (uint32_t) -decimal_exp);
+    ecma_number_bignum_multiply_pow10 (&high, (uint32_t) -decimal_exp);
+    ecma_number_bignum_multiply_pow10 (&low, (uint32_t) -decimal_exp);
+  }
 
-  while (digits_min / 10 != digits_max / 10)
+  /* fix the estimate, so that the upper boundary is in [0.1, 1) * 10^decimal_exp */
+  while (ecma_number_bignum_is_high_reached (&value, &high, &scale, is_boundary_included))
   {
-    digits_min /= 10;
-    digits_max /= 10;
-    decimal_exp_m1++;
-    decimal_exp_p1++;
+    ecma_number_bignum_multiply (&scale, 10);
+    decimal_exp++;
   }
 
-  uint64_t digits = (digits_min + digits_max + 1) / 2;
+  /* generate digits, until the remainder gets into the rounding interval */
+  uint64_t digits = 0;
   int32_t digits_num = 0;
-  uint64_t t = digits;
+  bool is_last_digit;
 
-  while (t != 0)
+  do
   {
-    t /= 10;
+    ecma_number_bignum_multiply (&value, 10);
+    ecma_number_bignum_multiply (&high, 10);
+    ecma_number_bignum_multiply (&low, 10);
+
+    uint32_t digit = 0;
+
+    while (ecma_number_bignum_compare (&value, &scale) >= 0)
+    {
+      ecma_number_bignum_subtract (&value, &scale);
+      digit++;
+    }
+
+    int low_cmp = ecma_number_bignum_compare (&value, &low);
+    bool is_low_reached = is_boundary_included ? (low_cmp <= 0) : (low_cmp < 0);
+    bool is_high_reached = ecma_number_bignum_is_high_reached (&value, &high, &scale, is_boundary_included);
+
+    if (is_low_reached && is_high_reached)
+    {
+      /* both digit and digit + 1 are in the rounding interval, so the nearest is chosen, or the even one on tie */
+      ecma_number_bignum_t twice_value;
+      ecma_number_bignum_add (&twice_value, &value, &value);
+
+      int cmp = ecma_number_bignum_compare (&twice_value, &scale);
+
+      if (cmp > 0 || (cmp == 0 && (digit & 1) != 0))
+      {
+        digit++;
+      }
+    }
+    else if (is_high_reached)
+    {
+      digit++;
+    }
+
+    JERRY_ASSERT (digit < 10 && (digit != 0 || digits_num != 0));
+    JERRY_ASSERT (digits_num < ECMA_NUMBER_MAX_DIGITS);
+
+    digits = digits * 10 + digit;
     digits_num++;
-  }
 
-  JERRY_ASSERT (digits_num > 0);
+    is_last_digit = (is_low_reached || is_high_reached);
+  }
+  while (!is_last_digit);
 
   *out_digits_p = digits;
   *out_digits_num_p = digits_num;
-  *out_decimal_exp_p = decimal_exp_p1 + digits_num;
+  *out_decimal_exp_p = decimal_exp;
+} /* ecma_number_to_decimal_bignum */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
+/**
+  * Perform conversion of ecma-number to decimal representation with decimal exponent
+  *
+  * Note:
+  *      The calculated values correspond to s, n, k parameters in ECMA-262 v5, 9.8.1, item 5:
+  *         - s represents digits of the number;
+  *         - k is the number of digits;
+  *         - n is the decimal exponent.
+  */
+void
+ecma_number_to_decimal (ecma_number_t num, /**< ecma-number */
+                        uint64_t *out_digits_p, /**< out: digits */
+                        int32_t *out_digits_num_p, /**< out: number of digits */
+                        int32_t *out_decimal_exp_p) /**< out: decimal exponent */
+{
+  JERRY_ASSERT (!ecma_number_is_nan (num));
+  JERRY_ASSERT (!ecma_number_is_zero (num));
+  JERRY_ASSERT (!ecma_number_is_infinity (num));
+
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  if (ecma_number_is_negative (num))
+  {
+    num = ecma_number_negate (num);
+  }
+
+  if (!ecma_number_to_decimal_grisu3 (num, out_digits_p, out_digits_num_p, out_decimal_exp_p))
+  {
+    /* the result of Grisu3 is not guaranteed to be correct, so calculate it exactly with big integers */
+    ecma_number_to_decimal_bignum (num, out_digits_p, out_digits_num_p, out_decimal_exp_p);
+  }
 
 #elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
   /* Less precise conversion */
@@ -1309,6 +2080,58 @@ ecma_number_to_decimal (ecma_number_t num, /**< ecma-number */
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32 */
 } /* ecma_number_to_decimal */
 
+#ifndef CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE
+JERRY_STATIC_ASSERT ((CONFIG_ECMA_NUMBER_TO_STRING_CACHE_SIZE & (CONFIG_ECMA_NUMBER_TO_STRING_CACHE_SIZE - 1)) == 0);
+
+/**
+ * Entry of number to string conversion cache
+ */
+typedef struct
+{
+  ecma_number_t num; /**< converted number (zero - if the entry is empty) */
+  lit_utf8_byte_t size; /**< size of the string */
+  lit_utf8_byte_t chars[23]; /**< characters of the string */
+} ecma_number_to_string_cache_entry_t;
+
+/**
+ * Number to string conversion cache
+ *
+ * Note:
+ *      only positive non-integer numbers are cached, as conversion of other numbers is fast
+ */
+static ecma_number_to_string_cache_entry_t ecma_number_to_string_cache[CONFIG_ECMA_NUMBER_TO_STRING_CACHE_SIZE];
+
+/**
+ * Get entry of number to string conversion cache, corresponding to the number
+ *
+ * @return pointer to the cache entry
+ */
+static ecma_number_to_string_cache_entry_t *
+ecma_number_to_string_cache_get_entry (ecma_number_t num) /**< ecma-number */
+{
+  union
+  {
+    uint32_t u32_value[sizeof (ecma_number_t) / sizeof (uint32_t)];
+    ecma_number_t float_value;
+  } u;
+
+  u.float_value = num;
+
+  uint32_t hash = 0;
+
+  for (uint32_t i = 0; i < sizeof (u.u32_value) / sizeof (u.u32_value[0]); i++)
+  {
+    hash ^= u.u32_value[i];
+  }
+
+  hash ^= hash >> 16u;
+  hash *= 0x45d9f3bu;
+  hash ^= hash >> 16u;
+
+  return &ecma_number_to_string_cache[hash & (CONFIG_ECMA_NUMBER_TO_STRING_CACHE_SIZE - 1)];
+} /* ecma_number_to_string_cache_get_entry */
+#endif /* !CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE */
+
 /**
  * Convert ecma-number to zero-terminated string
  *
@@ -1375,6 +2198,18 @@ ecma_number_to_utf8_string (ecma_number_t num, /**< ecma-number */
       }
       else
       {
+#ifndef CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE
+        ecma_number_to_string_cache_entry_t *cache_entry_p = ecma_number_to_string_cache_get_entry (num);
+
+        if (cache_entry_p->num == num)
+        {
+          JERRY_ASSERT ((ssize_t) cache_entry_p->size <= buffer_size);
+
+          memcpy (buffer_p, cache_entry_p->chars, cache_entry_p->size);
+          return cache_entry_p->size;
+        }
+#endif /* !CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE */
+
         /* mantissa */
         uint64_t s;
         /* decimal exponent */
@@ -1515,6 +2350,15 @@ ecma_number_to_utf8_string (ecma_number_t num, /**< ecma-number */
         }
 
         JERRY_ASSERT (s == 0);
+
+#ifndef CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE
+        if (size <= sizeof (cache_entry_p->chars))
+        {
+          cache_entry_p->num = num;
+          cache_entry_p->size = (lit_utf8_byte_t) size;
+          memcpy (cache_entry_p->chars, buffer_p, size);
+        }
+#endif /* !CONFIG_ECMA_NUMBER_TO_STRING_CACHE_DISABLE */
       }
     }
   }
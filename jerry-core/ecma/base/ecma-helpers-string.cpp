@@ -347,6 +347,12 @@ ecma_init_ecma_string_from_lit_cp (ecma_string_t *string_p, /**< descriptor to i
 
   JERRY_ASSERT (lit->get_type () == LIT_STR_T);
 
+  if (!is_stack_var)
+  {
+    /* heap strings can outlive the byte-code the literal came from */
+    lit_charset_literal_ref (lit);
+  }
+
   string_p->refs = 1;
   string_p->is_stack_var = (is_stack_var != 0);
   string_p->container = ECMA_STRING_CONTAINER_LIT_TABLE;
@@ -662,6 +668,18 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
   switch ((ecma_string_container_t) string_desc_p->container)
   {
     case ECMA_STRING_CONTAINER_LIT_TABLE:
+    {
+      new_str_p = ecma_alloc_string ();
+
+      *new_str_p = *string_desc_p;
+
+      new_str_p->refs = 1;
+      new_str_p->is_stack_var = false;
+
+      lit_charset_literal_ref (lit_get_literal_by_cp (new_str_p->u.lit_cp));
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
@@ -801,6 +819,14 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       break;
     }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
+    {
+      if (!string_p->is_stack_var)
+      {
+        lit_charset_literal_deref (lit_get_literal_by_cp (string_p->u.lit_cp));
+      }
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
@@ -1704,6 +1730,98 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
   JERRY_UNREACHABLE ();
 } /* ecma_string_substr */
 
+/**
+ * Find an occurrence of a search string in an ecma string
+ *
+ * Forward search looks for the first occurrence at or after the start position,
+ * backward search looks for the last occurrence at or before the start position.
+ *
+ * See also:
+ *          lit_utf8_string_find
+ *          lit_utf8_string_find_last
+ *
+ * @return true - if occurrence was found (its position is returned through ret_index_p),
+ *         false - otherwise
+ */
+bool
+ecma_string_find (const ecma_string_t *string_p, /**< ecma-string to search in */
+                  const ecma_string_t *search_str_p, /**< ecma-string to search for */
+                  bool is_forward, /**< search for first (true) or last (false) occurrence */
+                  ecma_length_t start_pos, /**< start position, should be less or equal than string length */
+                  ecma_length_t *ret_index_p) /**< out: position of the occurrence */
+{
+  const ecma_length_t string_length = ecma_string_get_length (string_p);
+  const ecma_length_t search_length = ecma_string_get_length (search_str_p);
+
+  JERRY_ASSERT (start_pos <= string_length);
+
+  if (search_length > string_length)
+  {
+    return false;
+  }
+  else if (search_length == 0)
+  {
+    *ret_index_p = start_pos;
+    return true;
+  }
+
+  bool is_found = false;
+
+  const lit_utf8_size_t string_size = ecma_string_get_size (string_p);
+  const lit_utf8_size_t search_size = ecma_string_get_size (search_str_p);
+
+  /* all characters of the string are one byte long, so positions are equal to offsets */
+  const bool is_ascii = (string_size == string_length);
+
+  MEM_DEFINE_LOCAL_ARRAY (string_utf8_p, string_size, lit_utf8_byte_t);
+  MEM_DEFINE_LOCAL_ARRAY (search_str_utf8_p, search_size, lit_utf8_byte_t);
+
+  ssize_t sz = ecma_string_to_utf8_string (string_p, string_utf8_p, (ssize_t) string_size);
+  JERRY_ASSERT (sz >= 0);
+
+  sz = ecma_string_to_utf8_string (search_str_p, search_str_utf8_p, (ssize_t) search_size);
+  JERRY_ASSERT (sz >= 0);
+
+  lit_utf8_size_t start_offset = start_pos;
+
+  if (!is_ascii)
+  {
+    start_offset = 0;
+
+    for (ecma_length_t i = 0; i < start_pos; i++)
+    {
+      start_offset += lit_get_unicode_char_size_by_utf8_first_byte (string_utf8_p[start_offset]);
+    }
+  }
+
+  lit_utf8_size_t found_offset;
+
+  if (is_forward)
+  {
+    is_found = lit_utf8_string_find (string_utf8_p, string_size,
+                                     search_str_utf8_p, search_size,
+                                     start_offset,
+                                     &found_offset);
+  }
+  else
+  {
+    is_found = lit_utf8_string_find_last (string_utf8_p, string_size,
+                                          search_str_utf8_p, search_size,
+                                          start_offset,
+                                          &found_offset);
+  }
+
+  if (is_found)
+  {
+    *ret_index_p = (is_ascii ? found_offset : lit_utf8_string_length (string_utf8_p, found_offset));
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (search_str_utf8_p);
+  MEM_FINALIZE_LOCAL_ARRAY (string_utf8_p);
+
+  return is_found;
+} /* ecma_string_find */
+
 /**
  * Trim leading and trailing whitespace characters from string.
  *
@@ -24,6 +24,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "jrt.h"
+#include "mem-heap.h"
 
 /**
  * Allocate a collection of ecma-values.
@@ -349,6 +350,73 @@ ecma_collection_iterator_next (ecma_collection_iterator_t *iterator_p) /**< cont
   return true;
 } /* ecma_collection_iterator_next */
 
+/**
+ * Allocate an array of ecma-values.
+ *
+ * @return pointer to the array's header
+ */
+ecma_values_array_header_t *
+ecma_new_values_array (const ecma_value_t values_buffer[], /**< ecma-values */
+                       ecma_length_t values_number, /**< number of ecma-values */
+                       bool do_ref_if_object) /**< if the value is object value,
+                                                   increase reference counter of the object */
+{
+  JERRY_ASSERT (values_buffer != NULL || values_number == 0);
+
+  const size_t size = sizeof (ecma_values_array_header_t) + values_number * sizeof (ecma_value_t);
+
+  ecma_values_array_header_t *header_p;
+  header_p = (ecma_values_array_header_t *) mem_heap_alloc_block (size, MEM_HEAP_ALLOC_LONG_TERM);
+
+  header_p->unit_number = values_number;
+
+  ecma_value_t *values_p = ecma_get_values_array_data (header_p);
+
+  for (ecma_length_t value_index = 0;
+       value_index < values_number;
+       value_index++)
+  {
+    values_p[value_index] = ecma_copy_value (values_buffer[value_index], do_ref_if_object);
+  }
+
+  return header_p;
+} /* ecma_new_values_array */
+
+/**
+ * Free the array of ecma-values.
+ */
+void
+ecma_free_values_array (ecma_values_array_header_t *header_p, /**< array's header */
+                        bool do_deref_if_object) /**< if the value is object value,
+                                                      decrement reference counter of the object */
+{
+  JERRY_ASSERT (header_p != NULL);
+
+  ecma_value_t *values_p = ecma_get_values_array_data (header_p);
+
+  for (ecma_length_t value_index = 0;
+       value_index < header_p->unit_number;
+       value_index++)
+  {
+    ecma_free_value (values_p[value_index], do_deref_if_object);
+  }
+
+  mem_heap_free_block (header_p);
+} /* ecma_free_values_array */
+
+/**
+ * Get pointer to the values of the array of ecma-values
+ *
+ * @return pointer to the first value
+ */
+ecma_value_t *
+ecma_get_values_array_data (ecma_values_array_header_t *header_p) /**< array's header */
+{
+  JERRY_STATIC_ASSERT (sizeof (ecma_values_array_header_t) % sizeof (ecma_value_t) == 0);
+
+  return (ecma_value_t *) (header_p + 1);
+} /* ecma_get_values_array_data */
+
 /**
  * @}
  * @}
@@ -815,6 +815,8 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
     case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
     case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_TARGET_FUNCTION:
+    case ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE: /* an object */
+    case ECMA_INTERNAL_PROPERTY_FUNCTION_TEMPLATE: /* an object */
     {
       break;
     }
@@ -825,7 +827,14 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
       break;
     }
 
-    case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS:
+    case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS: /* an array of ecma-values */
+    {
+      ecma_free_values_array (ECMA_GET_NON_NULL_POINTER (ecma_values_array_header_t, property_value), false);
+
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES: /* a collection of ecma-values */
     {
       if (property_value != ECMA_NULL_POINTER)
       {
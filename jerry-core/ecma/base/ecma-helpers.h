@@ -138,6 +138,7 @@ extern bool ecma_is_ex_string_magic (const ecma_string_t *, lit_magic_string_ex_
 
 extern lit_string_hash_t ecma_string_hash (const ecma_string_t *);
 extern ecma_string_t *ecma_string_substr (const ecma_string_t *, ecma_length_t, ecma_length_t);
+extern bool ecma_string_find (const ecma_string_t *, const ecma_string_t *, bool, ecma_length_t, ecma_length_t *);
 extern ecma_string_t *ecma_string_trim (const ecma_string_t *);
 
 /* ecma-helpers-number.cpp */
@@ -176,6 +177,9 @@ extern void ecma_free_values_collection (ecma_collection_header_t *, bool);
 extern void ecma_append_to_values_collection (ecma_collection_header_t *, ecma_value_t, bool);
 extern void ecma_remove_last_value_from_values_collection (ecma_collection_header_t *, bool);
 extern ecma_collection_header_t *ecma_new_strings_collection (ecma_string_t *[], ecma_length_t);
+extern ecma_values_array_header_t *ecma_new_values_array (const ecma_value_t[], ecma_length_t, bool);
+extern void ecma_free_values_array (ecma_values_array_header_t *, bool);
+extern ecma_value_t *ecma_get_values_array_data (ecma_values_array_header_t *);
 
 /**
  * Context of ecma-values' collection iterator
@@ -14,6 +14,8 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-eval.h"
+#include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
@@ -36,11 +38,56 @@ ecma_init (void)
 {
   ecma_init_builtins ();
   ecma_lcache_init ();
+  ecma_op_function_template_cache_init ();
+  ecma_eval_cache_init ();
   ecma_init_environment ();
 
   mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
 } /* ecma_init */
 
+/**
+ * Prepare ECMA components for saving their state to a heap image
+ *
+ * Note:
+ *      the caches are invalidated, as their entries are not accounted as references to objects,
+ *      and unreferenced objects are collected, so that only live objects are saved
+ */
+void
+ecma_prepare_for_image (void)
+{
+  ecma_lcache_invalidate_all ();
+  ecma_op_function_template_cache_invalidate_all ();
+  ecma_eval_cache_invalidate_all ();
+  ecma_gc_run ();
+} /* ecma_prepare_for_image */
+
+/**
+ * Add memory regions, containing state of ECMA components, to list of heap image's regions
+ */
+void
+ecma_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  ecma_gc_get_image_regions (regions_p);
+  ecma_builtins_get_image_regions (regions_p);
+  ecma_environment_get_image_regions (regions_p);
+} /* ecma_get_image_regions */
+
+/**
+ * Initialize ECMA components after their state was restored from a heap image
+ *
+ * Note:
+ *      the built-in objects and Global environment are not instantiated again, as they are part of the image
+ */
+void
+ecma_init_from_image (void)
+{
+  ecma_lcache_init ();
+  ecma_op_function_template_cache_init ();
+  ecma_eval_cache_init ();
+
+  mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
+} /* ecma_init_from_image */
+
 /**
  * Finalize ECMA components
  */
@@ -52,6 +99,8 @@ ecma_finalize (void)
   ecma_finalize_environment ();
   ecma_finalize_builtins ();
   ecma_lcache_invalidate_all ();
+  ecma_op_function_template_cache_invalidate_all ();
+  ecma_eval_cache_invalidate_all ();
   ecma_gc_run ();
 } /* ecma_finalize */
 
@@ -16,6 +16,8 @@
 #ifndef ECMA_INIT_FINALIZE_H
 #define ECMA_INIT_FINALIZE_H
 
+#include "mem-allocator.h"
+
 /** \addtogroup ecma ECMA
  * @{
  */
@@ -27,6 +29,9 @@
 
 extern void ecma_init (void);
 extern void ecma_finalize (void);
+extern void ecma_prepare_for_image (void);
+extern void ecma_get_image_regions (mem_image_regions_t *);
+extern void ecma_init_from_image (void);
 
 /**
  * @}
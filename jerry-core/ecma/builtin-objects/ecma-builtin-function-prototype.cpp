@@ -24,6 +24,7 @@
 #include "ecma-helpers.h"
 #include "ecma-function-object.h"
 #include "ecma-objects.h"
+#include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
 #include "jrt.h"
 
@@ -70,6 +71,110 @@ ecma_builtin_function_prototype_object_to_string (ecma_value_t this_arg) /**< th
   return ret_value;
 } /* ecma_builtin_function_prototype_object_to_string */
 
+/**
+ * Call the function with arguments, taken from elements of array-like object
+ *
+ * See also:
+ *          ECMA-262 v5, 15.3.4.3 (steps 4 - 9)
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_function_prototype_apply_array_like (ecma_object_t *func_obj_p, /**< function object */
+                                                  ecma_value_t this_arg_value, /**< 'this' argument for
+                                                                                *   the call */
+                                                  ecma_object_t *obj_p) /**< array-like object */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  /* 4. */
+  ECMA_TRY_CATCH (length_value,
+                  ecma_op_object_get (obj_p, length_magic_string_p),
+                  ret_value);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_number,
+                               length_value,
+                               ret_value);
+
+  /* 5. */
+  const uint32_t length = ecma_number_to_uint32 (length_number);
+
+  /*
+   * Elements of an ordinary Array object, that are its own data properties, are read directly,
+   * without going through [[Get]]; holes and accessors are handled by [[Get]], as usual.
+   */
+  const bool is_ordinary_array = (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY
+                                  && !ecma_get_object_is_builtin (obj_p));
+
+  /* 6. */
+  MEM_DEFINE_LOCAL_ARRAY (arg_values, length, ecma_value_t);
+
+  /* 7. */
+  uint32_t index;
+  for (index = 0; index < length; index++)
+  {
+    ecma_string_t *curr_idx_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+    ecma_property_t *elem_prop_p = NULL;
+
+    if (is_ordinary_array)
+    {
+      elem_prop_p = ecma_find_named_property (obj_p, curr_idx_str_p);
+    }
+
+    if (elem_prop_p != NULL
+        && elem_prop_p->type == ECMA_PROPERTY_NAMEDDATA)
+    {
+      arg_values[index] = ecma_copy_value (ecma_get_named_data_property_value (elem_prop_p), true);
+    }
+    else
+    {
+      ECMA_TRY_CATCH (get_value,
+                      ecma_op_object_get (obj_p, curr_idx_str_p),
+                      ret_value);
+
+      arg_values[index] = ecma_copy_value (get_value, true);
+
+      ECMA_FINALIZE (get_value);
+    }
+
+    ecma_deref_ecma_string (curr_idx_str_p);
+
+    if (!ecma_is_completion_value_empty (ret_value))
+    {
+      break;
+    }
+  }
+
+  JERRY_ASSERT (index == length || !ecma_is_completion_value_empty (ret_value));
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    /* 8., 9. */
+    ret_value = ecma_op_function_call (func_obj_p,
+                                       this_arg_value,
+                                       arg_values,
+                                       length);
+  }
+
+  for (uint32_t i = 0; i < index; i++)
+  {
+    ecma_free_value (arg_values[i], true);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (arg_values);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_number);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  return ret_value;
+} /* ecma_builtin_function_prototype_apply_array_like */
+
 /**
  * The Function.prototype object's 'apply' routine
  *
@@ -98,7 +203,7 @@ ecma_builtin_function_prototype_object_apply (ecma_value_t this_arg, /**< this a
     /* 2. */
     if (ecma_is_value_null (arg2) || ecma_is_value_undefined (arg2))
     {
-      ret_value = ecma_op_function_call (func_obj_p, arg1, NULL);
+      ret_value = ecma_op_function_call (func_obj_p, arg1, NULL, 0);
     }
     else
     {
@@ -110,52 +215,36 @@ ecma_builtin_function_prototype_object_apply (ecma_value_t this_arg, /**< this a
       else
       {
         ecma_object_t *obj_p = ecma_get_object_from_value (arg2);
-        ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-
-        /* 4. */
-        ECMA_TRY_CATCH (length_value,
-                        ecma_op_object_get (obj_p, length_magic_string_p),
-                        ret_value);
-
-        ECMA_OP_TO_NUMBER_TRY_CATCH (length_number,
-                                     length_value,
-                                     ret_value);
-
-        /* 5. */
-        const uint32_t length = ecma_number_to_uint32 (length_number);
+        ecma_length_t arguments_number;
 
-        /* 6. */
-        ecma_collection_header_t *arg_collection_p = ecma_new_values_collection (NULL, 0, true);
-
-        /* 7. */
-        for (uint32_t index = 0; index < length && ecma_is_completion_value_empty (ret_value); index++)
+        if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARGUMENTS
+            && ecma_op_arguments_object_get_arguments_number (obj_p, &arguments_number))
         {
-          ecma_string_t *curr_idx_str_p = ecma_new_ecma_string_from_uint32 (index);
-
-          ECMA_TRY_CATCH (get_value,
-                          ecma_op_object_get (obj_p, curr_idx_str_p),
-                          ret_value);
+          /*
+           * Fast path for not yet materialized Arguments object (fn.apply (this, arguments)):
+           * the object's 'length' and index properties are known to be plain data properties,
+           * so steps 4 - 7 are reduced to copying the arguments' values.
+           */
+          MEM_DEFINE_LOCAL_ARRAY (arg_values, arguments_number, ecma_value_t);
 
-          ecma_append_to_values_collection (arg_collection_p, get_value, true);
-
-          ECMA_FINALIZE (get_value);
-          ecma_deref_ecma_string (curr_idx_str_p);
-        }
+          ecma_op_arguments_object_copy_arguments (obj_p, arg_values);
 
-        JERRY_ASSERT (arg_collection_p->unit_number == length || !ecma_is_completion_value_empty (ret_value));
-
-        if (ecma_is_completion_value_empty (ret_value))
-        {
           ret_value = ecma_op_function_call (func_obj_p,
                                              arg1,
-                                             arg_collection_p);
-        }
+                                             arg_values,
+                                             arguments_number);
 
-        ecma_free_values_collection (arg_collection_p, true);
+          for (uint32_t i = 0; i < arguments_number; i++)
+          {
+            ecma_free_value (arg_values[i], true);
+          }
 
-        ECMA_OP_TO_NUMBER_FINALIZE (length_number);
-        ECMA_FINALIZE (length_value);
-        ecma_deref_ecma_string (length_magic_string_p);
+          MEM_FINALIZE_LOCAL_ARRAY (arg_values);
+        }
+        else
+        {
+          ret_value = ecma_builtin_function_prototype_apply_array_like (func_obj_p, arg1, obj_p);
+        }
       }
     }
   }
@@ -189,14 +278,15 @@ ecma_builtin_function_prototype_object_call (ecma_value_t this_arg, /**< this ar
     {
       return ecma_op_function_call (func_obj_p,
                                     ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
-                                    NULL);
+                                    NULL,
+                                    0);
     }
     else
     {
-      return ecma_op_function_call_array_args (func_obj_p,
-                                               arguments_list_p[0],
-                                               (arguments_number == 1u) ? NULL : (arguments_list_p + 1),
-                                               (ecma_length_t) (arguments_number - 1u));
+      return ecma_op_function_call (func_obj_p,
+                                    arguments_list_p[0],
+                                    (arguments_number == 1u) ? NULL : (arguments_list_p + 1),
+                                    (ecma_length_t) (arguments_number - 1u));
     }
   }
 } /* ecma_builtin_function_prototype_object_call */
@@ -254,12 +344,12 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
 
     if (arg_count > 1)
     {
-      ecma_collection_header_t *bound_args_collection_p;
-      bound_args_collection_p = ecma_new_values_collection (&arguments_list_p[1], arg_count - 1, false);
+      ecma_values_array_header_t *bound_args_array_p;
+      bound_args_array_p = ecma_new_values_array (&arguments_list_p[1], arg_count - 1, false);
 
       ecma_property_t *bound_args_prop_p;
       bound_args_prop_p = ecma_create_internal_property (function_p, ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS);
-      ECMA_SET_NON_NULL_POINTER (bound_args_prop_p->u.internal_property.value, bound_args_collection_p);
+      ECMA_SET_NON_NULL_POINTER (bound_args_prop_p->u.internal_property.value, bound_args_array_p);
     }
 
     /*
@@ -158,7 +158,8 @@ ecma_builtin_helper_get_to_locale_string_at_index (ecma_object_t *obj_p, /** < t
       ECMA_TRY_CATCH (call_value,
                       ecma_op_function_call (locale_func_obj_p,
                                              ecma_make_object_value (index_obj_p),
-                                             NULL),
+                                             NULL,
+                                             0),
                       ret_value);
       ret_value = ecma_op_to_string (call_value);
       ECMA_FINALIZE (call_value);
@@ -526,7 +527,7 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_value_t this_arg, /**
 
   /* 8 (indexOf) -- 9 (lastIndexOf) */
   ecma_length_t index_of = 0;
-  if (ecma_builtin_helper_string_find_index (original_str_p, search_str_p, first_index, start, &index_of))
+  if (ecma_string_find (original_str_p, search_str_p, first_index, start, &index_of))
   {
     *ret_num_p = ecma_uint32_to_number (index_of);
   }
@@ -541,141 +542,6 @@ ecma_builtin_helper_string_prototype_object_index_of (ecma_value_t this_arg, /**
   return ret_value;
 } /* ecma_builtin_helper_string_prototype_object_index_of */
 
-/**
- * Helper function for finding index of a search string
- *
- * This function clamps the given index to the [0, length] range.
- * If the index is negative, 0 value is used.
- * If the index is greater than the length of the string, the normalized index will be the length of the string.
- * NaN is mapped to zero or length depending on the nan_to_zero parameter.
- *
- * See also:
- *          ECMA-262 v5, 15.5.4.7,8,11
- *
- * Used by:
- *         - The ecma_builtin_helper_string_prototype_object_index_of helper routine.
- *         - The ecma_builtin_string_prototype_object_replace_match helper routine.
- *
- * @return uint32_t - the normalized value of the index
- */
-bool
-ecma_builtin_helper_string_find_index (ecma_string_t *original_str_p, /**< index */
-                                       ecma_string_t *search_str_p, /**< string's length */
-                                       bool first_index, /**< whether search for first (t) or last (f) index */
-                                       ecma_length_t start_pos, /**< start position */
-                                       ecma_length_t *ret_index_p) /**> position found in original string */
-{
-  bool match_found = false;
-
-  const ecma_length_t original_len = ecma_string_get_length (original_str_p);
-  const lit_utf8_size_t original_size = ecma_string_get_size (original_str_p);
-
-  const ecma_length_t search_len = ecma_string_get_length (search_str_p);
-  const lit_utf8_size_t search_size = ecma_string_get_size (search_str_p);
-
-  if (search_len <= original_len)
-  {
-    if (!search_len)
-    {
-      match_found = true;
-      *ret_index_p = first_index ? 0 : original_len;
-    }
-    else
-    {
-      /* create utf8 string from original string and advance to position */
-      MEM_DEFINE_LOCAL_ARRAY (original_str_utf8_p,
-                              original_size,
-                              lit_utf8_byte_t);
-
-      ssize_t sz = ecma_string_to_utf8_string (original_str_p,
-                                               original_str_utf8_p,
-                                               (ssize_t) (original_size));
-      JERRY_ASSERT (sz >= 0);
-
-      ecma_length_t index = start_pos;
-
-      lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p;
-      for (ecma_length_t idx = 0; idx < index; idx++)
-      {
-        lit_utf8_incr (&original_str_curr_p);
-      }
-
-      /* create utf8 string from search string */
-      MEM_DEFINE_LOCAL_ARRAY (search_str_utf8_p,
-                              search_size,
-                              lit_utf8_byte_t);
-
-      ssize_t sz = ecma_string_to_utf8_string (search_str_p,
-                                               search_str_utf8_p,
-                                               (ssize_t) (search_size));
-      JERRY_ASSERT (sz >= 0);
-
-      lit_utf8_byte_t *search_str_curr_p = search_str_utf8_p;
-
-      /* iterate original string and try to match at each position */
-      bool searching = true;
-      ecma_char_t first_char = lit_utf8_read_next (&search_str_curr_p);
-      while (searching)
-      {
-        /* match as long as possible */
-        ecma_length_t match_len = 0;
-        lit_utf8_byte_t *stored_original_str_curr_p = original_str_curr_p;
-
-        if (match_len < search_len &&
-            index + match_len < original_len &&
-            lit_utf8_read_next (&original_str_curr_p) == first_char)
-        {
-          lit_utf8_byte_t *nested_search_str_curr_p = search_str_curr_p;
-          match_len++;
-
-          while (match_len < search_len &&
-                 index + match_len < original_len &&
-                 lit_utf8_read_next (&original_str_curr_p) == lit_utf8_read_next (&nested_search_str_curr_p))
-          {
-            match_len++;
-          }
-        }
-
-        /* check for match */
-        if (match_len == search_len)
-        {
-          match_found = true;
-          *ret_index_p = index;
-
-          break;
-        }
-        else
-        {
-          /* inc/dec index and update iterators and search condition */
-          original_str_curr_p = stored_original_str_curr_p;
-
-          if (first_index)
-          {
-            if ((searching = (index <= original_len - search_len)))
-            {
-              lit_utf8_incr (&original_str_curr_p);
-              index++;
-            }
-          }
-          else
-          {
-            if ((searching = (index > 0)))
-            {
-              lit_utf8_decr (&original_str_curr_p);
-              index--;
-            }
-          }
-        }
-      }
-
-      MEM_FINALIZE_LOCAL_ARRAY (search_str_utf8_p);
-      MEM_FINALIZE_LOCAL_ARRAY (original_str_utf8_p);
-    }
-  }
-
-  return match_found;
-} /* ecma_builtin_helper_string_find_index */
-
 /**
  * Helper function for using [[DefineOwnProperty]].
  *
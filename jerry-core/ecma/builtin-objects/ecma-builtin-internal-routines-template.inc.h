@@ -33,8 +33,14 @@
   PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _try_to_instantiate_property)
 #define LIST_LAZY_PROPERTY_NAMES_ROUTINE_NAME(builtin_underscored_id) \
   PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _list_lazy_property_names)
-#define DISPATCH_ROUTINE_ROUTINE_NAME(builtin_underscored_id) \
-  PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _dispatch_routine)
+#define ROUTINES_TABLE_NAME(builtin_underscored_id) \
+  PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _routines)
+#define ROUTINE_HANDLER_NAME(builtin_underscored_id, name) \
+  PASTE (PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _handler_), name)
+#define ROUTINE_INDEX_NAME(name) \
+  PASTE (name, _ROUTINE_INDEX)
+#define ROUTINE_INDEX_TYPE_NAME(builtin_underscored_id) \
+  PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _routine_index_t)
 
 #define ROUTINE_ARG(n) , ecma_value_t arg ## n
 #define ROUTINE_ARG_LIST_0 ecma_value_t this_arg
@@ -53,6 +59,16 @@
 #undef ROUTINE_ARG_LIST_0
 #undef ROUTINE_ARG
 
+/**
+ * Indices of the built-in's routines in the routines table
+ */
+typedef enum
+{
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) ROUTINE_INDEX_NAME (name),
+#include BUILTIN_INC_HEADER_NAME
+  ROUTINE_INDEX__COUNT /**< number of the built-in's routines */
+} ROUTINE_INDEX_TYPE_NAME (BUILTIN_UNDERSCORED_ID);
+
 #define ECMA_BUILTIN_PROPERTY_NAMES \
   PASTE (PASTE (ecma_builtin_property_names, _), BUILTIN_UNDERSCORED_ID)
 
@@ -178,9 +194,9 @@ TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (ecma_object_t
 
 #define ROUTINE(name, c_function_name, args_number, length_prop_value) case name: \
     { \
-      ecma_object_t *func_obj_p = ecma_builtin_make_function_object_for_routine (builtin_object_id, \
-                                                                                 id, \
-                                                                                 length_prop_value); \
+      ecma_object_t *func_obj_p; \
+      func_obj_p = ecma_builtin_make_function_object_for_routine (builtin_object_id, \
+                                                                  ROUTINE_INDEX_NAME (name)); \
       \
       writable = ECMA_PROPERTY_WRITABLE; \
       enumerable = ECMA_PROPERTY_NOT_ENUMERABLE; \
@@ -391,29 +407,6 @@ LIST_LAZY_PROPERTY_NAMES_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (ecma_object_t *o
 } /* LIST_LAZY_PROPERTY_NAMES_ROUTINE_NAME */
 
 
-/**
- * Dispatcher of the built-in's routines
- *
- * @return completion-value
- *         Returned value must be freed with ecma_free_completion_value.
- */
-ecma_completion_value_t
-DISPATCH_ROUTINE_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (uint16_t builtin_routine_id, /**< built-in wide routine
-                                                                                          identifier */
-                                                        ecma_value_t this_arg_value, /**< 'this' argument
-                                                                                          value */
-                                                        const ecma_value_t arguments_list[], /**< list of arguments
-                                                                                                   passed to routine */
-                                                        ecma_length_t arguments_number) /**< length of
-                                                                                             arguments' list */
-{
-  /* the arguments may be unused for some built-ins */
-  (void) this_arg_value;
-  (void) arguments_list;
-  (void) arguments_number;
-
-  switch (builtin_routine_id)
-  {
 #define ROUTINE_ARG(n) (arguments_number >= n ? arguments_list[n - 1] \
                                               : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED))
 #define ROUTINE_ARG_LIST_0
@@ -422,10 +415,16 @@ DISPATCH_ROUTINE_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (uint16_t builtin_routine
 #define ROUTINE_ARG_LIST_3 ROUTINE_ARG_LIST_2, ROUTINE_ARG(3)
 #define ROUTINE_ARG_LIST_NON_FIXED , arguments_list, arguments_number
 #define ROUTINE(name, c_function_name, args_number, length_prop_value) \
-       case name: \
-       { \
-         return c_function_name (this_arg_value ROUTINE_ARG_LIST_ ## args_number); \
-       }
+static ecma_completion_value_t \
+ROUTINE_HANDLER_NAME (BUILTIN_UNDERSCORED_ID, name) (ecma_value_t this_arg_value, \
+                                                    const ecma_value_t arguments_list[], \
+                                                    ecma_length_t arguments_number) \
+{ \
+  (void) arguments_list; \
+  (void) arguments_number; \
+  \
+  return c_function_name (this_arg_value ROUTINE_ARG_LIST_ ## args_number); \
+}
 #include BUILTIN_INC_HEADER_NAME
 #undef ROUTINE_ARG
 #undef ROUTINE_ARG_LIST_0
@@ -434,18 +433,30 @@ DISPATCH_ROUTINE_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (uint16_t builtin_routine
 #undef ROUTINE_ARG_LIST_3
 #undef ROUTINE_ARG_LIST_NON_FIXED
 
-    default:
-    {
-      JERRY_UNREACHABLE ();
-    }
-  }
-} /* DISPATCH_ROUTINE_ROUTINE_NAME */
+/**
+ * Table of the built-in's routines, indexed by routine index
+ * (see also: ecma_builtin_dispatch_call)
+ *
+ * Note:
+ *      the last element of the table is a terminator, so that the table
+ *      is not empty for built-ins without routines
+ */
+const ecma_builtin_routine_desc_t ROUTINES_TABLE_NAME (BUILTIN_UNDERSCORED_ID)[ROUTINE_INDEX__COUNT + 1] =
+{
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) \
+  { ROUTINE_HANDLER_NAME (BUILTIN_UNDERSCORED_ID, name), length_prop_value },
+#include BUILTIN_INC_HEADER_NAME
+  { NULL, 0 }
+};
 
 #undef PASTE__
 #undef PASTE_
 #undef PASTE
 #undef SORT_PROPERTY_NAMES_ROUTINE_NAME
-#undef DISPATCH_ROUTINE_ROUTINE_NAME
+#undef ROUTINES_TABLE_NAME
+#undef ROUTINE_HANDLER_NAME
+#undef ROUTINE_INDEX_NAME
+#undef ROUTINE_INDEX_TYPE_NAME
 #undef TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME
 #undef BUILTIN_UNDERSCORED_ID
 #undef BUILTIN_INC_HEADER_NAME
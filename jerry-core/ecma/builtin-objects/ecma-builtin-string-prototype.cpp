@@ -759,7 +759,7 @@ ecma_builtin_string_prototype_object_replace_match (ecma_builtin_replace_search_
     ecma_string_t *input_string_p = ecma_get_string_from_value (context_p->input_string);
 
     ecma_length_t index_of;
-    if (ecma_builtin_helper_string_find_index (input_string_p, search_string_p, true, 0, &index_of))
+    if (ecma_string_find (input_string_p, search_string_p, true, 0, &index_of))
     {
       ecma_value_t arguments_list_p[1] = { context_p->regexp_or_search_string };
       ECMA_TRY_CATCH (new_array_value,
@@ -844,10 +844,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
       arguments_list[match_length + 1] = ecma_copy_value (context_p->input_string, true);
 
       ECMA_TRY_CATCH (result_value,
-                      ecma_op_function_call_array_args (context_p->replace_function_p,
-                                                        ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
-                                                        arguments_list,
-                                                        match_length + 2),
+                      ecma_op_function_call (context_p->replace_function_p,
+                                             ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
+                                             arguments_list,
+                                             match_length + 2),
                       ret_value);
 
       ECMA_TRY_CATCH (to_string_value,
@@ -1634,6 +1634,93 @@ ecma_builtin_helper_split_match (ecma_value_t input_string, /**< first argument
   return ret_value;
 } /* ecma_builtin_helper_split_match */
 
+/**
+ * Append a part of the split string to the result array of String.prototype.split()
+ */
+static void
+ecma_builtin_helper_split_append_part (ecma_object_t *array_p, /**< result array */
+                                       ecma_length_t index, /**< index of the part in the array */
+                                       const lit_utf8_byte_t *part_p, /**< part's utf-8 characters */
+                                       lit_utf8_size_t part_size) /**< part's size */
+{
+  ecma_string_t *part_str_p = ecma_new_ecma_string_from_utf8 (part_p, part_size);
+  ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+  ecma_completion_value_t put_comp = ecma_builtin_helper_def_prop (array_p,
+                                                                   index_str_p,
+                                                                   ecma_make_string_value (part_str_p),
+                                                                   true,
+                                                                   true,
+                                                                   true,
+                                                                   false);
+
+  JERRY_ASSERT (ecma_is_completion_value_normal_true (put_comp));
+
+  ecma_deref_ecma_string (index_str_p);
+  ecma_deref_ecma_string (part_str_p);
+} /* ecma_builtin_helper_split_append_part */
+
+/**
+ * Split the string with a non-empty string separator
+ *
+ * The routine is equivalent to steps 12-15 of String.prototype.split() for string separators.
+ * However, instead of trying SplitMatch at each position, occurrences of the separator are
+ * looked up with substring search in a single utf-8 copy of the string.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.5.4.14
+ */
+static void
+ecma_builtin_helper_split_by_string (ecma_object_t *array_p, /**< result array */
+                                     ecma_string_t *string_p, /**< string to split */
+                                     ecma_string_t *separator_p, /**< separator */
+                                     ecma_length_t limit) /**< maximum length of the result array */
+{
+  const lit_utf8_size_t string_size = ecma_string_get_size (string_p);
+  const lit_utf8_size_t separator_size = ecma_string_get_size (separator_p);
+
+  JERRY_ASSERT (string_size != 0 && separator_size != 0 && limit != 0);
+
+  MEM_DEFINE_LOCAL_ARRAY (string_utf8_p, string_size, lit_utf8_byte_t);
+  MEM_DEFINE_LOCAL_ARRAY (separator_utf8_p, separator_size, lit_utf8_byte_t);
+
+  ssize_t sz = ecma_string_to_utf8_string (string_p, string_utf8_p, (ssize_t) string_size);
+  JERRY_ASSERT (sz >= 0);
+
+  sz = ecma_string_to_utf8_string (separator_p, separator_utf8_p, (ssize_t) separator_size);
+  JERRY_ASSERT (sz >= 0);
+
+  ecma_length_t array_length = 0;
+  lit_utf8_size_t part_start_offset = 0;
+  lit_utf8_size_t separator_offset;
+
+  while (array_length < limit
+         && lit_utf8_string_find (string_utf8_p, string_size,
+                                  separator_utf8_p, separator_size,
+                                  part_start_offset,
+                                  &separator_offset))
+  {
+    ecma_builtin_helper_split_append_part (array_p,
+                                           array_length++,
+                                           string_utf8_p + part_start_offset,
+                                           separator_offset - part_start_offset);
+
+    part_start_offset = separator_offset + separator_size;
+  }
+
+  if (array_length < limit)
+  {
+    /* 14-15. */
+    ecma_builtin_helper_split_append_part (array_p,
+                                           array_length,
+                                           string_utf8_p + part_start_offset,
+                                           string_size - part_start_offset);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (separator_utf8_p);
+  MEM_FINALIZE_LOCAL_ARRAY (string_utf8_p);
+} /* ecma_builtin_helper_split_by_string */
+
 /**
  * The String.prototype object's 'split' routine
  *
@@ -1772,6 +1859,16 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_arg, /**< this arg
 
           ecma_free_completion_value (match_result);
         }
+        else if (ecma_is_completion_value_empty (ret_value)
+                 && ecma_is_value_string (separator)
+                 && ecma_string_get_length (ecma_get_string_from_value (separator)) != 0)
+        {
+          /* 12-15. */
+          ecma_builtin_helper_split_by_string (new_array_p,
+                                               ecma_get_string_from_value (this_to_string_val),
+                                               ecma_get_string_from_value (separator),
+                                               limit);
+        }
         else /* if (string_length != 0) || !ecma_is_completion_value_empty (ret_value) */
         {
           /* 4. */
@@ -34,32 +34,40 @@
 #define ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH (8)
 
 /**
- * Position of built-in routine's id field in [[Built-in routine's description]] internal property
+ * Position of built-in routine's index field in [[Built-in routine's description]] internal property
  */
 #define ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS \
   (ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_POS + \
    ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH)
 
 /**
- * Width of built-in routine's id field in [[Built-in routine's description]] internal property
+ * Width of built-in routine's index field in [[Built-in routine's description]] internal property
  */
 #define ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH (16)
 
 /**
- * Position of built-in routine's length field in [[Built-in routine's description]] internal property
+ * Handler of a built-in routine
+ *
+ * Note:
+ *      the handler normalizes the arguments list to the routine's fixed arguments number
+ *      (missing arguments are passed as undefined) and calls the routine
  */
-#define ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_POS \
-  (ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS + \
-   ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH)
+typedef ecma_completion_value_t (*ecma_builtin_routine_handler_t) (ecma_value_t this_arg_value,
+                                                                   const ecma_value_t arguments_list[],
+                                                                   ecma_length_t arguments_number);
 
 /**
- * Width of built-in routine's id field in [[Built-in routine's description]] internal property
+ * Description of a built-in routine
  */
-#define ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH (8)
+typedef struct
+{
+  ecma_builtin_routine_handler_t handler_p; /**< routine's handler */
+  uint8_t length_prop_value; /**< value of the routine's 'length' property */
+} ecma_builtin_routine_desc_t;
 
 /* ecma-builtins.c */
 extern ecma_object_t *
-ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t, uint16_t, uint8_t);
+ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t, uint16_t);
 extern int32_t
 ecma_builtin_bin_search_for_magic_string_id_in_array (const lit_magic_string_id_t[],
                                                       ecma_length_t, lit_magic_string_id_t);
@@ -76,11 +84,8 @@ ecma_builtin_ ## lowercase_name ## _dispatch_call (const ecma_value_t *, \
 extern ecma_completion_value_t \
 ecma_builtin_ ## lowercase_name ## _dispatch_construct (const ecma_value_t *, \
                                                         ecma_length_t); \
-extern ecma_completion_value_t \
-ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_id, \
-                                                      ecma_value_t this_arg_value, \
-                                                      const ecma_value_t [], \
-                                                      ecma_length_t); \
+extern const ecma_builtin_routine_desc_t \
+ecma_builtin_ ## lowercase_name ## _routines[]; \
 extern ecma_property_t * \
 ecma_builtin_ ## lowercase_name ## _try_to_instantiate_property (ecma_object_t *, \
                                                                  ecma_string_t *); \
@@ -31,19 +31,29 @@
  * @{
  */
 
-static ecma_completion_value_t
-ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id,
-                               uint16_t builtin_routine_id,
-                               ecma_value_t this_arg_value,
-                               const ecma_value_t arguments_list[],
-                               ecma_length_t arguments_number);
 static void ecma_instantiate_builtin (ecma_builtin_id_t id);
+static const ecma_builtin_routine_desc_t *ecma_builtin_get_routine_desc (ecma_object_t *func_obj_p);
 
 /**
  * Pointer to instances of built-in objects
  */
 static ecma_object_t* ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
 
+/**
+ * Routines tables of built-in objects
+ */
+static const ecma_builtin_routine_desc_t * const ecma_builtin_routines[ECMA_BUILTIN_ID__COUNT] =
+{
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                is_static, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _routines,
+#include "ecma-builtins.inc.h"
+};
+
 /**
  * Check if passed object is the instance of specified built-in.
  */
@@ -202,6 +212,15 @@ ecma_init_builtins (void)
   }
 } /* ecma_init_builtins */
 
+/**
+ * Add memory region, containing pointers to instantiated built-in objects, to list of heap image's regions
+ */
+void
+ecma_builtins_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_image_regions_add (regions_p, ecma_builtin_objects, sizeof (ecma_builtin_objects));
+} /* ecma_builtins_get_image_regions */
+
 /**
  * Instantiate specified ECMA built-in object
  */
@@ -311,14 +330,7 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
        *      as it is non-configurable and so can't be deleted
        */
 
-      ecma_property_t *desc_prop_p = ecma_get_internal_property (object_p,
-                                                               ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC);
-      uint64_t builtin_routine_desc = desc_prop_p->u.internal_property.value;
-
-      JERRY_STATIC_ASSERT (sizeof (uint8_t) * JERRY_BITSINBYTE == ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH);
-      uint8_t length_prop_value = (uint8_t) jrt_extract_bit_field (builtin_routine_desc,
-                                                                   ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_POS,
-                                                                   ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH);
+      uint8_t length_prop_value = ecma_builtin_get_routine_desc (object_p)->length_prop_value;
 
       ecma_property_t *len_prop_p = ecma_create_named_data_property (object_p,
                                                                      string_p,
@@ -466,10 +478,8 @@ ecma_object_t*
 ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t builtin_id, /**< identifier of built-in object
                                                                                   that initially contains property
                                                                                   with the routine */
-                                               uint16_t routine_id, /**< builtin-wide identifier of the built-in
-                                                                         object's routine property */
-                                               uint8_t length_prop_value) /**< value of 'length' property
-                                                                               of function object to create */
+                                               uint16_t routine_index) /**< index of the routine in the built-in
+                                                                            *   object's routines table */
 {
   ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE);
 
@@ -484,13 +494,9 @@ ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t builtin_id, /**
                                                    ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_POS,
                                                    ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH);
   packed_value = jrt_set_bit_field_value (packed_value,
-                                          routine_id,
+                                          routine_index,
                                           ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS,
                                           ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH);
-  packed_value = jrt_set_bit_field_value (packed_value,
-                                          length_prop_value,
-                                          ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_POS,
-                                          ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH);
 
   ecma_property_t *routine_desc_prop_p = ecma_create_internal_property (func_obj_p,
                                                                         ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC);
@@ -509,50 +515,18 @@ ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t builtin_id, /**
 ecma_completion_value_t
 ecma_builtin_dispatch_call (ecma_object_t *obj_p, /**< built-in object */
                             ecma_value_t this_arg_value, /**< 'this' argument value */
-                            ecma_collection_header_t* arg_collection_p) /**< arguments collection */
+                            const ecma_value_t *arguments_list_p, /**< arguments list */
+                            ecma_length_t arguments_list_len) /**< length of arguments list */
 {
   JERRY_ASSERT (ecma_get_object_is_builtin (obj_p));
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  const ecma_length_t arguments_list_len = arg_collection_p != NULL ? arg_collection_p->unit_number : 0;
-  MEM_DEFINE_LOCAL_ARRAY (arguments_list_p, arguments_list_len, ecma_value_t);
-
-  ecma_collection_iterator_t arg_collection_iter;
-  ecma_collection_iterator_init (&arg_collection_iter,
-                                 arg_collection_p);
-
-  for (ecma_length_t arg_index = 0;
-       ecma_collection_iterator_next (&arg_collection_iter);
-       arg_index++)
-  {
-    arguments_list_p[arg_index] = *arg_collection_iter.current_value_p;
-  }
-
   if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION)
   {
-    ecma_property_t *desc_prop_p = ecma_get_internal_property (obj_p,
-                                                               ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC);
-    uint64_t builtin_routine_desc = desc_prop_p->u.internal_property.value;
-
-    uint64_t built_in_id_field = jrt_extract_bit_field (builtin_routine_desc,
-                                                        ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_POS,
-                                                        ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH);
-    JERRY_ASSERT (built_in_id_field < ECMA_BUILTIN_ID__COUNT);
-
-    uint64_t routine_id_field = jrt_extract_bit_field (builtin_routine_desc,
-                                                       ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS,
-                                                       ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH);
-    JERRY_ASSERT ((uint16_t) routine_id_field == routine_id_field);
-
-    ecma_builtin_id_t built_in_id = (ecma_builtin_id_t) built_in_id_field;
-    uint16_t routine_id = (uint16_t) routine_id_field;
-
-    ret_value =  ecma_builtin_dispatch_routine (built_in_id,
-                                                routine_id,
-                                                this_arg_value,
-                                                arguments_list_p,
-                                                arguments_list_len);
+    const ecma_builtin_routine_desc_t *routine_desc_p = ecma_builtin_get_routine_desc (obj_p);
+
+    ret_value = routine_desc_p->handler_p (this_arg_value, arguments_list_p, arguments_list_len);
   }
   else
   {
@@ -599,8 +573,6 @@ ecma_builtin_dispatch_call (ecma_object_t *obj_p, /**< built-in object */
     }
   }
 
-  MEM_FINALIZE_LOCAL_ARRAY (arguments_list_p);
-
   JERRY_ASSERT (!ecma_is_completion_value_empty (ret_value));
 
   return ret_value;
@@ -613,27 +585,14 @@ ecma_builtin_dispatch_call (ecma_object_t *obj_p, /**< built-in object */
  */
 ecma_completion_value_t
 ecma_builtin_dispatch_construct (ecma_object_t *obj_p, /**< built-in object */
-                                 ecma_collection_header_t* arg_collection_p) /**< arguments collection */
+                                 const ecma_value_t *arguments_list_p, /**< arguments list */
+                                 ecma_length_t arguments_list_len) /**< length of arguments list */
 {
   JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_FUNCTION);
   JERRY_ASSERT (ecma_get_object_is_builtin (obj_p));
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  const ecma_length_t arguments_list_len = arg_collection_p != NULL ? arg_collection_p->unit_number : 0;
-  MEM_DEFINE_LOCAL_ARRAY (arguments_list_p, arguments_list_len, ecma_value_t);
-
-  ecma_collection_iterator_t arg_collection_iter;
-  ecma_collection_iterator_init (&arg_collection_iter,
-                                 arg_collection_p);
-
-  for (ecma_length_t arg_index = 0;
-       ecma_collection_iterator_next (&arg_collection_iter);
-       arg_index++)
-  {
-    arguments_list_p[arg_index] = *arg_collection_iter.current_value_p;
-  }
-
   ecma_property_t *built_in_id_prop_p = ecma_get_internal_property (obj_p,
                                                                     ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
   ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) built_in_id_prop_p->u.internal_property.value;
@@ -675,62 +634,40 @@ ecma_builtin_dispatch_construct (ecma_object_t *obj_p, /**< built-in object */
     }
   }
 
-  MEM_FINALIZE_LOCAL_ARRAY (arguments_list_p);
-
   JERRY_ASSERT (!ecma_is_completion_value_empty (ret_value));
 
   return ret_value;
 } /* ecma_builtin_dispatch_construct */
 
 /**
- * Dispatcher of built-in routines
+ * Get description of built-in routine, corresponding to specified built-in function object
  *
- * @return completion-value
- *         Returned value must be freed with ecma_free_completion_value.
+ * @return pointer to the routine's description in the routines table of the built-in object,
+ *         that initially contains property with the routine
  */
-static ecma_completion_value_t
-ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id, /**< built-in object' identifier */
-                               uint16_t builtin_routine_id, /**< builtin-wide identifier
-                                                             *   of the built-in object's
-                                                             *   routine property */
-                               ecma_value_t this_arg_value, /**< 'this' argument value */
-                               const ecma_value_t arguments_list[], /**< list of arguments passed to routine */
-                               ecma_length_t arguments_number) /**< length of arguments' list */
+static const ecma_builtin_routine_desc_t *
+ecma_builtin_get_routine_desc (ecma_object_t *func_obj_p) /**< built-in routine's function object */
 {
-  switch (builtin_object_id)
-  {
-#define BUILTIN(builtin_id, \
-                object_type, \
-                object_prototype_builtin_id, \
-                is_extensible, \
-                is_static, \
-                lowercase_name) \
-    case builtin_id: \
-      { \
-        return ecma_builtin_ ## lowercase_name ## _dispatch_routine (builtin_routine_id, \
-                                                                     this_arg_value, \
-                                                                     arguments_list, \
-                                                                     arguments_number); \
-      }
-#include "ecma-builtins.inc.h"
+  JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION);
 
-    case ECMA_BUILTIN_ID__COUNT:
-    {
-      JERRY_UNREACHABLE ();
-    }
+  ecma_property_t *desc_prop_p = ecma_get_internal_property (func_obj_p,
+                                                             ECMA_INTERNAL_PROPERTY_BUILT_IN_ROUTINE_DESC);
+  uint64_t builtin_routine_desc = desc_prop_p->u.internal_property.value;
 
-    default:
-    {
-#ifdef CONFIG_ECMA_COMPACT_PROFILE
-      JERRY_UNREACHABLE ();
-#else /* CONFIG_ECMA_COMPACT_PROFILE */
-      JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
-#endif /* !CONFIG_ECMA_COMPACT_PROFILE */
-    }
-  }
+  uint64_t built_in_id_field = jrt_extract_bit_field (builtin_routine_desc,
+                                                      ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_POS,
+                                                      ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_OBJECT_ID_WIDTH);
+  JERRY_ASSERT (built_in_id_field < ECMA_BUILTIN_ID__COUNT);
+
+  uint64_t routine_index_field = jrt_extract_bit_field (builtin_routine_desc,
+                                                        ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_POS,
+                                                        ECMA_BUILTIN_ROUTINE_ID_BUILT_IN_ROUTINE_ID_WIDTH);
+
+  const ecma_builtin_routine_desc_t *routine_desc_p = &ecma_builtin_routines[built_in_id_field][routine_index_field];
+  JERRY_ASSERT (routine_desc_p->handler_p != NULL);
 
-  JERRY_UNREACHABLE ();
-} /* ecma_builtin_dispatch_routine */
+  return routine_desc_p;
+} /* ecma_builtin_get_routine_desc */
 
 /**
  * Binary search for magic string identifier in array.
@@ -37,11 +37,12 @@ typedef enum
 /* ecma-builtins.c */
 extern void ecma_init_builtins (void);
 extern void ecma_finalize_builtins (void);
+extern void ecma_builtins_get_image_regions (mem_image_regions_t *);
 
 extern ecma_completion_value_t
-ecma_builtin_dispatch_call (ecma_object_t *, ecma_value_t, ecma_collection_header_t *);
+ecma_builtin_dispatch_call (ecma_object_t *, ecma_value_t, const ecma_value_t *, ecma_length_t);
 extern ecma_completion_value_t
-ecma_builtin_dispatch_construct (ecma_object_t *, ecma_collection_header_t *);
+ecma_builtin_dispatch_construct (ecma_object_t *, const ecma_value_t *, ecma_length_t);
 extern ecma_property_t *
 ecma_builtin_try_to_instantiate_property (ecma_object_t *, ecma_string_t *);
 extern void
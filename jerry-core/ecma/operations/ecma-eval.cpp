@@ -67,9 +67,317 @@ ecma_op_eval (ecma_string_t *code_p, /**< code string */
   return ret_value;
 } /* ecma_op_eval */
 
+/**
+ * Entry of the compiled eval code cache
+ *
+ * Note:
+ *      the entry's header is followed by copy of the eval code's source
+ */
+typedef struct ecma_eval_cache_entry_t
+{
+  struct ecma_eval_cache_entry_t *prev_p; /**< previous (more recently used) entry */
+  struct ecma_eval_cache_entry_t *next_p; /**< next (less recently used) entry */
+  const bytecode_data_header_t *bytecode_data_p; /**< byte-code of the eval code */
+  size_t source_size; /**< size of the source */
+  size_t entry_size; /**< memory, accounted for the entry (see also: ecma_eval_cache_get_entry_size) */
+  uint32_t source_hash; /**< hash of the source */
+  uint16_t running_count; /**< number of currently running instances of the byte-code */
+  bool is_strict; /**< is the code parsed as strict mode code */
+  bool is_code_contains_functions; /**< are there functions, declared in the code */
+} ecma_eval_cache_entry_t;
+
+/**
+ * Most recently used entry of the compiled eval code cache
+ */
+static ecma_eval_cache_entry_t *ecma_eval_cache_first_p = NULL;
+
+/**
+ * Least recently used entry of the compiled eval code cache
+ */
+static ecma_eval_cache_entry_t *ecma_eval_cache_last_p = NULL;
+
+/**
+ * Maximum size of memory, that can be accounted for the eval code cache's entries
+ */
+static size_t ecma_eval_cache_size_limit = CONFIG_ECMA_EVAL_CACHE_SIZE_LIMIT;
+
+/**
+ * Statistics of the compiled eval code cache
+ */
+static jerry_api_eval_cache_stats_t ecma_eval_cache_stats;
+
+/**
+ * Calculate hash of eval code's source (FNV-1a)
+ *
+ * @return 32-bit hash value
+ */
+static uint32_t
+ecma_eval_cache_calc_hash (const jerry_api_char_t *code_p, /**< code characters buffer */
+                           size_t code_buffer_size) /**< size of the buffer */
+{
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < code_buffer_size; i++)
+  {
+    hash = (hash ^ code_p[i]) * 16777619u;
+  }
+
+  return hash;
+} /* ecma_eval_cache_calc_hash */
+
+/**
+ * Get size of memory, accounted for an entry of the eval code cache
+ *
+ * Note:
+ *      the size includes the entry itself, copy of the source and the byte-code's instructions array
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_eval_cache_get_entry_size (size_t source_size, /**< size of the source */
+                                const bytecode_data_header_t *bytecode_data_p) /**< byte-code */
+{
+  return (sizeof (ecma_eval_cache_entry_t)
+          + source_size
+          + sizeof (bytecode_data_header_t)
+          + sizeof (vm_instr_t) * bytecode_data_p->instrs_count);
+} /* ecma_eval_cache_get_entry_size */
+
+/**
+ * Exclude the entry from the list of the eval code cache's entries
+ */
+static void
+ecma_eval_cache_unlink (ecma_eval_cache_entry_t *entry_p) /**< cache entry */
+{
+  if (entry_p->prev_p != NULL)
+  {
+    entry_p->prev_p->next_p = entry_p->next_p;
+  }
+  else
+  {
+    ecma_eval_cache_first_p = entry_p->next_p;
+  }
+
+  if (entry_p->next_p != NULL)
+  {
+    entry_p->next_p->prev_p = entry_p->prev_p;
+  }
+  else
+  {
+    ecma_eval_cache_last_p = entry_p->prev_p;
+  }
+
+  entry_p->prev_p = NULL;
+  entry_p->next_p = NULL;
+} /* ecma_eval_cache_unlink */
+
+/**
+ * Insert the entry at head of the list of the eval code cache's entries (i.e. as most recently used)
+ */
+static void
+ecma_eval_cache_link_first (ecma_eval_cache_entry_t *entry_p) /**< cache entry */
+{
+  entry_p->prev_p = NULL;
+  entry_p->next_p = ecma_eval_cache_first_p;
+
+  if (ecma_eval_cache_first_p != NULL)
+  {
+    ecma_eval_cache_first_p->prev_p = entry_p;
+  }
+  else
+  {
+    ecma_eval_cache_last_p = entry_p;
+  }
+
+  ecma_eval_cache_first_p = entry_p;
+} /* ecma_eval_cache_link_first */
+
+/**
+ * Remove the entry from the eval code cache and free it, together with its byte-code
+ *
+ * Note:
+ *      byte-code of code, declaring functions, is referenced by the functions, and so is not freed
+ */
+static void
+ecma_eval_cache_evict (ecma_eval_cache_entry_t *entry_p) /**< cache entry */
+{
+  JERRY_ASSERT (entry_p->running_count == 0);
+  JERRY_ASSERT (ecma_eval_cache_stats.size >= entry_p->entry_size);
+
+  ecma_eval_cache_unlink (entry_p);
+
+  ecma_eval_cache_stats.size -= entry_p->entry_size;
+  ecma_eval_cache_stats.entries_count--;
+  ecma_eval_cache_stats.evictions++;
+
+  if (!entry_p->is_code_contains_functions)
+  {
+    serializer_remove_bytecode_data (entry_p->bytecode_data_p);
+  }
+
+  mem_heap_free_block (entry_p);
+} /* ecma_eval_cache_evict */
+
+/**
+ * Evict least recently used entries of the eval code cache, that are not currently running,
+ * until size of the cache is not greater than the specified size
+ *
+ * @return true - if the cache's size was decreased to the specified size,
+ *         false - otherwise (i.e. the remaining entries are running).
+ */
+static bool
+ecma_eval_cache_shrink (size_t size) /**< required size of the cache */
+{
+  ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_last_p;
+
+  while (ecma_eval_cache_stats.size > size
+         && entry_p != NULL)
+  {
+    ecma_eval_cache_entry_t *prev_entry_p = entry_p->prev_p;
+
+    if (entry_p->running_count == 0)
+    {
+      ecma_eval_cache_evict (entry_p);
+    }
+
+    entry_p = prev_entry_p;
+  }
+
+  return (ecma_eval_cache_stats.size <= size);
+} /* ecma_eval_cache_shrink */
+
+/**
+ * Initialize the compiled eval code cache
+ */
+void
+ecma_eval_cache_init (void)
+{
+  JERRY_ASSERT (ecma_eval_cache_first_p == NULL && ecma_eval_cache_last_p == NULL);
+
+  memset (&ecma_eval_cache_stats, 0, sizeof (ecma_eval_cache_stats));
+  ecma_eval_cache_size_limit = CONFIG_ECMA_EVAL_CACHE_SIZE_LIMIT;
+} /* ecma_eval_cache_init */
+
+/**
+ * Evict all entries of the compiled eval code cache, that are not currently running
+ */
+void
+ecma_eval_cache_invalidate_all (void)
+{
+  ecma_eval_cache_shrink (0);
+} /* ecma_eval_cache_invalidate_all */
+
+/**
+ * Set maximum size of memory, that can be occupied by the compiled eval code cache
+ *
+ * Note:
+ *      zero size limit disables the cache
+ */
+void
+ecma_eval_cache_set_size_limit (size_t size_limit) /**< size limit, in bytes */
+{
+  ecma_eval_cache_size_limit = size_limit;
+
+  ecma_eval_cache_shrink (size_limit);
+} /* ecma_eval_cache_set_size_limit */
+
+/**
+ * Get statistics of the compiled eval code cache
+ */
+void
+ecma_eval_cache_get_stats (jerry_api_eval_cache_stats_t *out_stats_p) /**< out: statistics */
+{
+  *out_stats_p = ecma_eval_cache_stats;
+  out_stats_p->size_limit = ecma_eval_cache_size_limit;
+} /* ecma_eval_cache_get_stats */
+
+/**
+ * Find byte-code of the eval code in the compiled eval code cache
+ *
+ * Note:
+ *      the found entry becomes the most recently used one
+ *
+ * @return pointer to the cache entry - if the code was found,
+ *         NULL - otherwise.
+ */
+static ecma_eval_cache_entry_t *
+ecma_eval_cache_lookup (const jerry_api_char_t *code_p, /**< code characters buffer */
+                        size_t code_buffer_size, /**< size of the buffer */
+                        uint32_t hash, /**< hash of the code */
+                        bool is_strict) /**< is the code to be parsed as strict mode code */
+{
+  for (ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_first_p;
+       entry_p != NULL;
+       entry_p = entry_p->next_p)
+  {
+    if (entry_p->source_hash == hash
+        && entry_p->is_strict == is_strict
+        && entry_p->source_size == code_buffer_size
+        && memcmp (entry_p + 1, code_p, code_buffer_size) == 0)
+    {
+      if (entry_p != ecma_eval_cache_first_p)
+      {
+        ecma_eval_cache_unlink (entry_p);
+        ecma_eval_cache_link_first (entry_p);
+      }
+
+      return entry_p;
+    }
+  }
+
+  return NULL;
+} /* ecma_eval_cache_lookup */
+
+/**
+ * Put byte-code of the eval code to the compiled eval code cache
+ *
+ * @return pointer to the new cache entry - if the byte-code was put to the cache,
+ *         NULL - otherwise (the byte-code doesn't fit into the cache's size limit).
+ */
+static ecma_eval_cache_entry_t *
+ecma_eval_cache_insert (const jerry_api_char_t *code_p, /**< code characters buffer */
+                        size_t code_buffer_size, /**< size of the buffer */
+                        uint32_t hash, /**< hash of the code */
+                        bool is_strict, /**< is the code parsed as strict mode code */
+                        const bytecode_data_header_t *bytecode_data_p, /**< byte-code of the code */
+                        bool is_code_contains_functions) /**< are there functions, declared in the code */
+{
+  const size_t entry_size = ecma_eval_cache_get_entry_size (code_buffer_size, bytecode_data_p);
+
+  if (entry_size > ecma_eval_cache_size_limit
+      || !ecma_eval_cache_shrink (ecma_eval_cache_size_limit - entry_size))
+  {
+    return NULL;
+  }
+
+  ecma_eval_cache_entry_t *entry_p;
+  entry_p = (ecma_eval_cache_entry_t *) mem_heap_alloc_block (sizeof (ecma_eval_cache_entry_t) + code_buffer_size,
+                                                               MEM_HEAP_ALLOC_LONG_TERM);
+
+  entry_p->bytecode_data_p = bytecode_data_p;
+  entry_p->source_size = code_buffer_size;
+  entry_p->entry_size = entry_size;
+  entry_p->source_hash = hash;
+  entry_p->running_count = 0;
+  entry_p->is_strict = is_strict;
+  entry_p->is_code_contains_functions = is_code_contains_functions;
+  memcpy (entry_p + 1, code_p, code_buffer_size);
+
+  ecma_eval_cache_link_first (entry_p);
+
+  ecma_eval_cache_stats.size += entry_size;
+  ecma_eval_cache_stats.entries_count++;
+
+  return entry_p;
+} /* ecma_eval_cache_insert */
+
 /**
  * Perform 'eval' with code stored in continuous character buffer
  *
+ * Note:
+ *      byte-code of the code is looked up in, and put to, the compiled eval code cache,
+ *      so repeatedly evaluated source is parsed only once while it remains in the cache
+ *
  * See also:
  *          ecma_op_eval
  *          ECMA-262 v5, 15.1.2.1 (steps 2 to 8)
@@ -92,11 +400,40 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p, /**< code characters
   bool is_strict_call = (is_direct && is_called_from_strict_mode_code);
 
   bool code_contains_functions;
-  parse_status = parser_parse_eval (code_p,
-                                    code_buffer_size,
-                                    is_strict_call,
-                                    &bytecode_data_p,
-                                    &code_contains_functions);
+
+  /* byte-code of eval code depends only on the source and strictness, eval kind is only taken into account
+   * upon execution (see also: vm_run_eval) */
+  const uint32_t hash = ecma_eval_cache_calc_hash (code_p, code_buffer_size);
+  ecma_eval_cache_entry_t *cache_entry_p = ecma_eval_cache_lookup (code_p, code_buffer_size, hash, is_strict_call);
+
+  if (cache_entry_p != NULL)
+  {
+    ecma_eval_cache_stats.hits++;
+
+    bytecode_data_p = cache_entry_p->bytecode_data_p;
+    code_contains_functions = cache_entry_p->is_code_contains_functions;
+    parse_status = JSP_STATUS_OK;
+  }
+  else
+  {
+    ecma_eval_cache_stats.misses++;
+
+    parse_status = parser_parse_eval (code_p,
+                                      code_buffer_size,
+                                      is_strict_call,
+                                      &bytecode_data_p,
+                                      &code_contains_functions);
+
+    if (parse_status == JSP_STATUS_OK)
+    {
+      cache_entry_p = ecma_eval_cache_insert (code_p,
+                                              code_buffer_size,
+                                              hash,
+                                              is_strict_call,
+                                              bytecode_data_p,
+                                              code_contains_functions);
+    }
+  }
 
   if (parse_status == JSP_STATUS_SYNTAX_ERROR)
   {
@@ -110,14 +447,34 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p, /**< code characters
   {
     JERRY_ASSERT (parse_status == JSP_STATUS_OK);
 
-    completion = vm_run_eval (bytecode_data_p, is_direct);
+    if (cache_entry_p != NULL)
+    {
+      /* running entry is not evicted, even if the code evaluates other code */
+      JERRY_ASSERT (cache_entry_p->running_count < UINT16_MAX);
+      cache_entry_p->running_count++;
 
-    if (!code_contains_functions)
+      completion = vm_run_eval (bytecode_data_p, is_direct);
+
+      cache_entry_p->running_count--;
+    }
+    else
     {
-      serializer_remove_bytecode_data (bytecode_data_p);
+      completion = vm_run_eval (bytecode_data_p, is_direct);
+
+      if (!code_contains_functions)
+      {
+        serializer_remove_bytecode_data (bytecode_data_p);
+      }
     }
   }
 
+  /* literals of the eval code are not needed anymore, unless they are used by functions, declared in the code,
+   * by strings, created during the code's execution, or by byte-code in the compiled eval code cache */
+  if (lit_is_gc_recommended ())
+  {
+    serializer_free_unused_literals ();
+  }
+
   return completion;
 } /* ecma_op_eval_chars_buffer */
 
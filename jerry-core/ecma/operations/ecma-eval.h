@@ -30,6 +30,11 @@ ecma_op_eval (ecma_string_t *, bool, bool);
 extern ecma_completion_value_t
 ecma_op_eval_chars_buffer (const jerry_api_char_t *, size_t, bool, bool);
 
+extern void ecma_eval_cache_init (void);
+extern void ecma_eval_cache_invalidate_all (void);
+extern void ecma_eval_cache_set_size_limit (size_t);
+extern void ecma_eval_cache_get_stats (jerry_api_eval_cache_stats_t *);
+
 /**
  * @}
  * @}
@@ -25,6 +25,9 @@
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
+#include "lit-char-helpers.h"
+#include "parser.h"
+#include "serializer.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -49,6 +52,7 @@ ecma_pack_code_internal_property_value (bool is_strict, /**< is code strict? */
                                         bool is_arguments_moved_to_regs, /**< values of the function's arguments
                                                                           *   are placed on registers */
                                         bool is_no_lex_env, /**< the function needs no lexical environment */
+                                        bool is_lazy, /**< the function's code is not compiled yet */
                                         vm_instr_counter_t instr_oc) /**< position of first instruction */
 {
   uint32_t value = instr_oc;
@@ -56,11 +60,13 @@ ecma_pack_code_internal_property_value (bool is_strict, /**< is code strict? */
   const uint32_t do_instantiate_arguments_object_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 2);
   const uint32_t arguments_moved_to_regs_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 3);
   const uint32_t no_lex_env_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 4);
+  const uint32_t is_lazy_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 5);
 
   JERRY_ASSERT (((value) & (1u << is_strict_bit_offset)) == 0);
   JERRY_ASSERT (((value) & (1u << do_instantiate_arguments_object_bit_offset)) == 0);
   JERRY_ASSERT (((value) & (1u << arguments_moved_to_regs_bit_offset)) == 0);
   JERRY_ASSERT (((value) & (1u << no_lex_env_bit_offset)) == 0);
+  JERRY_ASSERT (((value) & (1u << is_lazy_bit_offset)) == 0);
 
   if (is_strict)
   {
@@ -82,6 +88,11 @@ ecma_pack_code_internal_property_value (bool is_strict, /**< is code strict? */
     value |= (1u << no_lex_env_bit_offset);
   }
 
+  if (is_lazy)
+  {
+    value |= (1u << is_lazy_bit_offset);
+  }
+
   return value;
 } /* ecma_pack_code_internal_property_value */
 
@@ -99,26 +110,32 @@ ecma_unpack_code_internal_property_value (uint32_t value, /**< packed value */
                                           bool* out_is_arguments_moved_to_regs_p, /**< values of the function's
                                                                                    *   arguments are placed
                                                                                    *   on registers */
-                                          bool* out_is_no_lex_env_p) /**< the function needs no lexical environment */
+                                          bool* out_is_no_lex_env_p, /**< the function needs
+                                                                      *   no lexical environment */
+                                          bool* out_is_lazy_p) /**< the function's code is not compiled yet */
 {
   JERRY_ASSERT (out_is_strict_p != NULL);
   JERRY_ASSERT (out_do_instantiate_args_obj_p != NULL);
   JERRY_ASSERT (out_is_arguments_moved_to_regs_p != NULL);
   JERRY_ASSERT (out_is_no_lex_env_p != NULL);
+  JERRY_ASSERT (out_is_lazy_p != NULL);
 
   const uint32_t is_strict_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 1);
   const uint32_t do_instantiate_arguments_object_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 2);
   const uint32_t is_arguments_moved_to_regs_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 3);
   const uint32_t is_no_lex_env_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 4);
+  const uint32_t is_lazy_bit_offset = (uint32_t) (sizeof (value) * JERRY_BITSINBYTE - 5);
 
   *out_is_strict_p = ((value & (1u << is_strict_bit_offset)) != 0);
   *out_do_instantiate_args_obj_p = ((value & (1u << do_instantiate_arguments_object_bit_offset)) != 0);
   *out_is_arguments_moved_to_regs_p = ((value & (1u << is_arguments_moved_to_regs_bit_offset)) != 0);
   *out_is_no_lex_env_p = ((value & (1u << is_no_lex_env_bit_offset)) != 0);
+  *out_is_lazy_p = ((value & (1u << is_lazy_bit_offset)) != 0);
   value &= ~((1u << is_strict_bit_offset)
              | (1u << do_instantiate_arguments_object_bit_offset)
              | (1u << is_arguments_moved_to_regs_bit_offset)
-             | (1u << is_no_lex_env_bit_offset));
+             | (1u << is_no_lex_env_bit_offset)
+             | (1u << is_lazy_bit_offset));
 
   return (vm_instr_counter_t) value;
 } /* ecma_unpack_code_internal_property_value */
@@ -175,79 +192,211 @@ ecma_is_constructor (ecma_value_t value) /**< ecma-value */
 } /* ecma_is_constructor */
 
 /**
- * Helper function to merge argument lists
+ * Get list of bound arguments of a bound function
+ *
+ * @return array of bound arguments - if the function has bound arguments,
+ *         NULL - otherwise
+ */
+static ecma_values_array_header_t *
+ecma_function_bind_get_bound_args (ecma_object_t *func_obj_p) /**< bound function object */
+{
+  JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_BOUND_FUNCTION);
+
+  ecma_property_t *bound_args_prop_p;
+  bound_args_prop_p = ecma_find_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS);
+
+  if (bound_args_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_values_array_header_t,
+                                    bound_args_prop_p->u.internal_property.value);
+} /* ecma_function_bind_get_bound_args */
+
+/**
+ * Call or construct target function of a bound function with arguments list,
+ * consisting of the bound arguments, followed by the passed arguments
  *
  * See also:
- *          ECMA-262 v5, 15.3.4.5.1 step 4
- *          ECMA-262 v5, 15.3.4.5.2 step 4
+ *          ECMA-262 v5, 15.3.4.5.1 steps 4 - 5
+ *          ECMA-262 v5, 15.3.4.5.2 steps 4 - 5
  *
- * Used by:
- *         - [[Call]] implementation for Function objects.
- *         - [[Construct]] implementation for Function objects.
+ * Note:
+ *      the merged arguments list is placed on stack, if it is short enough
+ *      (see also: CONFIG_ECMA_BOUND_FUNCTION_MAX_ON_STACK_ARGS), and values
+ *      are not copied to the list, as they are referenced by the bound function
+ *      and by the caller during the call
  *
- * @return collection of arguments that should be freed
- *         using ecma_free_values_collection with do_ref_if_object flag set
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
  */
-static ecma_collection_header_t *
-ecma_function_bind_merge_arg_lists (ecma_object_t *func_obj_p, /**< Function object */
-                                    ecma_collection_header_t* passed_arg_collection_p) /**< passed arguments list */
+static ecma_completion_value_t
+ecma_function_bind_dispatch_with_bound_args (ecma_object_t *target_func_obj_p, /**< target function */
+                                             bool is_construct, /**< true - perform [[Construct]],
+                                                                 *   false - perform [[Call]] */
+                                             ecma_value_t bound_this_value, /**< bound 'this' value
+                                                                             *   (ignored for [[Construct]]) */
+                                             ecma_values_array_header_t *bound_args_p, /**< bound arguments */
+                                             const ecma_value_t *arguments_list_p, /**< passed arguments list */
+                                             ecma_length_t arguments_list_len) /**< length of passed
+                                                                                *   arguments list */
 {
-  ecma_length_t passed_args_number = passed_arg_collection_p != NULL ? passed_arg_collection_p->unit_number : 0;
+  const ecma_length_t bound_args_number = bound_args_p->unit_number;
+  const ecma_length_t merged_args_list_len = bound_args_number + arguments_list_len;
 
-  ecma_collection_header_t *merged_arg_collection_p = ecma_new_values_collection (NULL, 0, true);
+  ecma_value_t merged_args_on_stack[CONFIG_ECMA_BOUND_FUNCTION_MAX_ON_STACK_ARGS];
+  ecma_value_t *merged_args_list_p = merged_args_on_stack;
 
-  ecma_property_t *bound_args_prop_p;
-  bound_args_prop_p = ecma_find_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_ARGS);
+  if (merged_args_list_len > CONFIG_ECMA_BOUND_FUNCTION_MAX_ON_STACK_ARGS)
+  {
+    merged_args_list_p = (ecma_value_t *) mem_heap_alloc_block (merged_args_list_len * sizeof (ecma_value_t),
+                                                                MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+
+  memcpy (merged_args_list_p,
+          ecma_get_values_array_data (bound_args_p),
+          bound_args_number * sizeof (ecma_value_t));
+
+  if (arguments_list_len != 0)
+  {
+    memcpy (merged_args_list_p + bound_args_number,
+            arguments_list_p,
+            arguments_list_len * sizeof (ecma_value_t));
+  }
+
+  ecma_completion_value_t ret_value;
 
-  if (bound_args_prop_p != NULL)
+  if (is_construct)
   {
-    ecma_collection_header_t *bound_arg_list_p = ECMA_GET_POINTER (ecma_collection_header_t,
-                                                                   bound_args_prop_p->u.internal_property.value);
+    ret_value = ecma_op_function_construct (target_func_obj_p,
+                                            merged_args_list_p,
+                                            merged_args_list_len);
+  }
+  else
+  {
+    ret_value = ecma_op_function_call (target_func_obj_p,
+                                       bound_this_value,
+                                       merged_args_list_p,
+                                       merged_args_list_len);
+  }
+
+  if (merged_args_list_p != merged_args_on_stack)
+  {
+    mem_heap_free_block (merged_args_list_p);
+  }
+
+  return ret_value;
+} /* ecma_function_bind_dispatch_with_bound_args */
+
+/**
+ * Entry of function templates' cache
+ */
+typedef struct
+{
+  const bytecode_data_header_t *bytecode_header_p; /**< byte-code, containing the function literal */
+  vm_instr_counter_t first_instr_pos; /**< position of first instruction of the function's code */
+  ecma_object_t *template_p; /**< the function template (referenced by the cache entry)
+                              *   or NULL - if the entry is empty */
+} ecma_function_template_cache_entry_t;
 
-    ecma_collection_iterator_t bound_args_iterator;
-    ecma_collection_iterator_init (&bound_args_iterator, bound_arg_list_p);
+/**
+ * Cache of function templates
+ *
+ * The cache lets Function objects, created from the same function literal
+ * (for example, closures created in a loop or in each call of outer function),
+ * share single template, instead of instantiating the same formal parameters' list
+ * and code description for each of the objects.
+ */
+static ecma_function_template_cache_entry_t ecma_function_template_cache[CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE];
+
+JERRY_STATIC_ASSERT ((CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE & (CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE - 1)) == 0);
+
+/**
+ * Get entry of function templates' cache, corresponding to the function literal
+ *
+ * @return pointer to the cache entry
+ */
+static ecma_function_template_cache_entry_t *
+ecma_function_template_cache_get_entry (const bytecode_data_header_t *bytecode_header_p, /**< byte-code */
+                                        vm_instr_counter_t first_instr_pos) /**< position of first instruction
+                                                                             *   of the function's code */
+{
+  uintptr_t hash = ((uintptr_t) bytecode_header_p >> MEM_ALIGNMENT_LOG) ^ first_instr_pos;
+
+  return &ecma_function_template_cache[hash & (CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE - 1)];
+} /* ecma_function_template_cache_get_entry */
+
+/**
+ * Initialize cache of function templates
+ */
+void
+ecma_op_function_template_cache_init (void)
+{
+  for (uint32_t i = 0; i < CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE; i++)
+  {
+    ecma_function_template_cache[i].bytecode_header_p = NULL;
+    ecma_function_template_cache[i].template_p = NULL;
+  }
+} /* ecma_op_function_template_cache_init */
 
-    for (ecma_length_t i = 0; i < bound_arg_list_p->unit_number; i++)
+/**
+ * Remove all entries of cache of function templates, releasing the templates
+ */
+void
+ecma_op_function_template_cache_invalidate_all (void)
+{
+  for (uint32_t i = 0; i < CONFIG_ECMA_FUNCTION_TEMPLATE_CACHE_SIZE; i++)
+  {
+    if (ecma_function_template_cache[i].template_p != NULL)
     {
-      bool is_moved = ecma_collection_iterator_next (&bound_args_iterator);
-      JERRY_ASSERT (is_moved);
+      ecma_deref_object (ecma_function_template_cache[i].template_p);
 
-      ecma_append_to_values_collection (merged_arg_collection_p, *bound_args_iterator.current_value_p, true);
+      ecma_function_template_cache[i].bytecode_header_p = NULL;
+      ecma_function_template_cache[i].template_p = NULL;
     }
   }
+} /* ecma_op_function_template_cache_invalidate_all */
 
-  ecma_collection_iterator_t passed_args_iterator;
-  ecma_collection_iterator_init (&passed_args_iterator, passed_arg_collection_p);
-  for (ecma_length_t i = 0; i < passed_args_number; i++)
+/**
+ * Get template of a function literal from the cache of function templates
+ *
+ * @return pointer to the template (the reference should be released with ecma_deref_object),
+ *         or NULL - if the template is not in the cache
+ */
+ecma_object_t *
+ecma_op_function_template_cache_lookup (const bytecode_data_header_t *bytecode_header_p, /**< byte-code */
+                                        vm_instr_counter_t first_instr_pos) /**< position of first instruction
+                                                                             *   of the function's code */
+{
+  ecma_function_template_cache_entry_t *entry_p = ecma_function_template_cache_get_entry (bytecode_header_p,
+                                                                                          first_instr_pos);
+
+  if (entry_p->template_p != NULL
+      && entry_p->bytecode_header_p == bytecode_header_p
+      && entry_p->first_instr_pos == first_instr_pos)
   {
-    bool is_moved = ecma_collection_iterator_next (&passed_args_iterator);
-    JERRY_ASSERT (is_moved);
+    ecma_ref_object (entry_p->template_p);
 
-    ecma_append_to_values_collection (merged_arg_collection_p, *passed_args_iterator.current_value_p, true);
+    return entry_p->template_p;
   }
 
-  return merged_arg_collection_p;
-} /* ecma_function_bind_merge_arg_lists */
+  return NULL;
+} /* ecma_op_function_template_cache_lookup */
 
 /**
- * Function object creation operation.
- *
- * See also: ECMA-262 v5, 13.2
+ * Get value of [[Code]] internal property for the function code, described by scope code flags
+ * at specified position of the byte-code
  *
- * @return pointer to newly created Function object
+ * @return packed value (see also: ecma_pack_code_internal_property_value)
  */
-ecma_object_t*
-ecma_op_create_function_object (ecma_collection_header_t *formal_params_collection_p, /**< formal parameters collection
-                                                                                       *   Warning:
-                                                                                       *     the collection should not
-                                                                                       *     be changed / used / freed
-                                                                                       *     by caller after passing it
-                                                                                       *     to the routine */
-                                ecma_object_t *scope_p, /**< function's scope */
-                                bool is_decl_in_strict_mode, /**< is function declared in strict mode code? */
-                                const bytecode_data_header_t *bytecode_header_p, /**< byte-code */
-                                vm_instr_counter_t first_instr_pos) /**< position of first instruction
-                                                                     *   of function's body */
+static uint32_t
+ecma_op_function_get_code_internal_property_value (bool is_decl_in_strict_mode, /**< is function declared
+                                                                                 *   in strict mode code? */
+                                                   const bytecode_data_header_t *bytecode_header_p, /**< byte-code */
+                                                   vm_instr_counter_t first_instr_pos) /**< position of first
+                                                                                        *   instruction of
+                                                                                        *   function's body */
 {
   bool is_strict_mode_code = is_decl_in_strict_mode;
   bool do_instantiate_arguments_object = true;
@@ -281,6 +430,157 @@ ecma_op_create_function_object (ecma_collection_header_t *formal_params_collecti
     is_no_lex_env = true;
   }
 
+  vm_instr_t first_instr = vm_get_instr (bytecode_header_p->instrs_p, instr_pos);
+
+  /* code of lazy function starts with the function's source text instead of reg_var_decl */
+  bool is_lazy = (first_instr.op_idx == VM_OP_META
+                  && (first_instr.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION
+                      || first_instr.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED));
+
+  return ecma_pack_code_internal_property_value (is_strict_mode_code,
+                                                 do_instantiate_arguments_object,
+                                                 is_arguments_moved_to_regs,
+                                                 is_no_lex_env,
+                                                 is_lazy,
+                                                 instr_pos);
+} /* ecma_op_function_get_code_internal_property_value */
+
+
+/**
+ * Function template creation operation
+ *
+ * Function template is an internal object, holding the parts of Function object's state,
+ * that are determined by the function literal: [[FormalParameters]] and [[Code]]
+ * (see also: ECMA-262 v5, 13.2, steps 10-12).
+ *
+ * The template is put to the cache of function templates.
+ *
+ * @return pointer to newly created template (the reference should be released with ecma_deref_object)
+ */
+ecma_object_t *
+ecma_op_create_function_template (ecma_collection_header_t *formal_params_collection_p, /**< formal parameters
+                                                                                         *   collection
+                                                                                         *   Warning:
+                                                                                         *     the collection should
+                                                                                         *     not be changed / used
+                                                                                         *     / freed by caller
+                                                                                         *     after passing it
+                                                                                         *     to the routine */
+                                  bool is_decl_in_strict_mode, /**< is function declared in strict mode code? */
+                                  const bytecode_data_header_t *bytecode_header_p, /**< byte-code */
+                                  vm_instr_counter_t first_instr_pos) /**< position of first instruction
+                                                                       *   of function's body */
+{
+  ecma_object_t *template_p = ecma_create_object (NULL, false, ECMA_OBJECT_TYPE_GENERAL);
+
+  // 10., 11.
+  if (formal_params_collection_p != NULL
+      && formal_params_collection_p->unit_number != 0)
+  {
+    ecma_property_t *formal_params_prop_p = ecma_create_internal_property (template_p,
+                                                                           ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS);
+    ECMA_SET_POINTER (formal_params_prop_p->u.internal_property.value, formal_params_collection_p);
+  }
+  else if (formal_params_collection_p != NULL)
+  {
+    ecma_free_values_collection (formal_params_collection_p, false);
+  }
+
+  // 12.
+  ecma_property_t *bytecode_prop_p = ecma_create_internal_property (template_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
+  MEM_CP_SET_NON_NULL_POINTER (bytecode_prop_p->u.internal_property.value, bytecode_header_p);
+
+  ecma_property_t *code_prop_p = ecma_create_internal_property (template_p,
+                                                                ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
+  code_prop_p->u.internal_property.value = ecma_op_function_get_code_internal_property_value (is_decl_in_strict_mode,
+                                                                                              bytecode_header_p,
+                                                                                              first_instr_pos);
+
+  ecma_function_template_cache_entry_t *entry_p = ecma_function_template_cache_get_entry (bytecode_header_p,
+                                                                                          first_instr_pos);
+
+  if (entry_p->template_p != NULL)
+  {
+    ecma_deref_object (entry_p->template_p);
+  }
+
+  ecma_ref_object (template_p);
+
+  entry_p->bytecode_header_p = bytecode_header_p;
+  entry_p->first_instr_pos = first_instr_pos;
+  entry_p->template_p = template_p;
+
+  return template_p;
+} /* ecma_op_create_function_template */
+
+/**
+ * Get template of a Function object, created through 13.2
+ *
+ * @return pointer to the template
+ */
+static ecma_object_t *
+ecma_op_function_get_template (ecma_object_t *func_obj_p) /**< Function object */
+{
+  JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION
+                && !ecma_get_object_is_builtin (func_obj_p));
+
+  ecma_property_t *template_prop_p = ecma_get_internal_property (func_obj_p,
+                                                                 ECMA_INTERNAL_PROPERTY_FUNCTION_TEMPLATE);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_object_t, template_prop_p->u.internal_property.value);
+} /* ecma_op_function_get_template */
+
+/**
+ * Get [[FormalParameters]] of a Function object, created through 13.2
+ *
+ * @return collection of formal parameters' names
+ *         or NULL - if the function doesn't have formal parameters, stored in a collection
+ */
+ecma_collection_header_t *
+ecma_op_function_get_formal_params (ecma_object_t *func_obj_p) /**< Function object */
+{
+  ecma_object_t *template_p = ecma_op_function_get_template (func_obj_p);
+
+  ecma_property_t *formal_params_prop_p = ecma_find_internal_property (template_p,
+                                                                      ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS);
+
+  if (formal_params_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t,
+                                    formal_params_prop_p->u.internal_property.value);
+} /* ecma_op_function_get_formal_params */
+
+/**
+ * Function object creation operation.
+ *
+ * See also: ECMA-262 v5, 13.2
+ *
+ * @return pointer to newly created Function object
+ */
+ecma_object_t*
+ecma_op_create_function_object (ecma_object_t *template_p, /**< function template
+                                                            *   (see also: ecma_op_create_function_template) */
+                                ecma_object_t *scope_p) /**< function's scope */
+{
+  ecma_property_t *code_prop_p = ecma_get_internal_property (template_p,
+                                                             ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
+
+  bool is_strict_mode_code;
+  bool do_instantiate_arguments_object;
+  bool is_arguments_moved_to_regs;
+  bool is_no_lex_env;
+  bool is_lazy;
+
+  ecma_unpack_code_internal_property_value (code_prop_p->u.internal_property.value,
+                                            &is_strict_mode_code,
+                                            &do_instantiate_arguments_object,
+                                            &is_arguments_moved_to_regs,
+                                            &is_no_lex_env,
+                                            &is_lazy);
+
   // 1., 4., 13.
   ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE);
 
@@ -306,25 +606,9 @@ ecma_op_create_function_object (ecma_collection_header_t *formal_params_collecti
   ecma_property_t *scope_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_SCOPE);
   ECMA_SET_POINTER (scope_prop_p->u.internal_property.value, scope_p);
 
-  // 10., 11.
-  if (formal_params_collection_p != NULL
-      && formal_params_collection_p->unit_number != 0)
-  {
-    ecma_property_t *formal_params_prop_p = ecma_create_internal_property (f,
-                                                                           ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS);
-    ECMA_SET_POINTER (formal_params_prop_p->u.internal_property.value, formal_params_collection_p);
-  }
-
-  // 12.
-  ecma_property_t *bytecode_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
-  MEM_CP_SET_NON_NULL_POINTER (bytecode_prop_p->u.internal_property.value, bytecode_header_p);
-
-  ecma_property_t *code_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
-  code_prop_p->u.internal_property.value = ecma_pack_code_internal_property_value (is_strict_mode_code,
-                                                                                   do_instantiate_arguments_object,
-                                                                                   is_arguments_moved_to_regs,
-                                                                                   is_no_lex_env,
-                                                                                   instr_pos);
+  // 10., 11., 12.
+  ecma_property_t *template_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_FUNCTION_TEMPLATE);
+  ECMA_SET_NON_NULL_POINTER (template_prop_p->u.internal_property.value, template_p);
 
   // 14.
   // 15.
@@ -446,12 +730,15 @@ ecma_op_function_try_lazy_instantiate_property (ecma_object_t *obj_p, /**< the f
     // 14
     ecma_number_t *len_p = ecma_alloc_number ();
 
-    ecma_property_t *formal_parameters_prop_p = ecma_find_internal_property (obj_p,
-                                                                             ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS);
-    if (formal_parameters_prop_p == NULL)
+    ecma_object_t *template_p = ecma_op_function_get_template (obj_p);
+    ecma_collection_header_t *formal_parameters_p = ecma_op_function_get_formal_params (obj_p);
+
+    if (formal_parameters_p == NULL)
     {
-      ecma_property_t *bytecode_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
-      ecma_property_t *code_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
+      ecma_property_t *bytecode_prop_p = ecma_get_internal_property (template_p,
+                                                                     ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
+      ecma_property_t *code_prop_p = ecma_get_internal_property (template_p,
+                                                                 ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
 
       uint32_t code_prop_value = code_prop_p->u.internal_property.value;
 
@@ -459,6 +746,7 @@ ecma_op_function_try_lazy_instantiate_property (ecma_object_t *obj_p, /**< the f
       bool do_instantiate_args_obj;
       bool is_arguments_moved_to_regs;
       bool is_no_lex_env;
+      bool is_lazy;
 
       const bytecode_data_header_t *bytecode_header_p;
       bytecode_header_p = MEM_CP_GET_POINTER (const bytecode_data_header_t, bytecode_prop_p->u.internal_property.value);
@@ -467,15 +755,21 @@ ecma_op_function_try_lazy_instantiate_property (ecma_object_t *obj_p, /**< the f
                                                                                           &is_strict,
                                                                                           &do_instantiate_args_obj,
                                                                                           &is_arguments_moved_to_regs,
-                                                                                          &is_no_lex_env);
+                                                                                          &is_no_lex_env,
+                                                                                          &is_lazy);
 
-      *len_p = vm_get_scope_args_num (bytecode_header_p, code_first_instr_pos);
+      if (is_lazy)
+      {
+        /* formal parameters of lazy function are always listed in the template */
+        *len_p = ECMA_NUMBER_ZERO;
+      }
+      else
+      {
+        *len_p = vm_get_scope_args_num (bytecode_header_p, code_first_instr_pos);
+      }
     }
     else
     {
-      ecma_collection_header_t *formal_parameters_p;
-      formal_parameters_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t,
-                                                       formal_parameters_prop_p->u.internal_property.value);
       *len_p = ecma_uint32_to_number (formal_parameters_p->unit_number);
     }
 
@@ -632,27 +926,25 @@ ecma_op_create_external_function_object (ecma_external_pointer_t code_p) /**< po
 static ecma_completion_value_t
 ecma_function_call_setup_args_variables (ecma_object_t *func_obj_p, /**< Function object */
                                          ecma_object_t *env_p, /**< lexical environment */
-                                         ecma_collection_header_t *arg_collection_p, /**< arguments collection */
+                                         const ecma_value_t *arguments_list_p, /**< arguments list */
+                                         ecma_length_t arguments_list_len, /**< length of arguments list */
                                          bool is_strict, /**< flag indicating strict mode */
-                                         bool do_instantiate_arguments_object) /**< flag indicating whether
+                                         bool do_instantiate_arguments_object, /**< flag indicating whether
                                                                                 *   Arguments object should be
                                                                                 *   instantiated */
+                                         ecma_arguments_deferred_t *deferred_args_obj_p) /**< out: description
+                                                                                         *   of deferred
+                                                                                         *   Arguments object */
 {
-  ecma_collection_header_t *formal_parameters_p = NULL;
+  deferred_args_obj_p->binding_p = NULL;
 
-  ecma_property_t *formal_parameters_prop_p = ecma_find_internal_property (func_obj_p,
-                                                                           ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS);
+  ecma_collection_header_t *formal_parameters_p = ecma_op_function_get_formal_params (func_obj_p);
 
-  if (formal_parameters_prop_p != NULL)
+  if (formal_parameters_p != NULL)
   {
-    formal_parameters_p = ECMA_GET_POINTER (ecma_collection_header_t,
-                                            formal_parameters_prop_p->u.internal_property.value);
-
     ecma_length_t formal_parameters_count = formal_parameters_p->unit_number;
 
-    ecma_collection_iterator_t arguments_iterator, formal_params_iterator;
-
-    ecma_collection_iterator_init (&arguments_iterator, arg_collection_p);
+    ecma_collection_iterator_t formal_params_iterator;
     ecma_collection_iterator_init (&formal_params_iterator, formal_parameters_p);
 
     /*
@@ -668,9 +960,9 @@ ecma_function_call_setup_args_variables (ecma_object_t *func_obj_p, /**< Functio
          n++)
     {
       ecma_value_t arg_value;
-      if (ecma_collection_iterator_next (&arguments_iterator))
+      if (n < arguments_list_len)
       {
-        arg_value = *arguments_iterator.current_value_p;
+        arg_value = arguments_list_p[n];
       }
       else
       {
@@ -733,16 +1025,13 @@ ecma_function_call_setup_args_variables (ecma_object_t *func_obj_p, /**< Functio
 
     if (!binding_already_declared)
     {
-      ecma_object_t *args_obj_p = ecma_op_create_arguments_object (func_obj_p,
-                                                                   env_p,
-                                                                   formal_parameters_p,
-                                                                   arg_collection_p,
-                                                                   is_strict);
-
+      /*
+       * The binding is left empty, and the Arguments object is created upon first read of the binding,
+       * if the read happens during the call (see also: ecma_op_arguments_object_defer).
+       */
       if (is_strict)
       {
         ecma_op_create_immutable_binding (env_p, arguments_string_p);
-        ecma_op_initialize_immutable_binding (env_p, arguments_string_p, ecma_make_object_value (args_obj_p));
       }
       else
       {
@@ -750,15 +1039,18 @@ ecma_function_call_setup_args_variables (ecma_object_t *func_obj_p, /**< Functio
                                                                              arguments_string_p,
                                                                              false);
         JERRY_ASSERT (ecma_is_completion_value_empty (completion));
-
-        completion = ecma_op_set_mutable_binding (env_p,
-                                                  arguments_string_p,
-                                                  ecma_make_object_value (args_obj_p),
-                                                  false);
-        JERRY_ASSERT (ecma_is_completion_value_empty (completion));
       }
 
-      ecma_deref_object (args_obj_p);
+      ecma_property_t *binding_p = ecma_get_named_data_property (env_p, arguments_string_p);
+      ecma_set_named_data_property_value (binding_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY));
+
+      ecma_op_arguments_object_defer (deferred_args_obj_p,
+                                      func_obj_p,
+                                      env_p,
+                                      binding_p,
+                                      arguments_list_p,
+                                      arguments_list_len,
+                                      is_strict);
     }
 
     ecma_deref_ecma_string (arguments_string_p);
@@ -858,39 +1150,112 @@ ecma_op_function_has_instance (ecma_object_t *func_obj_p, /**< Function object *
 } /* ecma_op_function_has_instance */
 
 /**
- * Function call helper with arguments list specified in array instead of collection
+ * Compile code of a lazy function (see also: parser_set_lazy_functions),
+ * and update the function's template to refer to the compiled code.
  *
- * See also:
- *          ecma_op_function_call
+ * Note:
+ *      pointer to the compiled byte-code is recorded in place of range of the lazy function's source text,
+ *      so templates, created for the function literal later, don't cause recompilation.
  *
- * @return completion value
- *         Returned value must be freed with ecma_free_completion_value
+ * @return empty completion value - if the code was compiled successfully,
+ *         throw completion value - otherwise (an early error was raised during compilation).
  */
-ecma_completion_value_t
-ecma_op_function_call_array_args (ecma_object_t *func_obj_p, /**< Function object */
-                                  ecma_value_t this_arg_value, /**< 'this' argument's value */
-                                  const ecma_value_t* arguments_list_p, /**< arguments list */
-                                  ecma_length_t arguments_list_len) /**< length of arguments list */
+static ecma_completion_value_t
+ecma_op_function_compile_lazy_code (ecma_object_t *template_p) /**< function template */
 {
-  if (arguments_list_len == 0)
+  ecma_property_t *bytecode_prop_p = ecma_get_internal_property (template_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
+  ecma_property_t *code_prop_p = ecma_get_internal_property (template_p,
+                                                             ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
+
+  bool is_strict;
+  bool do_instantiate_args_obj;
+  bool is_arguments_moved_to_regs;
+  bool is_no_lex_env;
+  bool is_lazy;
+
+  vm_instr_counter_t lazy_instr_pos = ecma_unpack_code_internal_property_value (code_prop_p->u.internal_property.value,
+                                                                                &is_strict,
+                                                                                &do_instantiate_args_obj,
+                                                                                &is_arguments_moved_to_regs,
+                                                                                &is_no_lex_env,
+                                                                                &is_lazy);
+  JERRY_ASSERT (is_lazy);
+
+  const bytecode_data_header_t *bytecode_header_p;
+  bytecode_header_p = MEM_CP_GET_NON_NULL_POINTER (const bytecode_data_header_t,
+                                                   bytecode_prop_p->u.internal_property.value);
+
+  vm_instr_t lazy_instr = vm_get_instr (bytecode_header_p->instrs_p, lazy_instr_pos);
+  JERRY_ASSERT (lazy_instr.op_idx == VM_OP_META);
+
+  const bytecode_data_header_t *compiled_bytecode_header_p;
+
+  JERRY_STATIC_ASSERT (MEM_CP_WIDTH <= 2 * sizeof (vm_idx_t) * JERRY_BITSINBYTE);
+
+  if (lazy_instr.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED)
   {
-    return ecma_op_function_call (func_obj_p, this_arg_value, NULL);
+    mem_cpointer_t compiled_bytecode_cp = (mem_cpointer_t) ((lazy_instr.data.meta.data_1 << JERRY_BITSINBYTE)
+                                                            | lazy_instr.data.meta.data_2);
+
+    compiled_bytecode_header_p = MEM_CP_GET_NON_NULL_POINTER (const bytecode_data_header_t, compiled_bytecode_cp);
   }
   else
   {
-    ecma_collection_header_t *arg_collection_p = ecma_new_values_collection (arguments_list_p,
-                                                                             arguments_list_len,
-                                                                             true);
+    JERRY_ASSERT (lazy_instr.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION);
 
-    ecma_completion_value_t ret_value = ecma_op_function_call (func_obj_p,
-                                                               this_arg_value,
-                                                               arg_collection_p);
+    jsp_status_t parse_status = parser_parse_lazy_function (bytecode_header_p,
+                                                            lazy_instr_pos,
+                                                            is_strict,
+                                                            &compiled_bytecode_header_p);
 
-    ecma_free_values_collection (arg_collection_p, true);
+    if (parse_status == JSP_STATUS_SYNTAX_ERROR)
+    {
+      return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_SYNTAX));
+    }
+    else if (parse_status == JSP_STATUS_REFERENCE_ERROR)
+    {
+      return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_REFERENCE));
+    }
 
-    return ret_value;
+    JERRY_ASSERT (parse_status == JSP_STATUS_OK);
+
+    mem_cpointer_t compiled_bytecode_cp;
+    MEM_CP_SET_NON_NULL_POINTER (compiled_bytecode_cp, compiled_bytecode_header_p);
+
+    lazy_instr.data.meta.type = OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED;
+    lazy_instr.data.meta.data_1 = (vm_idx_t) (compiled_bytecode_cp >> JERRY_BITSINBYTE);
+    lazy_instr.data.meta.data_2 = (vm_idx_t) (compiled_bytecode_cp & ((1u << JERRY_BITSINBYTE) - 1u));
+
+    bytecode_header_p->instrs_p[lazy_instr_pos] = lazy_instr;
   }
-} /* ecma_op_function_call_array_args */
+
+  /* the function's code is the code of first function expression in the compiled byte-code */
+  vm_instr_counter_t instr_pos = 0;
+  vm_instr_t func_expr_instr = vm_get_instr (compiled_bytecode_header_p->instrs_p, instr_pos);
+
+  while (func_expr_instr.op_idx != VM_OP_FUNC_EXPR_N)
+  {
+    instr_pos++;
+    JERRY_ASSERT (instr_pos < compiled_bytecode_header_p->instrs_count);
+
+    func_expr_instr = vm_get_instr (compiled_bytecode_header_p->instrs_p, instr_pos);
+  }
+
+  /* skip the header and formal parameters' list */
+  instr_pos = (vm_instr_counter_t) (instr_pos + 1u + func_expr_instr.data.func_expr_n.arg_list);
+
+  JERRY_ASSERT (vm_get_instr (compiled_bytecode_header_p->instrs_p, instr_pos).op_idx == VM_OP_META
+                && (vm_get_instr (compiled_bytecode_header_p->instrs_p, instr_pos).data.meta.type
+                    == OPCODE_META_TYPE_FUNCTION_END));
+  instr_pos++;
+
+  MEM_CP_SET_NON_NULL_POINTER (bytecode_prop_p->u.internal_property.value, compiled_bytecode_header_p);
+  code_prop_p->u.internal_property.value = ecma_op_function_get_code_internal_property_value (is_strict,
+                                                                                              compiled_bytecode_header_p,
+                                                                                              instr_pos);
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_op_function_compile_lazy_code */
 
 /**
  * [[Call]] implementation for Function objects,
@@ -905,7 +1270,8 @@ ecma_op_function_call_array_args (ecma_object_t *func_obj_p, /**< Function objec
 ecma_completion_value_t
 ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                        ecma_value_t this_arg_value, /**< 'this' argument's value */
-                       ecma_collection_header_t* arg_collection_p) /**< arguments list */
+                       const ecma_value_t *arguments_list_p, /**< arguments list */
+                       ecma_length_t arguments_list_len) /**< length of arguments list */
 {
   JERRY_ASSERT (func_obj_p != NULL
                 && !ecma_is_lexical_environment (func_obj_p));
@@ -919,14 +1285,17 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
     {
       ret_value = ecma_builtin_dispatch_call (func_obj_p,
                                               this_arg_value,
-                                              arg_collection_p);
+                                              arguments_list_p,
+                                              arguments_list_len);
     }
     else
     {
       /* Entering Function Code (ECMA-262 v5, 10.4.3) */
       ecma_property_t *scope_prop_p = ecma_get_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
-      ecma_property_t *bytecode_prop_p = ecma_get_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
-      ecma_property_t *code_prop_p = ecma_get_internal_property (func_obj_p,
+
+      ecma_object_t *template_p = ecma_op_function_get_template (func_obj_p);
+      ecma_property_t *bytecode_prop_p = ecma_get_internal_property (template_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
+      ecma_property_t *code_prop_p = ecma_get_internal_property (template_p,
                                                                  ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
 
       ecma_object_t *scope_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
@@ -938,15 +1307,38 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       bool do_instantiate_args_obj;
       bool is_arguments_moved_to_regs;
       bool is_no_lex_env;
-
-      const bytecode_data_header_t *bytecode_data_p;
-      bytecode_data_p = MEM_CP_GET_POINTER (const bytecode_data_header_t, bytecode_prop_p->u.internal_property.value);
+      bool is_lazy;
 
       vm_instr_counter_t code_first_instr_pos = ecma_unpack_code_internal_property_value (code_prop_value,
                                                                                           &is_strict,
                                                                                           &do_instantiate_args_obj,
                                                                                           &is_arguments_moved_to_regs,
-                                                                                          &is_no_lex_env);
+                                                                                          &is_no_lex_env,
+                                                                                          &is_lazy);
+
+      if (unlikely (is_lazy))
+      {
+        ecma_completion_value_t compile_completion = ecma_op_function_compile_lazy_code (template_p);
+
+        if (ecma_is_completion_value_throw (compile_completion))
+        {
+          return compile_completion;
+        }
+
+        JERRY_ASSERT (ecma_is_completion_value_empty (compile_completion));
+
+        code_prop_value = code_prop_p->u.internal_property.value;
+        code_first_instr_pos = ecma_unpack_code_internal_property_value (code_prop_value,
+                                                                         &is_strict,
+                                                                         &do_instantiate_args_obj,
+                                                                         &is_arguments_moved_to_regs,
+                                                                         &is_no_lex_env,
+                                                                         &is_lazy);
+        JERRY_ASSERT (!is_lazy);
+      }
+
+      const bytecode_data_header_t *bytecode_data_p;
+      bytecode_data_p = MEM_CP_GET_POINTER (const bytecode_data_header_t, bytecode_prop_p->u.internal_property.value);
 
       ecma_value_t this_binding;
       // 1.
@@ -988,7 +1380,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                                                               local_env_p,
                                                               is_strict,
                                                               false,
-                                                              arg_collection_p);
+                                                              arguments_list_p,
+                                                              arguments_list_len);
 
         if (ecma_is_completion_value_return (completion))
         {
@@ -1001,13 +1394,17 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       }
       else
       {
+        ecma_arguments_deferred_t deferred_args_obj;
+
         // 9.
         ECMA_TRY_CATCH (args_var_declaration_ret,
                         ecma_function_call_setup_args_variables (func_obj_p,
                                                                  local_env_p,
-                                                                 arg_collection_p,
+                                                                 arguments_list_p,
+                                                                 arguments_list_len,
                                                                  is_strict,
-                                                                 do_instantiate_args_obj),
+                                                                 do_instantiate_args_obj,
+                                                                 &deferred_args_obj),
                         ret_value);
 
         ecma_completion_value_t completion = vm_run_from_pos (bytecode_data_p,
@@ -1016,7 +1413,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                                                               local_env_p,
                                                               is_strict,
                                                               false,
-                                                              NULL);
+                                                              NULL,
+                                                              0);
 
         if (ecma_is_completion_value_return (completion))
         {
@@ -1028,6 +1426,11 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
         }
 
         ECMA_FINALIZE (args_var_declaration_ret);
+
+        if (deferred_args_obj.binding_p != NULL)
+        {
+          ecma_op_arguments_object_end_deferral (&deferred_args_obj);
+        }
       }
 
       if (is_no_lex_env)
@@ -1046,7 +1449,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
   {
     ret_value = ecma_builtin_dispatch_call (func_obj_p,
                                             this_arg_value,
-                                            arg_collection_p);
+                                            arguments_list_p,
+                                            arguments_list_len);
   }
   else if (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION)
   {
@@ -1059,7 +1463,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
     ret_value = jerry_dispatch_external_function (func_obj_p,
                                                   handler_p,
                                                   this_arg_value,
-                                                  arg_collection_p);
+                                                  arguments_list_p,
+                                                  arguments_list_len);
   }
   else
   {
@@ -1076,18 +1481,29 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
     ecma_object_t *target_func_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
                                                                   target_function_prop_p->u.internal_property.value);
 
-    /* 4. */
-    ecma_collection_header_t *merged_arg_collection_p = ecma_function_bind_merge_arg_lists (func_obj_p,
-                                                                                            arg_collection_p);
-
     ecma_value_t bound_this_value = bound_this_prop_p->u.internal_property.value;
 
-    /* 5. */
-    ret_value = ecma_op_function_call (target_func_obj_p,
-                                       bound_this_value,
-                                       merged_arg_collection_p);
+    /* 4. */
+    ecma_values_array_header_t *bound_args_p = ecma_function_bind_get_bound_args (func_obj_p);
 
-    ecma_free_values_collection (merged_arg_collection_p, true);
+    if (bound_args_p == NULL)
+    {
+      /* 5. */
+      ret_value = ecma_op_function_call (target_func_obj_p,
+                                         bound_this_value,
+                                         arguments_list_p,
+                                         arguments_list_len);
+    }
+    else
+    {
+      /* 4. - 5. */
+      ret_value = ecma_function_bind_dispatch_with_bound_args (target_func_obj_p,
+                                                               false,
+                                                               bound_this_value,
+                                                               bound_args_p,
+                                                               arguments_list_p,
+                                                               arguments_list_len);
+    }
   }
 
   JERRY_ASSERT (!ecma_is_completion_value_empty (ret_value));
@@ -1105,8 +1521,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
  */
 static ecma_completion_value_t
 ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< Function object */
-                                               ecma_collection_header_t* arg_collection_p) /**< arguments
-                                                                                            *   collection */
+                                               const ecma_value_t *arguments_list_p, /**< arguments list */
+                                               ecma_length_t arguments_list_len) /**< length of arguments list */
 {
   JERRY_ASSERT (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION
                 || ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION);
@@ -1153,7 +1569,8 @@ ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< F
   ECMA_TRY_CATCH (call_completion,
                   ecma_op_function_call (func_obj_p,
                                          ecma_make_object_value (obj_p),
-                                         arg_collection_p),
+                                         arguments_list_p,
+                                         arguments_list_len),
                   ret_value);
 
   ecma_value_t obj_value;
@@ -1194,7 +1611,8 @@ ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< F
  */
 ecma_completion_value_t
 ecma_op_function_construct (ecma_object_t *func_obj_p, /**< Function object */
-                            ecma_collection_header_t *arg_collection_p) /**< arguments collection */
+                            const ecma_value_t *arguments_list_p, /**< arguments list */
+                            ecma_length_t arguments_list_len) /**< length of arguments list */
 {
   JERRY_ASSERT (func_obj_p != NULL
                 && !ecma_is_lexical_environment (func_obj_p));
@@ -1207,16 +1625,16 @@ ecma_op_function_construct (ecma_object_t *func_obj_p, /**< Function object */
     if (unlikely (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_FUNCTION
                   && ecma_get_object_is_builtin (func_obj_p)))
     {
-      ret_value = ecma_builtin_dispatch_construct (func_obj_p, arg_collection_p);
+      ret_value = ecma_builtin_dispatch_construct (func_obj_p, arguments_list_p, arguments_list_len);
     }
     else
     {
-      ret_value = ecma_op_function_construct_simple_or_external (func_obj_p, arg_collection_p);
+      ret_value = ecma_op_function_construct_simple_or_external (func_obj_p, arguments_list_p, arguments_list_len);
     }
   }
   else if (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION)
   {
-    ret_value = ecma_op_function_construct_simple_or_external (func_obj_p, arg_collection_p);
+    ret_value = ecma_op_function_construct_simple_or_external (func_obj_p, arguments_list_p, arguments_list_len);
   }
   else
   {
@@ -1238,14 +1656,25 @@ ecma_op_function_construct (ecma_object_t *func_obj_p, /**< Function object */
     else
     {
       /* 4. */
-      ecma_collection_header_t *merged_arg_collection_p = ecma_function_bind_merge_arg_lists (func_obj_p,
-                                                                                              arg_collection_p);
+      ecma_values_array_header_t *bound_args_p = ecma_function_bind_get_bound_args (func_obj_p);
 
-      /* 5. */
-      ret_value = ecma_op_function_construct (target_func_obj_p,
-                                              merged_arg_collection_p);
-
-      ecma_free_values_collection (merged_arg_collection_p, true);
+      if (bound_args_p == NULL)
+      {
+        /* 5. */
+        ret_value = ecma_op_function_construct (target_func_obj_p,
+                                                arguments_list_p,
+                                                arguments_list_len);
+      }
+      else
+      {
+        /* 4. - 5. */
+        ret_value = ecma_function_bind_dispatch_with_bound_args (target_func_obj_p,
+                                                                 true,
+                                                                 ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
+                                                                 bound_args_p,
+                                                                 arguments_list_p,
+                                                                 arguments_list_len);
+      }
     }
   }
 
@@ -1263,26 +1692,15 @@ ecma_op_function_construct (ecma_object_t *func_obj_p, /**< Function object */
 ecma_completion_value_t
 ecma_op_function_declaration (ecma_object_t *lex_env_p, /**< lexical environment */
                               ecma_string_t *function_name_p, /**< function name */
-                              const bytecode_data_header_t *bytecode_data_p, /**< byte-code data */
-                              vm_instr_counter_t function_first_instr_pos, /**< position of first instruction
-                                                                            *   of function code */
-                              ecma_collection_header_t *formal_params_collection_p, /**< formal parameters collection
-                                                                                     *   Warning:
-                                                                                     *     the collection should not
-                                                                                     *     be changed / used / freed
-                                                                                     *     by caller after passing it
-                                                                                     *     to the routine */
+                              ecma_object_t *template_p, /**< function template
+                                                          *   (see also: ecma_op_create_function_template) */
                               bool is_decl_in_strict_mode, /**< flag, indicating if function is
                                                             *   declared in strict mode code */
                               bool is_configurable_bindings) /**< flag indicating whether function
                                                               *   is declared in eval code */
 {
   // b.
-  ecma_object_t *func_obj_p = ecma_op_create_function_object (formal_params_collection_p,
-                                                              lex_env_p,
-                                                              is_decl_in_strict_mode,
-                                                              bytecode_data_p,
-                                                              function_first_instr_pos);
+  ecma_object_t *func_obj_p = ecma_op_create_function_object (template_p, lex_env_p);
 
   // c.
   bool func_already_declared = ecma_op_has_binding (lex_env_p, function_name_p);
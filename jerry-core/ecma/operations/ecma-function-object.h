@@ -29,9 +29,17 @@
 extern bool ecma_op_is_callable (ecma_value_t);
 extern bool ecma_is_constructor (ecma_value_t);
 
+extern void ecma_op_function_template_cache_init (void);
+extern void ecma_op_function_template_cache_invalidate_all (void);
 extern ecma_object_t *
-ecma_op_create_function_object (ecma_collection_header_t *, ecma_object_t *,
-                                bool, const bytecode_data_header_t *, vm_instr_counter_t);
+ecma_op_function_template_cache_lookup (const bytecode_data_header_t *, vm_instr_counter_t);
+extern ecma_object_t *
+ecma_op_create_function_template (ecma_collection_header_t *, bool, const bytecode_data_header_t *, vm_instr_counter_t);
+
+extern ecma_object_t *
+ecma_op_create_function_object (ecma_object_t *, ecma_object_t *);
+extern ecma_collection_header_t *
+ecma_op_function_get_formal_params (ecma_object_t *);
 
 extern void
 ecma_op_function_list_lazy_property_names (bool,
@@ -42,25 +50,20 @@ extern ecma_object_t *
 ecma_op_create_external_function_object (ecma_external_pointer_t);
 
 extern ecma_completion_value_t
-ecma_op_function_call (ecma_object_t *, ecma_value_t, ecma_collection_header_t *);
+ecma_op_function_call (ecma_object_t *, ecma_value_t, const ecma_value_t *, ecma_length_t);
 
 
 extern ecma_property_t *
 ecma_op_function_object_get_own_property (ecma_object_t *, ecma_string_t *);
 
 extern ecma_completion_value_t
-ecma_op_function_call_array_args (ecma_object_t *, ecma_value_t, const ecma_value_t *, ecma_length_t);
-
-
-extern ecma_completion_value_t
-ecma_op_function_construct (ecma_object_t *, ecma_collection_header_t *);
+ecma_op_function_construct (ecma_object_t *, const ecma_value_t *, ecma_length_t);
 
 extern ecma_completion_value_t
 ecma_op_function_has_instance (ecma_object_t *, ecma_value_t);
 
 extern ecma_completion_value_t
-ecma_op_function_declaration (ecma_object_t *, ecma_string_t *, const bytecode_data_header_t *, vm_instr_counter_t,
-                              ecma_collection_header_t *, bool, bool);
+ecma_op_function_declaration (ecma_object_t *, ecma_string_t *, ecma_object_t *, bool, bool);
 
 /**
  * @}
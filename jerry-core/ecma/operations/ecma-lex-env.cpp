@@ -21,6 +21,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
+#include "ecma-objects-arguments.h"
 #include "jrt.h"
 
 /** \addtogroup ecma ECMA
@@ -71,6 +72,15 @@ ecma_finalize_environment (void)
   ecma_global_lex_env_p = NULL;
 } /* ecma_finalize_environment */
 
+/**
+ * Add memory region, containing pointer to Global lexical environment, to list of heap image's regions
+ */
+void
+ecma_environment_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_image_regions_add (regions_p, &ecma_global_lex_env_p, sizeof (ecma_global_lex_env_p));
+} /* ecma_environment_get_image_regions */
+
 /**
  * Get reference to Global lexical environment
  *
@@ -304,6 +314,13 @@ ecma_op_get_binding_value (ecma_object_t *lex_env_p, /**< lexical environment */
 
     ecma_value_t prop_value = ecma_get_named_data_property_value (property_p);
 
+    if (unlikely (ecma_is_value_empty (prop_value))
+        && ecma_op_arguments_object_try_create_deferred (lex_env_p, property_p))
+    {
+      /* 'arguments' binding is read for the first time */
+      prop_value = ecma_get_named_data_property_value (property_p);
+    }
+
     /* is the binding mutable? */
     if (!ecma_is_property_writable (property_p)
         && ecma_is_value_empty (prop_value))
@@ -36,6 +36,7 @@
 
 extern void ecma_init_environment (void);
 extern void ecma_finalize_environment (void);
+extern void ecma_environment_get_image_regions (mem_image_regions_t *);
 extern ecma_object_t *ecma_get_global_environment (void);
 extern bool ecma_is_lexical_environment_global (ecma_object_t *);
 
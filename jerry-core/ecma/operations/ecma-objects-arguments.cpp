@@ -37,7 +37,14 @@
 /**
  * Arguments object creation operation.
  *
+ * Note:
+ *      The Arguments object is created in not yet materialized form, that only refers to copy of arguments' values,
+ *      the callee and, in non-strict mode, the lexical environment. Reading of 'length' and of the arguments'
+ *      values is performed directly through these references. Upon any other access the object is materialized,
+ *      i.e. properties and [[ParametersMap]], described in ECMA-262 v5, 10.6, are instantiated.
+ *
  * See also: ECMA-262 v5, 10.6
+ *           ecma_op_arguments_object_materialize
  *
  * @return pointer to newly created Arguments object
  */
@@ -45,23 +52,396 @@ ecma_object_t*
 ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function */
                                  ecma_object_t *lex_env_p, /**< lexical environment the Arguments
                                                                 object is created for */
-                                 ecma_collection_header_t *formal_params_p, /**< formal parameters collection */
-                                 ecma_collection_header_t *arg_collection_p, /**< arguments collection */
+                                 const ecma_value_t *arguments_list_p, /**< arguments list */
+                                 ecma_length_t arguments_list_len, /**< length of arguments list */
                                  bool is_strict) /**< flag indicating whether strict mode is enabled */
 {
+  ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+
+  ecma_object_t *obj_p = ecma_create_object (prototype_p, true, ECMA_OBJECT_TYPE_ARGUMENTS);
+
+  ecma_deref_object (prototype_p);
+
+  ecma_collection_header_t *values_p = NULL;
+
+  if (arguments_list_len != 0)
+  {
+    values_p = ecma_new_values_collection (arguments_list_p, arguments_list_len, false);
+  }
+
+  ecma_property_t *values_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+  ECMA_SET_POINTER (values_prop_p->u.internal_property.value, values_p);
+
+  ecma_property_t *callee_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE);
+  ECMA_SET_NON_NULL_POINTER (callee_prop_p->u.internal_property.value, func_obj_p);
+
+  /* [[Scope]] is stored only for non-strict mode, as only then the arguments are mapped to the formal parameters */
+  if (!is_strict)
+  {
+    ecma_property_t *scope_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+    ECMA_SET_NON_NULL_POINTER (scope_prop_p->u.internal_property.value, lex_env_p);
+  }
+
+  return obj_p;
+} /* ecma_op_create_arguments_object */
+
+/**
+ * Descriptions of Arguments objects, deferred for active function calls (the top-most call's description is first)
+ */
+static ecma_arguments_deferred_t *ecma_arguments_deferred_top_p = NULL;
+
+/**
+ * Defer creation of Arguments object of a function call till first read of the call's 'arguments' binding
+ *
+ * Note:
+ *      the binding should be left empty, so that reading it leads to ecma_op_arguments_object_try_create_deferred;
+ *      the arguments list should be kept unchanged till ecma_op_arguments_object_end_deferral is called
+ *      upon end of the call, so if the binding is never read, the arguments' values are never copied
+ */
+void
+ecma_op_arguments_object_defer (ecma_arguments_deferred_t *deferred_p, /**< out: description of the object
+                                                                         *   (should be kept till end of the call) */
+                                ecma_object_t *func_obj_p, /**< callee function */
+                                ecma_object_t *lex_env_p, /**< lexical environment the Arguments
+                                                               object is created for */
+                                ecma_property_t *binding_p, /**< empty 'arguments' binding of the environment */
+                                const ecma_value_t *arguments_list_p, /**< arguments list */
+                                ecma_length_t arguments_list_len, /**< length of arguments list */
+                                bool is_strict) /**< flag indicating whether strict mode is enabled */
+{
+  JERRY_ASSERT (ecma_is_value_empty (ecma_get_named_data_property_value (binding_p)));
+
+  deferred_p->binding_p = binding_p;
+  deferred_p->func_obj_p = func_obj_p;
+  deferred_p->lex_env_p = lex_env_p;
+  deferred_p->arguments_list_p = arguments_list_p;
+  deferred_p->arguments_list_len = arguments_list_len;
+  deferred_p->is_strict = is_strict;
+
+  deferred_p->prev_p = ecma_arguments_deferred_top_p;
+  ecma_arguments_deferred_top_p = deferred_p;
+} /* ecma_op_arguments_object_defer */
+
+/**
+ * Forget description of the deferred Arguments object upon end of corresponding function call
+ */
+void
+ecma_op_arguments_object_end_deferral (ecma_arguments_deferred_t *deferred_p) /**< description of the object */
+{
+  JERRY_ASSERT (ecma_arguments_deferred_top_p == deferred_p);
+
+  ecma_arguments_deferred_top_p = deferred_p->prev_p;
+} /* ecma_op_arguments_object_end_deferral */
+
+/**
+ * Create Arguments object, deferred for the specified binding, and initialize the binding with it
+ *
+ * Note:
+ *      the binding can only be read while the call it belongs to is active, as the 'arguments' identifier
+ *      is resolved to the binding only from the function's code and from direct eval code, called from it
+ *
+ * @return true - if the binding is 'arguments' binding of an active call (the binding is initialized),
+ *         false - otherwise (the binding is an uninitialized immutable binding)
+ */
+bool
+ecma_op_arguments_object_try_create_deferred (ecma_object_t *lex_env_p, /**< lexical environment */
+                                              ecma_property_t *binding_p) /**< empty binding of the environment */
+{
+  JERRY_ASSERT (ecma_is_value_empty (ecma_get_named_data_property_value (binding_p)));
+
+  for (ecma_arguments_deferred_t *deferred_p = ecma_arguments_deferred_top_p;
+       deferred_p != NULL;
+       deferred_p = deferred_p->prev_p)
+  {
+    if (deferred_p->binding_p == binding_p)
+    {
+      JERRY_ASSERT (deferred_p->lex_env_p == lex_env_p);
+
+      ecma_object_t *args_obj_p = ecma_op_create_arguments_object (deferred_p->func_obj_p,
+                                                                   deferred_p->lex_env_p,
+                                                                   deferred_p->arguments_list_p,
+                                                                   deferred_p->arguments_list_len,
+                                                                   deferred_p->is_strict);
+
+      ecma_named_data_property_assign_value (lex_env_p, binding_p, ecma_make_object_value (args_obj_p));
+
+      ecma_deref_object (args_obj_p);
+
+      return true;
+    }
+  }
+
+  JERRY_ASSERT (!ecma_is_property_writable (binding_p));
+
+  return false;
+} /* ecma_op_arguments_object_try_create_deferred */
+
+/**
+ * Get name of the formal parameter, the argument with specified index is mapped to
+ *
+ * See also: ECMA-262 v5, 10.6, 11.c
+ *
+ * @return pointer to the formal parameter's name - if the argument is mapped,
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_arguments_get_mapped_arg_name (ecma_collection_header_t *formal_params_p, /**< formal parameters collection */
+                                    uint32_t index) /**< index of the argument */
+{
+  if (formal_params_p == NULL
+      || index >= formal_params_p->unit_number)
+  {
+    return NULL;
+  }
+
+  ecma_collection_iterator_t formal_params_iterator;
+  ecma_collection_iterator_init (&formal_params_iterator, formal_params_p);
+
+  ecma_string_t *name_p = NULL;
+
+  for (uint32_t param_index = 0;
+       ecma_collection_iterator_next (&formal_params_iterator);
+       param_index++)
+  {
+    ecma_string_t *param_name_p = ecma_get_string_from_value (*formal_params_iterator.current_value_p);
+
+    if (param_index == index)
+    {
+      name_p = param_name_p;
+    }
+    else if (param_index > index
+             && ecma_compare_ecma_strings (name_p, param_name_p))
+    {
+      /* the name is mapped to a subsequent argument */
+      return NULL;
+    }
+  }
+
+  JERRY_ASSERT (name_p != NULL);
+
+  return name_p;
+} /* ecma_arguments_get_mapped_arg_name */
+
+/**
+ * Try to perform [[Get]] operation on not yet materialized Arguments object,
+ * without materializing it
+ *
+ * @return true - if the property is either 'length', or index of an argument
+ *                (in the case, the value is returned through out_completion_p),
+ *         false - otherwise
+ */
+static bool
+ecma_arguments_try_get_without_materialization (ecma_object_t *obj_p, /**< the object */
+                                                ecma_property_t *values_prop_p, /**< arguments' values
+                                                                                 *   internal property */
+                                                ecma_string_t *property_name_p, /**< property name */
+                                                ecma_completion_value_t *out_completion_p) /**< out: completion
+                                                                                            *   value */
+{
+  ecma_collection_header_t *values_p = ECMA_GET_POINTER (ecma_collection_header_t,
+                                                         values_prop_p->u.internal_property.value);
+  const ecma_length_t arguments_number = values_p != NULL ? values_p->unit_number : 0;
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+  bool is_length = ecma_compare_ecma_strings (property_name_p, length_magic_string_p);
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  if (is_length)
+  {
+    ecma_number_t *len_p = ecma_alloc_number ();
+    *len_p = ecma_uint32_to_number (arguments_number);
+
+    *out_completion_p = ecma_make_normal_completion_value (ecma_make_number_value (len_p));
+    return true;
+  }
+
+  uint32_t index;
+
+  if (!ecma_string_get_array_index (property_name_p, &index)
+      || index >= arguments_number)
+  {
+    return false;
+  }
+
+  ecma_property_t *scope_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+
+  if (scope_prop_p != NULL)
+  {
+    ecma_property_t *callee_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE);
+    ecma_object_t *func_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                           callee_prop_p->u.internal_property.value);
+
+    ecma_collection_header_t *formal_params_p = ecma_op_function_get_formal_params (func_obj_p);
+    ecma_string_t *arg_name_p = ecma_arguments_get_mapped_arg_name (formal_params_p, index);
+
+    if (arg_name_p != NULL)
+    {
+      ecma_object_t *lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                            scope_prop_p->u.internal_property.value);
+
+      *out_completion_p = ecma_op_get_binding_value (lex_env_p, arg_name_p, true);
+      JERRY_ASSERT (ecma_is_completion_value_normal (*out_completion_p));
+
+      return true;
+    }
+  }
+
+  ecma_collection_iterator_t values_iterator;
+  ecma_collection_iterator_init (&values_iterator, values_p);
+
+  for (uint32_t i = 0; i <= index; i++)
+  {
+    bool is_moved = ecma_collection_iterator_next (&values_iterator);
+    JERRY_ASSERT (is_moved);
+  }
+
+  *out_completion_p = ecma_make_normal_completion_value (ecma_copy_value (*values_iterator.current_value_p, true));
+  return true;
+} /* ecma_arguments_try_get_without_materialization */
+
+/**
+ * Get number of arguments of not yet materialized Arguments object
+ *
+ * @return true - if the object is not materialized yet (the number is returned through out_arguments_number_p),
+ *         false - otherwise (the object's properties should be accessed through common [[Get]]).
+ */
+bool
+ecma_op_arguments_object_get_arguments_number (ecma_object_t *obj_p, /**< Arguments object */
+                                               ecma_length_t *out_arguments_number_p) /**< out: number of
+                                                                                       *   arguments */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARGUMENTS);
+
+  ecma_property_t *values_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+
+  if (values_prop_p == NULL)
+  {
+    return false;
+  }
+
+  ecma_collection_header_t *values_p = ECMA_GET_POINTER (ecma_collection_header_t,
+                                                         values_prop_p->u.internal_property.value);
+
+  *out_arguments_number_p = (values_p != NULL ? values_p->unit_number : 0);
+
+  return true;
+} /* ecma_op_arguments_object_get_arguments_number */
+
+/**
+ * Copy values of arguments of not yet materialized Arguments object to the array
+ *
+ * Note:
+ *      values of the arguments, mapped to formal parameters, are read from the parameters' bindings,
+ *      copied values should be freed with ecma_free_value
+ *
+ * See also:
+ *          ecma_op_arguments_object_get_arguments_number
+ */
+void
+ecma_op_arguments_object_copy_arguments (ecma_object_t *obj_p, /**< Arguments object */
+                                         ecma_value_t arg_values[]) /**< out: values of arguments
+                                                                     *   (the array should have space
+                                                                     *   for all the arguments) */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARGUMENTS);
+
+  ecma_property_t *values_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+  ecma_collection_header_t *values_p = ECMA_GET_POINTER (ecma_collection_header_t,
+                                                         values_prop_p->u.internal_property.value);
+
+  ecma_collection_header_t *formal_params_p = NULL;
+  ecma_object_t *lex_env_p = NULL;
+
+  ecma_property_t *scope_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+
+  if (scope_prop_p != NULL)
+  {
+    ecma_property_t *callee_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE);
+    ecma_object_t *func_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                           callee_prop_p->u.internal_property.value);
+
+    formal_params_p = ecma_op_function_get_formal_params (func_obj_p);
+    lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, scope_prop_p->u.internal_property.value);
+  }
+
+  ecma_collection_iterator_t values_iterator;
+  ecma_collection_iterator_init (&values_iterator, values_p);
+
+  for (uint32_t index = 0;
+       ecma_collection_iterator_next (&values_iterator);
+       index++)
+  {
+    ecma_string_t *arg_name_p = ecma_arguments_get_mapped_arg_name (formal_params_p, index);
+
+    if (arg_name_p != NULL)
+    {
+      ecma_completion_value_t completion = ecma_op_get_binding_value (lex_env_p, arg_name_p, true);
+      JERRY_ASSERT (ecma_is_completion_value_normal (completion));
+
+      arg_values[index] = ecma_get_completion_value_value (completion);
+    }
+    else
+    {
+      arg_values[index] = ecma_copy_value (*values_iterator.current_value_p, true);
+    }
+  }
+} /* ecma_op_arguments_object_copy_arguments */
+
+/**
+ * Instantiate properties of not yet materialized Arguments object
+ *
+ * Note:
+ *      after materialization, type of the object is either ECMA_OBJECT_TYPE_ARGUMENTS,
+ *      if some arguments are mapped to formal parameters, or ECMA_OBJECT_TYPE_GENERAL - otherwise
+ *
+ * See also: ECMA-262 v5, 10.6
+ */
+void
+ecma_op_arguments_object_materialize (ecma_object_t *obj_p) /**< the object */
+{
+  ecma_property_t *values_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+
+  if (values_prop_p == NULL)
+  {
+    /* already materialized */
+    return;
+  }
+
+  ecma_collection_header_t *arg_collection_p = ECMA_GET_POINTER (ecma_collection_header_t,
+                                                                 values_prop_p->u.internal_property.value);
+
+  ecma_property_t *callee_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_CALLEE);
+  ecma_object_t *func_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                         callee_prop_p->u.internal_property.value);
+
+  ecma_property_t *scope_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+  const bool is_strict = (scope_prop_p == NULL);
+  ecma_object_t *lex_env_p = NULL;
+
+  if (!is_strict)
+  {
+    lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, scope_prop_p->u.internal_property.value);
+  }
+
+  ecma_collection_header_t *formal_params_p = ecma_op_function_get_formal_params (func_obj_p);
+
+  /*
+   * The properties are defined through operations of general object, so the materialization is not re-entered.
+   *
+   * The internal properties referencing the arguments, the callee and the lexical environment are kept
+   * till end of the materialization, as the objects could be referenced only through them.
+   */
+  ecma_set_object_type (obj_p, ECMA_OBJECT_TYPE_GENERAL);
+
+  const bool is_extensible = ecma_get_object_extensible (obj_p);
+  ecma_set_object_extensible (obj_p, true);
+
   const ecma_length_t arguments_number = arg_collection_p != NULL ? arg_collection_p->unit_number : 0;
 
   // 1.
   ecma_number_t *len_p = ecma_alloc_number ();
   *len_p = ecma_uint32_to_number (arguments_number);
 
-  // 2., 3., 6.
-  ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
-
-  ecma_object_t *obj_p = ecma_create_object (prototype_p, true, ECMA_OBJECT_TYPE_GENERAL);
-
-  ecma_deref_object (prototype_p);
-
   // 4.
   ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
   class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_ARGUMENTS_UL;
@@ -107,6 +487,7 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
   }
 
   ecma_property_descriptor_t prop_desc = ecma_make_empty_property_descriptor ();
+  bool is_mapped = false;
 
   if (formal_params_p != NULL)
   {
@@ -186,7 +567,7 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
       MEM_FINALIZE_LOCAL_ARRAY (formal_params);
 
       // 12.
-      ecma_set_object_type (obj_p, ECMA_OBJECT_TYPE_ARGUMENTS);
+      is_mapped = true;
 
       /*
        * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_ARGUMENTS type.
@@ -264,8 +645,21 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
     ecma_deref_object (thrower_p);
   }
 
-  return obj_p;
-} /* ecma_op_create_arguments_object */
+  ecma_set_object_extensible (obj_p, is_extensible);
+
+  if (scope_prop_p != NULL)
+  {
+    ecma_delete_property (obj_p, scope_prop_p);
+  }
+
+  ecma_delete_property (obj_p, callee_prop_p);
+  ecma_delete_property (obj_p, values_prop_p);
+
+  if (is_mapped)
+  {
+    ecma_set_object_type (obj_p, ECMA_OBJECT_TYPE_ARGUMENTS);
+  }
+} /* ecma_op_arguments_object_materialize */
 
 /**
  * Get value of function's argument mapped to index of Arguments object.
@@ -314,6 +708,25 @@ ecma_completion_value_t
 ecma_op_arguments_object_get (ecma_object_t *obj_p, /**< the object */
                               ecma_string_t *property_name_p) /**< property name */
 {
+  ecma_property_t *values_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+
+  if (values_prop_p != NULL)
+  {
+    ecma_completion_value_t completion;
+
+    if (ecma_arguments_try_get_without_materialization (obj_p, values_prop_p, property_name_p, &completion))
+    {
+      return completion;
+    }
+
+    ecma_op_arguments_object_materialize (obj_p);
+
+    if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+    {
+      return ecma_op_general_object_get (obj_p, property_name_p);
+    }
+  }
+
   // 1.
   ecma_property_t *map_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
   ecma_object_t *map_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
@@ -351,6 +764,13 @@ ecma_property_t*
 ecma_op_arguments_object_get_own_property (ecma_object_t *obj_p, /**< the object */
                                            ecma_string_t *property_name_p) /**< property name */
 {
+  ecma_op_arguments_object_materialize (obj_p);
+
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+  {
+    return ecma_op_general_object_get_own_property (obj_p, property_name_p);
+  }
+
   // 1.
   ecma_property_t *desc_p = ecma_op_general_object_get_own_property (obj_p, property_name_p);
 
@@ -400,6 +820,13 @@ ecma_op_arguments_object_define_own_property (ecma_object_t *obj_p, /**< the obj
                                                                                                   *   descriptor */
                                               bool is_throw) /**< flag that controls failure handling */
 {
+  ecma_op_arguments_object_materialize (obj_p);
+
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+  {
+    return ecma_op_general_object_define_own_property (obj_p, property_name_p, property_desc_p, is_throw);
+  }
+
   // 1.
   ecma_property_t *map_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
   ecma_object_t *map_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
@@ -498,6 +925,13 @@ ecma_op_arguments_object_delete (ecma_object_t *obj_p, /**< the object */
                                  ecma_string_t *property_name_p, /**< property name */
                                  bool is_throw) /**< flag that controls failure handling */
 {
+  ecma_op_arguments_object_materialize (obj_p);
+
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_ARGUMENTS)
+  {
+    return ecma_op_general_object_delete (obj_p, property_name_p, is_throw);
+  }
+
   // 1.
   ecma_property_t *map_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
   ecma_object_t *map_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
@@ -19,9 +19,37 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 
+/**
+ * Description of Arguments object of an active function call, that is not created yet
+ *
+ * See also: ecma_op_arguments_object_defer
+ */
+typedef struct ecma_arguments_deferred_t
+{
+  struct ecma_arguments_deferred_t *prev_p; /**< description for previous active call */
+  ecma_property_t *binding_p; /**< 'arguments' binding of the call's lexical environment */
+  ecma_object_t *func_obj_p; /**< callee function */
+  ecma_object_t *lex_env_p; /**< lexical environment of the call */
+  const ecma_value_t *arguments_list_p; /**< arguments list of the call */
+  ecma_length_t arguments_list_len; /**< length of arguments list */
+  bool is_strict; /**< flag indicating whether strict mode is enabled */
+} ecma_arguments_deferred_t;
+
 extern ecma_object_t *
-ecma_op_create_arguments_object (ecma_object_t *, ecma_object_t *,
-                                 ecma_collection_header_t *, ecma_collection_header_t *, bool);
+ecma_op_create_arguments_object (ecma_object_t *, ecma_object_t *, const ecma_value_t *, ecma_length_t, bool);
+extern void
+ecma_op_arguments_object_defer (ecma_arguments_deferred_t *, ecma_object_t *, ecma_object_t *, ecma_property_t *,
+                                const ecma_value_t *, ecma_length_t, bool);
+extern void
+ecma_op_arguments_object_end_deferral (ecma_arguments_deferred_t *);
+extern bool
+ecma_op_arguments_object_try_create_deferred (ecma_object_t *, ecma_property_t *);
+extern void
+ecma_op_arguments_object_materialize (ecma_object_t *);
+extern bool
+ecma_op_arguments_object_get_arguments_number (ecma_object_t *, ecma_length_t *);
+extern void
+ecma_op_arguments_object_copy_arguments (ecma_object_t *, ecma_value_t[]);
 
 extern ecma_completion_value_t
 ecma_op_arguments_object_get (ecma_object_t *, ecma_string_t *);
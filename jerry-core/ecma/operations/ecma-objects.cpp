@@ -562,6 +562,12 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     ecma_length_t string_named_properties_count = 0;
     ecma_length_t array_index_named_properties_count = 0;
 
+    if (ecma_get_object_type (prototype_chain_iter_p) == ECMA_OBJECT_TYPE_ARGUMENTS)
+    {
+      /* the properties are listed directly from the property list */
+      ecma_op_arguments_object_materialize (prototype_chain_iter_p);
+    }
+
     ecma_collection_header_t *prop_names_p = ecma_new_strings_collection (NULL, 0);
 
     if (ecma_get_object_is_builtin (obj_p))
@@ -1133,6 +1133,924 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
   return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_FALSE); /* fail */
 } /* regexp_match */
 
+/**
+ * Opcodes of the NFA program, which is translated from RegExp bytecode for backtracking-free matching
+ *
+ * Note:
+ *      opcodes up to RE_NFA_OP_MATCH are the ones, at which a thread of the NFA matcher can wait for next character;
+ *      second argument of the opcodes, preceding RE_NFA_OP_MATCH, is index of the instruction to continue at,
+ *      after the character is matched
+ */
+typedef enum
+{
+  RE_NFA_OP_CHAR, /**< match a character (argument: canonicalized character) */
+  RE_NFA_OP_PERIOD, /**< match any character, except line terminators */
+  RE_NFA_OP_CHAR_CLASS, /**< match a character class (argument: offset of the ranges in the bytecode) */
+  RE_NFA_OP_INV_CHAR_CLASS, /**< match an inverted character class (argument: offset of the ranges in the bytecode) */
+  RE_NFA_OP_MATCH, /**< report a match */
+  RE_NFA_OP_ASSERT_START, /**< assert start of input (or line, in multiline mode) */
+  RE_NFA_OP_ASSERT_END, /**< assert end of input (or line, in multiline mode) */
+  RE_NFA_OP_ASSERT_WORD_BOUNDARY, /**< assert word boundary */
+  RE_NFA_OP_ASSERT_NOT_WORD_BOUNDARY, /**< assert not a word boundary */
+  RE_NFA_OP_SAVE, /**< save current position (argument: index in saved positions) */
+  RE_NFA_OP_RESET, /**< reset saved position to undefined (argument: index in saved positions) */
+  RE_NFA_OP_JUMP, /**< continue at other instruction (argument: index of the instruction) */
+  RE_NFA_OP_SPLIT, /**< continue at first argument's instruction and, with lower priority, at second one's */
+  RE_NFA_OP_FAIL /**< terminate the thread */
+} re_nfa_opcode_t;
+
+/**
+ * Invalid NFA instruction index
+ */
+#define RE_NFA_INVALID_INSTR_IDX UINT32_MAX
+
+/**
+ * Instruction of the NFA program
+ */
+typedef struct
+{
+  uint32_t arg1; /**< first argument */
+  uint32_t arg2; /**< second argument (target with lower priority for RE_NFA_OP_SPLIT) */
+  uint8_t op; /**< opcode (re_nfa_opcode_t) */
+} re_nfa_instr_t;
+
+/**
+ * Context of translation of RegExp bytecode to NFA program
+ */
+typedef struct
+{
+  re_nfa_instr_t *instrs_p; /**< NFA program */
+  uint32_t instrs_count; /**< number of instructions in the program */
+  uint32_t threads_count; /**< number of instructions, at which a thread can wait for next character */
+  re_bytecode_t *bc_start_p; /**< start of RegExp bytecode */
+  bool is_supported; /**< false - if the bytecode can't be matched without backtracking
+                      *   (backreference, lookahead, too large program) */
+} re_nfa_compiler_ctx_t;
+
+/**
+ * Append an instruction to the NFA program
+ *
+ * @return index of the instruction
+ */
+static uint32_t
+re_nfa_emit (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+             re_nfa_opcode_t op, /**< opcode */
+             uint32_t arg1, /**< first argument */
+             uint32_t arg2) /**< second argument */
+{
+  if (nfa_ctx_p->instrs_count >= CONFIG_ECMA_REGEXP_NFA_MAX_INSTRS)
+  {
+    nfa_ctx_p->is_supported = false;
+    return 0;
+  }
+
+  uint32_t idx = nfa_ctx_p->instrs_count++;
+
+  if (op < RE_NFA_OP_MATCH)
+  {
+    arg2 = idx + 1;
+  }
+
+  nfa_ctx_p->instrs_p[idx].op = (uint8_t) op;
+  nfa_ctx_p->instrs_p[idx].arg1 = arg1;
+  nfa_ctx_p->instrs_p[idx].arg2 = arg2;
+
+  if (op <= RE_NFA_OP_MATCH)
+  {
+    nfa_ctx_p->threads_count++;
+  }
+
+  return idx;
+} /* re_nfa_emit */
+
+/**
+ * Set targets of a split instruction, that either enters an iteration (at the next instruction), or skips it
+ */
+static void
+re_nfa_set_iteration_split (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                            uint32_t split_idx, /**< index of RE_NFA_OP_SPLIT instruction */
+                            uint32_t exit_idx, /**< index of instruction after the iteration */
+                            bool is_greedy) /**< iterate with higher priority than skip */
+{
+  re_nfa_instr_t *instr_p = nfa_ctx_p->instrs_p + split_idx;
+
+  JERRY_ASSERT (instr_p->op == RE_NFA_OP_SPLIT);
+
+  instr_p->arg1 = is_greedy ? split_idx + 1 : exit_idx;
+  instr_p->arg2 = is_greedy ? exit_idx : split_idx + 1;
+} /* re_nfa_set_iteration_split */
+
+/**
+ * Get end of alternatives in RegExp bytecode
+ *
+ * @return pointer to the opcode after the last alternative
+ */
+static re_bytecode_t *
+re_nfa_skip_alternatives (re_bytecode_t *bc_p) /**< pointer to offset of the first alternative */
+{
+  while (true)
+  {
+    uint32_t offset = re_get_value (&bc_p);
+    bc_p += offset;
+
+    if (*bc_p != RE_OP_ALTERNATIVE)
+    {
+      return bc_p;
+    }
+
+    bc_p++;
+  }
+} /* re_nfa_skip_alternatives */
+
+static bool
+re_nfa_compile_alternatives (re_nfa_compiler_ctx_t *, re_bytecode_t **);
+
+static bool
+re_nfa_compile_sequence (re_nfa_compiler_ctx_t *, re_bytecode_t *, re_bytecode_t *);
+
+/**
+ * Translate one iteration of a group, or of a simple iterator's atom to NFA instructions
+ *
+ * Captures, nested into a group, are reset at start of each iteration (see also: ECMA-262 v5, 15.10.2.5,
+ * RepeatMatcher, step 4). Their indices are known only after the group is translated, so the iteration
+ * is entered through a jump to the resetting instructions, which are placed after the group's instructions.
+ *
+ * @return true - if the iteration can match empty string,
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_iteration (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                          re_bytecode_t *bc_p, /**< group's alternatives, or atom's bytecode */
+                          re_bytecode_t *end_p, /**< end of atom's bytecode, or NULL - for groups */
+                          uint32_t capture_start_idx) /**< index of capture start in saved positions,
+                                                       *   or 0 - for non-capture groups and atoms */
+{
+  bool is_nullable;
+  uint32_t entry_jump_idx = RE_NFA_INVALID_INSTR_IDX;
+
+  if (end_p == NULL)
+  {
+    entry_jump_idx = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, 0, 0);
+  }
+
+  uint32_t body_start_idx = nfa_ctx_p->instrs_count;
+
+  if (capture_start_idx != 0)
+  {
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, capture_start_idx, 0);
+  }
+
+  if (end_p == NULL)
+  {
+    is_nullable = re_nfa_compile_alternatives (nfa_ctx_p, &bc_p);
+  }
+  else
+  {
+    is_nullable = re_nfa_compile_sequence (nfa_ctx_p, bc_p, end_p);
+  }
+
+  if (capture_start_idx != 0)
+  {
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, capture_start_idx + 1, 0);
+  }
+
+  if (entry_jump_idx == RE_NFA_INVALID_INSTR_IDX || !nfa_ctx_p->is_supported)
+  {
+    return is_nullable;
+  }
+
+  /* Nested captures are numbered consecutively, so the range of their saved positions is reset. */
+  uint32_t nested_start_idx = UINT32_MAX;
+  uint32_t nested_end_idx = 0;
+
+  for (uint32_t idx = body_start_idx; idx < nfa_ctx_p->instrs_count; idx++)
+  {
+    const re_nfa_instr_t *instr_p = nfa_ctx_p->instrs_p + idx;
+
+    if (instr_p->op == RE_NFA_OP_SAVE
+        && instr_p->arg1 != capture_start_idx
+        && instr_p->arg1 != capture_start_idx + 1)
+    {
+      nested_start_idx = JERRY_MIN (nested_start_idx, instr_p->arg1);
+      nested_end_idx = JERRY_MAX (nested_end_idx, instr_p->arg1 + 1);
+    }
+  }
+
+  if (nested_start_idx >= nested_end_idx)
+  {
+    nfa_ctx_p->instrs_p[entry_jump_idx].arg1 = body_start_idx;
+    return is_nullable;
+  }
+
+  uint32_t exit_jump_idx = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, 0, 0);
+  uint32_t reset_start_idx = nfa_ctx_p->instrs_count;
+
+  for (uint32_t saved_idx = nested_start_idx; saved_idx < nested_end_idx; saved_idx++)
+  {
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_RESET, saved_idx, 0);
+  }
+
+  re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, body_start_idx, 0);
+
+  if (nfa_ctx_p->is_supported)
+  {
+    nfa_ctx_p->instrs_p[entry_jump_idx].arg1 = reset_start_idx;
+    nfa_ctx_p->instrs_p[exit_jump_idx].arg1 = nfa_ctx_p->instrs_count;
+  }
+
+  return is_nullable;
+} /* re_nfa_compile_iteration */
+
+/**
+ * Translate one iteration of a group, which must not match empty string, to NFA instructions
+ *
+ * The backtracking matcher rejects iterations above the minimum, that match empty string (see also:
+ * ECMA-262 v5, 15.10.2.5, RepeatMatcher, step 2.b). If the group can match empty string, it is translated twice:
+ * the first copy is followed until a character is matched, then the thread continues in the second copy.
+ * Reaching the end of the first copy terminates the thread.
+ */
+static void
+re_nfa_compile_non_empty_iteration (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                                    re_bytecode_t *bc_p, /**< group's alternatives, or atom's bytecode */
+                                    re_bytecode_t *end_p, /**< end of atom's bytecode, or NULL - for groups */
+                                    uint32_t capture_start_idx) /**< index of capture start in saved positions,
+                                                                 *   or 0 */
+{
+  uint32_t start_idx = nfa_ctx_p->instrs_count;
+
+  if (!re_nfa_compile_iteration (nfa_ctx_p, bc_p, end_p, capture_start_idx))
+  {
+    return;
+  }
+
+  uint32_t copy_size = nfa_ctx_p->instrs_count - start_idx;
+
+  re_nfa_emit (nfa_ctx_p, RE_NFA_OP_FAIL, 0, 0);
+  re_nfa_compile_iteration (nfa_ctx_p, bc_p, end_p, capture_start_idx);
+
+  if (!nfa_ctx_p->is_supported)
+  {
+    return;
+  }
+
+  JERRY_ASSERT (nfa_ctx_p->instrs_count - start_idx == 2 * copy_size + 1);
+
+  for (uint32_t idx = start_idx; idx < start_idx + copy_size; idx++)
+  {
+    if (nfa_ctx_p->instrs_p[idx].op < RE_NFA_OP_MATCH)
+    {
+      nfa_ctx_p->instrs_p[idx].arg2 += copy_size + 1;
+    }
+  }
+} /* re_nfa_compile_non_empty_iteration */
+
+/**
+ * Translate an iterated group, or simple iterator to NFA instructions
+ *
+ * Counted iterations are unrolled, so NFA threads don't need iteration counters.
+ *
+ * @return true - if the iterated term can match empty string,
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_repeat (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                       re_bytecode_t *bc_p, /**< group's alternatives, or atom's bytecode */
+                       re_bytecode_t *end_p, /**< end of atom's bytecode, or NULL - for groups */
+                       uint32_t capture_start_idx, /**< index of capture start in saved positions, or 0 */
+                       uint32_t min, /**< minimum number of iterations */
+                       uint32_t max, /**< maximum number of iterations */
+                       bool is_greedy) /**< type of iteration */
+{
+  bool is_nullable = (min == 0);
+  uint32_t iter_num;
+
+  for (iter_num = 0; iter_num < min && nfa_ctx_p->is_supported; iter_num++)
+  {
+    is_nullable = re_nfa_compile_iteration (nfa_ctx_p, bc_p, end_p, capture_start_idx);
+  }
+
+  if (max == RE_ITERATOR_INFINITE)
+  {
+    uint32_t split_idx = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, 0, 0);
+    re_nfa_compile_non_empty_iteration (nfa_ctx_p, bc_p, end_p, capture_start_idx);
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, split_idx, 0);
+
+    if (nfa_ctx_p->is_supported)
+    {
+      re_nfa_set_iteration_split (nfa_ctx_p, split_idx, nfa_ctx_p->instrs_count, is_greedy);
+    }
+  }
+  else
+  {
+    /* Optional iterations are chained through second argument of their split instructions, until patched. */
+    uint32_t last_split_idx = RE_NFA_INVALID_INSTR_IDX;
+
+    for (; iter_num < max && nfa_ctx_p->is_supported; iter_num++)
+    {
+      last_split_idx = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, 0, last_split_idx);
+      re_nfa_compile_non_empty_iteration (nfa_ctx_p, bc_p, end_p, capture_start_idx);
+    }
+
+    while (nfa_ctx_p->is_supported && last_split_idx != RE_NFA_INVALID_INSTR_IDX)
+    {
+      uint32_t prev_split_idx = nfa_ctx_p->instrs_p[last_split_idx].arg2;
+      re_nfa_set_iteration_split (nfa_ctx_p, last_split_idx, nfa_ctx_p->instrs_count, is_greedy);
+      last_split_idx = prev_split_idx;
+    }
+  }
+
+  return is_nullable;
+} /* re_nfa_compile_repeat */
+
+/**
+ * Translate RegExp bytecode of a sequence of terms to NFA instructions
+ *
+ * @return true - if the sequence can match empty string,
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_sequence (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                         re_bytecode_t *bc_p, /**< start of the sequence */
+                         re_bytecode_t *end_p) /**< end of the sequence */
+{
+  bool is_nullable = true;
+
+  while (bc_p < end_p && nfa_ctx_p->is_supported)
+  {
+    re_opcode_t op = re_get_opcode (&bc_p);
+
+    switch (op)
+    {
+      case RE_OP_CHAR:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_CHAR, re_get_value (&bc_p), 0);
+        is_nullable = false;
+        break;
+      }
+      case RE_OP_PERIOD:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_PERIOD, 0, 0);
+        is_nullable = false;
+        break;
+      }
+      case RE_OP_CHAR_CLASS:
+      case RE_OP_INV_CHAR_CLASS:
+      {
+        uint32_t ranges_offset = (uint32_t) (bc_p - nfa_ctx_p->bc_start_p);
+        uint32_t num_of_ranges = re_get_value (&bc_p);
+        bc_p += num_of_ranges * 2 * sizeof (uint32_t);
+
+        re_nfa_emit (nfa_ctx_p,
+                     (op == RE_OP_CHAR_CLASS) ? RE_NFA_OP_CHAR_CLASS : RE_NFA_OP_INV_CHAR_CLASS,
+                     ranges_offset,
+                     0);
+        is_nullable = false;
+        break;
+      }
+      case RE_OP_ASSERT_START:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_ASSERT_START, 0, 0);
+        break;
+      }
+      case RE_OP_ASSERT_END:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_ASSERT_END, 0, 0);
+        break;
+      }
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_ASSERT_WORD_BOUNDARY, 0, 0);
+        break;
+      }
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        re_nfa_emit (nfa_ctx_p, RE_NFA_OP_ASSERT_NOT_WORD_BOUNDARY, 0, 0);
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_NON_GREEDY_ITERATOR:
+      {
+        uint32_t min = re_get_value (&bc_p);
+        uint32_t max = re_get_value (&bc_p);
+        uint32_t offset = re_get_value (&bc_p);
+
+        /* The atom's bytecode is terminated with RE_OP_MATCH. */
+        re_bytecode_t *atom_end_p = bc_p + offset - sizeof (re_bytecode_t);
+        JERRY_ASSERT (*atom_end_p == RE_OP_MATCH);
+
+        if (!re_nfa_compile_repeat (nfa_ctx_p, bc_p, atom_end_p, 0, min, max, op == RE_OP_GREEDY_ITERATOR))
+        {
+          is_nullable = false;
+        }
+
+        bc_p += offset;
+        break;
+      }
+      case RE_OP_CAPTURE_GROUP_START:
+      case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_GROUP_START:
+      case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
+      case RE_OP_NON_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+      {
+        uint32_t group_idx = re_get_value (&bc_p);
+
+        if (op != RE_OP_CAPTURE_GROUP_START
+            && op != RE_OP_NON_CAPTURE_GROUP_START)
+        {
+          re_get_value (&bc_p); /* end offset */
+        }
+
+        /* Iteration limits of the group are stored in its end opcode. */
+        re_bytecode_t *alternatives_p = bc_p;
+        bc_p = re_nfa_skip_alternatives (bc_p);
+
+        re_opcode_t end_op = re_get_opcode (&bc_p);
+        re_get_value (&bc_p); /* group index */
+        uint32_t min = re_get_value (&bc_p);
+        uint32_t max = re_get_value (&bc_p);
+        re_get_value (&bc_p); /* start offset */
+
+        JERRY_ASSERT (end_op >= RE_OP_CAPTURE_GREEDY_GROUP_END && end_op <= RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END);
+        bool is_greedy = (end_op == RE_OP_CAPTURE_GREEDY_GROUP_END || end_op == RE_OP_NON_CAPTURE_GREEDY_GROUP_END);
+        uint32_t capture_start_idx = RE_IS_CAPTURE_GROUP (op) ? group_idx * 2 : 0;
+
+        if (!re_nfa_compile_repeat (nfa_ctx_p, alternatives_p, NULL, capture_start_idx, min, max, is_greedy))
+        {
+          is_nullable = false;
+        }
+        break;
+      }
+      default:
+      {
+        /* Backreferences and lookaheads need backtracking. */
+        nfa_ctx_p->is_supported = false;
+        break;
+      }
+    }
+  }
+
+  return is_nullable;
+} /* re_nfa_compile_sequence */
+
+/**
+ * Translate RegExp bytecode of alternatives to NFA instructions
+ *
+ * @return true - if any of the alternatives can match empty string,
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_alternatives (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                             re_bytecode_t **bc_p) /**< in: pointer to offset of the first alternative,
+                                                    *   out: pointer to the opcode after the last alternative */
+{
+  bool is_nullable = false;
+  re_bytecode_t *curr_p = *bc_p;
+
+  /* Jumps to the end of the alternatives are chained through their argument, until patched. */
+  uint32_t last_jump_idx = RE_NFA_INVALID_INSTR_IDX;
+
+  while (nfa_ctx_p->is_supported)
+  {
+    uint32_t offset = re_get_value (&curr_p);
+    re_bytecode_t *alternative_end_p = curr_p + offset;
+    bool is_last = (*alternative_end_p != RE_OP_ALTERNATIVE);
+    uint32_t split_idx = 0;
+
+    if (!is_last)
+    {
+      split_idx = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SPLIT, nfa_ctx_p->instrs_count + 1, 0);
+    }
+
+    if (re_nfa_compile_sequence (nfa_ctx_p, curr_p, alternative_end_p))
+    {
+      is_nullable = true;
+    }
+
+    curr_p = alternative_end_p;
+
+    if (is_last)
+    {
+      break;
+    }
+
+    last_jump_idx = re_nfa_emit (nfa_ctx_p, RE_NFA_OP_JUMP, last_jump_idx, 0);
+    nfa_ctx_p->instrs_p[split_idx].arg2 = nfa_ctx_p->instrs_count;
+    curr_p++; /* RE_OP_ALTERNATIVE */
+  }
+
+  while (nfa_ctx_p->is_supported && last_jump_idx != RE_NFA_INVALID_INSTR_IDX)
+  {
+    uint32_t prev_jump_idx = nfa_ctx_p->instrs_p[last_jump_idx].arg1;
+    nfa_ctx_p->instrs_p[last_jump_idx].arg1 = nfa_ctx_p->instrs_count;
+    last_jump_idx = prev_jump_idx;
+  }
+
+  *bc_p = curr_p;
+  return is_nullable;
+} /* re_nfa_compile_alternatives */
+
+/**
+ * Translate RegExp bytecode to NFA program
+ *
+ * @return true - if the bytecode can be matched by the NFA matcher,
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile (re_nfa_compiler_ctx_t *nfa_ctx_p, /**< NFA compiler context */
+                re_bytecode_t *bc_p) /**< RegExp bytecode (after the header) */
+{
+  nfa_ctx_p->instrs_count = 0;
+  nfa_ctx_p->threads_count = 0;
+  nfa_ctx_p->bc_start_p = bc_p;
+  nfa_ctx_p->is_supported = (re_get_opcode (&bc_p) == RE_OP_SAVE_AT_START);
+
+  if (nfa_ctx_p->is_supported)
+  {
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, RE_GLOBAL_START_IDX, 0);
+    re_nfa_compile_alternatives (nfa_ctx_p, &bc_p);
+  }
+
+  if (nfa_ctx_p->is_supported)
+  {
+    nfa_ctx_p->is_supported = (re_get_opcode (&bc_p) == RE_OP_SAVE_AND_MATCH);
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_SAVE, RE_GLOBAL_END_IDX, 0);
+    re_nfa_emit (nfa_ctx_p, RE_NFA_OP_MATCH, 0, 0);
+  }
+
+  return nfa_ctx_p->is_supported;
+} /* re_nfa_compile */
+
+/**
+ * List of NFA matcher threads, ordered by priority
+ */
+typedef struct
+{
+  uint32_t *instr_idx_p; /**< instruction index of each thread */
+  lit_utf8_byte_t **saved_p; /**< saved positions of each thread */
+  uint32_t count; /**< number of threads */
+} re_nfa_thread_list_t;
+
+/**
+ * Entry of the NFA matcher's stack, used for following instructions, which don't wait for next character
+ */
+typedef struct
+{
+  lit_utf8_byte_t *saved_p; /**< saved position to restore */
+  uint32_t idx; /**< index of instruction to follow, or index of saved position to restore */
+  bool is_restore; /**< true - if the entry restores a saved position, false - if it continues at an instruction */
+} re_nfa_stack_entry_t;
+
+/**
+ * Context of NFA matcher
+ */
+typedef struct
+{
+  re_matcher_ctx_t *re_ctx_p; /**< RegExp matcher context */
+  const re_nfa_instr_t *instrs_p; /**< NFA program */
+  uint32_t *visit_marks_p; /**< for each instruction: generation, in which it was last followed */
+  uint32_t generation; /**< current generation (incremented on each input character) */
+  re_nfa_stack_entry_t *stack_p; /**< stack */
+  lit_utf8_byte_t **work_saved_p; /**< saved positions of the thread being followed */
+} re_nfa_matcher_ctx_t;
+
+/**
+ * Check an assertion of the NFA program at the current input position
+ *
+ * @return true - if the assertion holds,
+ *         false - otherwise
+ */
+static bool
+re_nfa_check_assertion (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                        re_nfa_opcode_t op, /**< assertion opcode */
+                        lit_utf8_byte_t *str_p) /**< current input position */
+{
+  bool is_multiline = (re_ctx_p->flags & RE_FLAG_MULTILINE) != 0;
+
+  switch (op)
+  {
+    case RE_NFA_OP_ASSERT_START:
+    {
+      return (str_p <= re_ctx_p->input_start_p
+              || (is_multiline && lit_char_is_line_terminator (lit_utf8_peek_prev (str_p))));
+    }
+    case RE_NFA_OP_ASSERT_END:
+    {
+      return (str_p >= re_ctx_p->input_end_p
+              || (is_multiline && lit_char_is_line_terminator (lit_utf8_peek_next (str_p))));
+    }
+    default:
+    {
+      JERRY_ASSERT (op == RE_NFA_OP_ASSERT_WORD_BOUNDARY || op == RE_NFA_OP_ASSERT_NOT_WORD_BOUNDARY);
+
+      bool is_wordchar_left = (str_p > re_ctx_p->input_start_p
+                               && lit_char_is_word_char (lit_utf8_peek_prev (str_p)));
+      bool is_wordchar_right = (str_p < re_ctx_p->input_end_p
+                                && lit_char_is_word_char (lit_utf8_peek_next (str_p)));
+
+      return ((is_wordchar_left != is_wordchar_right) == (op == RE_NFA_OP_ASSERT_WORD_BOUNDARY));
+    }
+  }
+} /* re_nfa_check_assertion */
+
+/**
+ * Check whether an instruction of the NFA program, which waits for next character, accepts the character
+ *
+ * @return true - if the character is accepted,
+ *         false - otherwise
+ */
+static bool
+re_nfa_match_char (const re_nfa_instr_t *instr_p, /**< instruction */
+                   re_bytecode_t *bc_start_p, /**< start of RegExp bytecode */
+                   ecma_char_t ch, /**< input character */
+                   bool is_ignorecase) /**< IgnoreCase flag */
+{
+  switch (instr_p->op)
+  {
+    case RE_NFA_OP_CHAR:
+    {
+      return (instr_p->arg1 == re_canonicalize (ch, is_ignorecase));
+    }
+    case RE_NFA_OP_PERIOD:
+    {
+      return !lit_char_is_line_terminator (ch);
+    }
+    case RE_NFA_OP_CHAR_CLASS:
+    case RE_NFA_OP_INV_CHAR_CLASS:
+    {
+      re_bytecode_t *bc_p = bc_start_p + instr_p->arg1;
+      uint32_t num_of_ranges = re_get_value (&bc_p);
+      ecma_char_t curr_ch = re_canonicalize (ch, is_ignorecase);
+      bool is_match = false;
+
+      while (num_of_ranges-- && !is_match)
+      {
+        ecma_char_t ch1 = re_canonicalize ((ecma_char_t) re_get_value (&bc_p), is_ignorecase);
+        ecma_char_t ch2 = re_canonicalize ((ecma_char_t) re_get_value (&bc_p), is_ignorecase);
+
+        is_match = (curr_ch >= ch1 && curr_ch <= ch2);
+      }
+
+      return (is_match == (instr_p->op == RE_NFA_OP_CHAR_CLASS));
+    }
+    default:
+    {
+      JERRY_ASSERT (instr_p->op == RE_NFA_OP_MATCH);
+      return false;
+    }
+  }
+} /* re_nfa_match_char */
+
+/**
+ * Add a thread to the list, following the instructions, which don't wait for next character
+ *
+ * Instructions, which are already followed in the current generation, are skipped, because a thread with
+ * higher priority has already reached them at the same input position.
+ */
+static void
+re_nfa_add_thread (re_nfa_matcher_ctx_t *nfa_ctx_p, /**< NFA matcher context */
+                   re_nfa_thread_list_t *list_p, /**< thread list */
+                   uint32_t instr_idx, /**< instruction to continue at */
+                   lit_utf8_byte_t **saved_p, /**< saved positions of the thread,
+                                               *   or NULL - to start a new thread */
+                   lit_utf8_byte_t *str_p) /**< current input position */
+{
+  uint32_t num_of_saved = nfa_ctx_p->re_ctx_p->num_of_captures;
+  lit_utf8_byte_t **work_saved_p = nfa_ctx_p->work_saved_p;
+
+  for (uint32_t i = 0; i < num_of_saved; i++)
+  {
+    work_saved_p[i] = (saved_p != NULL) ? saved_p[i] : NULL;
+  }
+
+  uint32_t stack_top = 0;
+  nfa_ctx_p->stack_p[stack_top].idx = instr_idx;
+  nfa_ctx_p->stack_p[stack_top].is_restore = false;
+  stack_top++;
+
+  while (stack_top > 0)
+  {
+    re_nfa_stack_entry_t entry = nfa_ctx_p->stack_p[--stack_top];
+
+    if (entry.is_restore)
+    {
+      work_saved_p[entry.idx] = entry.saved_p;
+      continue;
+    }
+
+    uint32_t idx = entry.idx;
+    bool is_alive = true;
+
+    while (is_alive && nfa_ctx_p->visit_marks_p[idx] != nfa_ctx_p->generation)
+    {
+      const re_nfa_instr_t *instr_p = nfa_ctx_p->instrs_p + idx;
+      nfa_ctx_p->visit_marks_p[idx] = nfa_ctx_p->generation;
+
+      switch (instr_p->op)
+      {
+        case RE_NFA_OP_JUMP:
+        {
+          idx = instr_p->arg1;
+          break;
+        }
+        case RE_NFA_OP_SPLIT:
+        {
+          nfa_ctx_p->stack_p[stack_top].idx = instr_p->arg2;
+          nfa_ctx_p->stack_p[stack_top].is_restore = false;
+          stack_top++;
+
+          idx = instr_p->arg1;
+          break;
+        }
+        case RE_NFA_OP_SAVE:
+        case RE_NFA_OP_RESET:
+        {
+          nfa_ctx_p->stack_p[stack_top].saved_p = work_saved_p[instr_p->arg1];
+          nfa_ctx_p->stack_p[stack_top].idx = instr_p->arg1;
+          nfa_ctx_p->stack_p[stack_top].is_restore = true;
+          stack_top++;
+
+          work_saved_p[instr_p->arg1] = (instr_p->op == RE_NFA_OP_SAVE) ? str_p : NULL;
+          idx++;
+          break;
+        }
+        case RE_NFA_OP_ASSERT_START:
+        case RE_NFA_OP_ASSERT_END:
+        case RE_NFA_OP_ASSERT_WORD_BOUNDARY:
+        case RE_NFA_OP_ASSERT_NOT_WORD_BOUNDARY:
+        {
+          is_alive = re_nfa_check_assertion (nfa_ctx_p->re_ctx_p, (re_nfa_opcode_t) instr_p->op, str_p);
+          idx++;
+          break;
+        }
+        case RE_NFA_OP_FAIL:
+        {
+          is_alive = false;
+          break;
+        }
+        default:
+        {
+          JERRY_ASSERT (instr_p->op <= RE_NFA_OP_MATCH);
+
+          list_p->instr_idx_p[list_p->count] = idx;
+          memcpy (list_p->saved_p + list_p->count * num_of_saved,
+                  work_saved_p,
+                  num_of_saved * sizeof (lit_utf8_byte_t *));
+          list_p->count++;
+
+          is_alive = false;
+          break;
+        }
+      }
+    }
+  }
+} /* re_nfa_add_thread */
+
+/**
+ * Backtracking-free RegExp matching
+ *
+ * The RegExp bytecode is translated to an NFA program, which is simulated by advancing all matching threads over
+ * the input in lockstep, in order of their priority (Pike VM). The first match is searched starting from every
+ * position of the input at once, so the running time is linear in the length of the input.
+ *
+ * @return true - if the bytecode is supported by the NFA matcher (match result, out_str_p and
+ *                saved positions of the RegExp matcher context are set),
+ *         false - otherwise (the bytecode should be matched by the backtracking matcher)
+ */
+static bool
+re_nfa_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                     re_bytecode_t *bc_p, /**< RegExp bytecode (after the header) */
+                     lit_utf8_byte_t *str_p, /**< input string pointer to start matching from */
+                     lit_utf8_byte_t **out_str_p, /**< Output: end of the matching substring */
+                     bool *is_match_p) /**< Output: match result */
+{
+  bool is_supported;
+
+  MEM_DEFINE_LOCAL_ARRAY (instrs_p, CONFIG_ECMA_REGEXP_NFA_MAX_INSTRS, re_nfa_instr_t);
+
+  re_nfa_compiler_ctx_t nfa_compiler_ctx;
+  nfa_compiler_ctx.instrs_p = instrs_p;
+  is_supported = re_nfa_compile (&nfa_compiler_ctx, bc_p);
+
+  uint32_t instrs_count = nfa_compiler_ctx.instrs_count;
+  uint32_t threads_count = nfa_compiler_ctx.threads_count;
+  uint32_t num_of_saved = re_ctx_p->num_of_captures;
+
+  if (is_supported && threads_count * num_of_saved > CONFIG_ECMA_REGEXP_NFA_MAX_SAVED_POSITIONS)
+  {
+    is_supported = false;
+  }
+
+  if (is_supported)
+  {
+    JERRY_DDLOG ("NFA matching: %d instructions, %d threads\n", instrs_count, threads_count);
+
+    /* Two thread lists, and saved positions of the currently followed thread. */
+    MEM_DEFINE_LOCAL_ARRAY (saved_buffer_p, (2 * threads_count + 1) * num_of_saved, lit_utf8_byte_t *);
+    /* Visit marks of instructions, and instruction indices of both thread lists. */
+    MEM_DEFINE_LOCAL_ARRAY (idx_buffer_p, instrs_count + 2 * threads_count, uint32_t);
+    MEM_DEFINE_LOCAL_ARRAY (stack_p, instrs_count + 1, re_nfa_stack_entry_t);
+
+    re_nfa_matcher_ctx_t nfa_ctx;
+    nfa_ctx.re_ctx_p = re_ctx_p;
+    nfa_ctx.instrs_p = instrs_p;
+    nfa_ctx.visit_marks_p = idx_buffer_p;
+    nfa_ctx.generation = 1;
+    nfa_ctx.stack_p = stack_p;
+    nfa_ctx.work_saved_p = saved_buffer_p + 2 * threads_count * num_of_saved;
+
+    for (uint32_t i = 0; i < instrs_count; i++)
+    {
+      nfa_ctx.visit_marks_p[i] = 0;
+    }
+
+    re_nfa_thread_list_t lists[2];
+    re_nfa_thread_list_t *curr_list_p = lists;
+    re_nfa_thread_list_t *next_list_p = lists + 1;
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      lists[i].instr_idx_p = idx_buffer_p + instrs_count + i * threads_count;
+      lists[i].saved_p = saved_buffer_p + i * threads_count * num_of_saved;
+      lists[i].count = 0;
+    }
+
+    bool is_ignorecase = (re_ctx_p->flags & RE_FLAG_IGNORE_CASE) != 0;
+    lit_utf8_byte_t *str_curr_p = str_p;
+    *is_match_p = false;
+
+    while (true)
+    {
+      if (!*is_match_p)
+      {
+        /* Start matching at the current position, with lower priority than the already running threads. */
+        re_nfa_add_thread (&nfa_ctx, curr_list_p, 0, NULL, str_curr_p);
+      }
+
+      bool is_input_end = (str_curr_p >= re_ctx_p->input_end_p);
+
+      if (curr_list_p->count == 0 && (*is_match_p || is_input_end))
+      {
+        break;
+      }
+
+      lit_utf8_byte_t *str_next_p = str_curr_p;
+      ecma_char_t ch = 0;
+
+      if (!is_input_end)
+      {
+        ch = lit_utf8_read_next (&str_next_p);
+      }
+
+      nfa_ctx.generation++;
+      next_list_p->count = 0;
+
+      for (uint32_t i = 0; i < curr_list_p->count; i++)
+      {
+        const re_nfa_instr_t *instr_p = instrs_p + curr_list_p->instr_idx_p[i];
+        lit_utf8_byte_t **thread_saved_p = curr_list_p->saved_p + i * num_of_saved;
+
+        if (instr_p->op == RE_NFA_OP_MATCH)
+        {
+          *is_match_p = true;
+          memcpy (re_ctx_p->saved_p, thread_saved_p, num_of_saved * sizeof (lit_utf8_byte_t *));
+
+          /* Threads with lower priority are cut off. */
+          break;
+        }
+
+        if (!is_input_end && re_nfa_match_char (instr_p, nfa_compiler_ctx.bc_start_p, ch, is_ignorecase))
+        {
+          re_nfa_add_thread (&nfa_ctx, next_list_p, instr_p->arg2, thread_saved_p, str_next_p);
+        }
+      }
+
+      if (is_input_end)
+      {
+        break;
+      }
+
+      re_nfa_thread_list_t *list_p = curr_list_p;
+      curr_list_p = next_list_p;
+      next_list_p = list_p;
+      str_curr_p = str_next_p;
+    }
+
+    if (*is_match_p)
+    {
+      *out_str_p = re_ctx_p->saved_p[RE_GLOBAL_END_IDX];
+    }
+
+    MEM_FINALIZE_LOCAL_ARRAY (stack_p);
+    MEM_FINALIZE_LOCAL_ARRAY (idx_buffer_p);
+    MEM_FINALIZE_LOCAL_ARRAY (saved_buffer_p);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (instrs_p);
+
+  return is_supported;
+} /* re_nfa_match_regexp */
+
 /**
  * Define the necessary properties for the result array (index, input, length).
  */
@@ -1302,7 +2220,23 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
   /* 2. Try to match */
   lit_utf8_byte_t *sub_str_p = NULL;
 
-  while (ecma_is_completion_value_empty (ret_value))
+  /*
+   * Patterns, which don't need backtracking, are matched in linear time by the NFA matcher. Empty input
+   * is represented by a pointer outside of the input buffer, so it is left to the backtracking matcher.
+   */
+  bool is_nfa_supported = (ecma_is_completion_value_empty (ret_value)
+                           && input_string_size > 0
+                           && index >= 0
+                           && index <= (int32_t) input_str_len
+                           && re_nfa_match_regexp (&re_ctx, bc_p, input_curr_p, &sub_str_p, &is_match));
+
+  if (is_nfa_supported && is_match)
+  {
+    index += (int32_t) lit_utf8_string_length (input_curr_p,
+                                               (lit_utf8_size_t) (re_ctx.saved_p[RE_GLOBAL_START_IDX] - input_curr_p));
+  }
+
+  while (ecma_is_completion_value_empty (ret_value) && !is_nfa_supported)
   {
     if (index < 0 || index > (int32_t) input_str_len)
     {
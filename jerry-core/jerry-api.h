@@ -40,6 +40,7 @@ typedef enum
   JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION      = 1, /**< exception occured and it was not handled */
   JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION = 2, /**< snapshot version mismatch */
   JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT  = 3, /**< snapshot format is not valid */
+  JERRY_COMPLETION_CODE_SNAPSHOT_ENTRY_NOT_FOUND = 4, /**< no entry with specified name in snapshot bundle */
 } jerry_completion_code_t;
 
 /**
@@ -72,6 +73,19 @@ typedef enum
   JERRY_API_ERROR_URI /**< URIError */
 } jerry_api_error_t;
 
+/**
+ * Statistics of the compiled eval code cache
+ */
+typedef struct
+{
+  uint32_t hits; /**< number of evaluations, which reused byte-code from the cache */
+  uint32_t misses; /**< number of evaluations, which parsed the source */
+  uint32_t evictions; /**< number of entries, removed from the cache */
+  uint32_t entries_count; /**< number of entries, currently in the cache */
+  size_t size; /**< memory, currently accounted for the entries */
+  size_t size_limit; /**< limit of memory, accounted for the entries */
+} jerry_api_eval_cache_stats_t;
+
 /**
  * Jerry's char value
 */
@@ -102,6 +116,11 @@ typedef struct ecma_string_t jerry_api_string_t;
  */
 typedef struct ecma_object_t jerry_api_object_t;
 
+/**
+ * Precompiled script (see also: jerry_api_compile_script)
+ */
+typedef struct jerry_api_script_t jerry_api_script_t;
+
 /**
  * Description of an extension function's argument
  */
@@ -147,6 +166,26 @@ typedef bool (*jerry_object_field_foreach_t) (const jerry_api_string_t *field_na
                                               const jerry_api_value_t *field_value_p,
                                               void *user_data_p);
 
+/**
+ * Source of snapshot bundle's entry (see also: jerry_parse_and_save_snapshot_bundle)
+ */
+typedef struct
+{
+  const char *name_p; /**< name of the entry (zero-terminated string) */
+  const jerry_api_char_t *source_p; /**< source of the entry */
+  size_t source_size; /**< size of the source */
+  bool is_for_global; /**< entry would be executed as global (true) or eval (false) code */
+} jerry_api_snapshot_bundle_source_t;
+
+/**
+ * Callback for reading next chunk of script source (see also: jerry_parse_stream)
+ *
+ * The callback returns number of bytes, written to the buffer, or zero, if end of the source is reached.
+ */
+typedef size_t (*jerry_source_read_callback_t) (jerry_api_char_t *buffer_p,
+                                               size_t buffer_size,
+                                               void *user_data_p);
+
 extern EXTERN_C ssize_t
 jerry_api_string_to_char_buffer (const jerry_api_string_t *, jerry_api_char_t *, ssize_t);
 extern EXTERN_C
@@ -226,6 +265,21 @@ bool jerry_api_construct_object (jerry_api_object_t *, jerry_api_value_t *, cons
 extern EXTERN_C
 jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *, size_t, bool, bool, jerry_api_value_t *);
 
+extern EXTERN_C
+jerry_api_script_t *jerry_api_compile_script (const jerry_api_char_t *, size_t, bool);
+
+extern EXTERN_C
+jerry_completion_code_t jerry_api_run_script (jerry_api_script_t *, jerry_api_value_t *);
+
+extern EXTERN_C
+void jerry_api_release_script (jerry_api_script_t *);
+
+extern EXTERN_C
+void jerry_api_set_eval_cache_size_limit (size_t);
+
+extern EXTERN_C
+void jerry_api_get_eval_cache_stats (jerry_api_eval_cache_stats_t *);
+
 extern EXTERN_C
 jerry_api_object_t *jerry_api_get_global (void);
 
@@ -241,6 +295,16 @@ size_t jerry_parse_and_save_snapshot (const jerry_api_char_t *, size_t, bool, ui
 extern EXTERN_C
 jerry_completion_code_t jerry_exec_snapshot (const void *, size_t, bool, jerry_api_value_t *);
 
+extern EXTERN_C
+size_t jerry_compact_snapshot (const void *, size_t, bool, uint8_t *, size_t);
+
+extern EXTERN_C
+size_t jerry_parse_and_save_snapshot_bundle (const jerry_api_snapshot_bundle_source_t *, size_t, uint8_t *, size_t);
+
+extern EXTERN_C
+jerry_completion_code_t jerry_exec_snapshot_bundle_entry (const void *, size_t, const char *, bool,
+                                                          jerry_api_value_t *);
+
 /**
  * @}
  */
@@ -24,7 +24,8 @@
 #include "jerry-api.h"
 
 extern ecma_completion_value_t
-jerry_dispatch_external_function (ecma_object_t *, ecma_external_pointer_t, ecma_value_t, ecma_collection_header_t *);
+jerry_dispatch_external_function (ecma_object_t *, ecma_external_pointer_t, ecma_value_t,
+                                  const ecma_value_t *, ecma_length_t);
 
 extern void
 jerry_dispatch_object_free_callback (ecma_external_pointer_t, ecma_external_pointer_t);
@@ -48,6 +49,95 @@ typedef struct
 /**
  * Jerry snapshot format version
  */
-#define JERRY_SNAPSHOT_VERSION (1u)
+#define JERRY_SNAPSHOT_VERSION (2u)
+
+/**
+ * Compact snapshot header
+ *
+ * The header is followed by the snapshot's literal table and its byte-code with idx-to-lit map in compact encoding
+ * (see also: serializer_encode_bytecode_with_idx_map_compact), that are optionally compressed together.
+ */
+typedef struct
+{
+  uint32_t lit_table_size; /**< size of literal table */
+  uint32_t bytecode_size; /**< size of instructions array, after decoding */
+  uint32_t idx_to_lit_map_size; /**< size of idx-to-lit map, after decoding */
+  uint32_t encoded_size; /**< size of the literal table and the encoded byte-code, before compression */
+  uint32_t is_run_global : 1; /**< flag, indicating whether the snapshot
+                               *   was dumped as 'Global scope'-mode code (true)
+                               *   or as eval-mode code (false) */
+  uint32_t is_compressed : 1; /**< flag, indicating whether the encoded data is compressed
+                               *   (see also: jrt_lz_compress) */
+} jerry_snapshot_compact_header_t;
+
+/**
+ * Jerry compact snapshot format version
+ *
+ * Note:
+ *      compact snapshot versions are numbered separately from other snapshot formats' versions
+ */
+#define JERRY_SNAPSHOT_COMPACT_VERSION (0x30001u)
+
+/**
+ * Snapshot bundle header
+ *
+ * The bundle consists of the header, index of the bundle's entries, sorted by their names,
+ * the entries' names, literal table that is shared between the entries, offsets of the literals
+ * in the table and, for each of the entries, indexes of the literals it uses and its byte-code with idx-to-lit map.
+ */
+typedef struct
+{
+  uint32_t entries_count; /**< number of entries in the bundle */
+  uint32_t names_size; /**< size of the entries' names area */
+  uint32_t lit_table_size; /**< size of literal table */
+} jerry_snapshot_bundle_header_t;
+
+/**
+ * Entry of snapshot bundle's index
+ */
+typedef struct
+{
+  uint32_t name_offset; /**< offset of the entry's name in the names area */
+  uint32_t name_size; /**< size of the entry's name */
+  uint32_t literals_offset; /**< offset of indexes of literals, used by the entry (from the bundle's start) */
+  uint32_t literals_num; /**< number of literals, used by the entry */
+  uint32_t bytecode_offset; /**< offset of the entry's instructions array (from the bundle's start) */
+  uint32_t bytecode_size; /**< size of instructions array */
+  uint32_t idx_to_lit_map_size; /**< size of idx-to-lit map */
+  uint32_t is_run_global : 1; /**< flag, indicating whether the entry
+                               *   was dumped as 'Global scope'-mode code (true)
+                               *   or as eval-mode code (false) */
+} jerry_snapshot_bundle_index_entry_t;
+
+/**
+ * Jerry snapshot bundle format version
+ *
+ * Note:
+ *      bundle versions are numbered separately from snapshot versions,
+ *      so that a bundle is not mistaken for a snapshot, and vice versa
+ */
+#define JERRY_SNAPSHOT_BUNDLE_VERSION (0x10001u)
+
+/**
+ * Heap image header
+ *
+ * The header is followed by sizes of the image's memory regions and the regions' contents
+ */
+typedef struct
+{
+  uint64_t heap_address; /**< address of the heap, the image was saved from */
+  uint64_t code_address; /**< address of the engine's code, the image was saved with */
+  uint32_t build_id; /**< identifier of the engine's build (see also: jerry_heap_image_get_build_id) */
+  uint32_t regions_num; /**< number of memory regions in the image */
+  uint32_t regions_size; /**< overall size of the memory regions' contents */
+} jerry_heap_image_header_t;
+
+/**
+ * Jerry heap image format version
+ *
+ * Note:
+ *      heap image versions are numbered separately from snapshot and snapshot bundle versions
+ */
+#define JERRY_HEAP_IMAGE_VERSION (0x20001u)
 
 #endif /* !JERRY_INTERNAL_H */
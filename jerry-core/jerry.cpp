@@ -27,6 +27,8 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-try-catch-macro.h"
+#include "jrt-lz.h"
+#include "jsp-mm.h"
 #include "lit-magic-strings.h"
 #include "parser.h"
 #include "serializer.h"
@@ -679,25 +681,18 @@ ecma_completion_value_t
 jerry_dispatch_external_function (ecma_object_t *function_object_p, /**< external function object */
                                   ecma_external_pointer_t handler_p, /**< pointer to the function's native handler */
                                   ecma_value_t this_arg_value, /**< 'this' argument */
-                                  ecma_collection_header_t *arg_collection_p) /**< arguments collection */
+                                  const ecma_value_t *arguments_list_p, /**< arguments list */
+                                  ecma_length_t args_count) /**< length of arguments list */
 {
   jerry_assert_api_available ();
 
-  const ecma_length_t args_count = (arg_collection_p != NULL ? arg_collection_p->unit_number : 0);
-
   ecma_completion_value_t completion_value;
 
   MEM_DEFINE_LOCAL_ARRAY (api_arg_values, args_count, jerry_api_value_t);
 
-  ecma_collection_iterator_t args_iterator;
-  ecma_collection_iterator_init (&args_iterator, arg_collection_p);
-
   for (uint32_t i = 0; i < args_count; ++i)
   {
-    bool is_moved = ecma_collection_iterator_next (&args_iterator);
-    JERRY_ASSERT (is_moved);
-
-    jerry_api_convert_ecma_value_to_api_value (&api_arg_values[i], *args_iterator.current_value_p);
+    jerry_api_convert_ecma_value_to_api_value (&api_arg_values[i], arguments_list_p[i]);
   }
 
   jerry_api_value_t api_this_arg_value, api_ret_value;
@@ -1167,26 +1162,21 @@ jerry_api_invoke_function (bool is_invoke_as_constructor, /**< true - invoke fun
 
   bool is_successful = true;
 
-  ecma_collection_header_t *arg_collection_p = ecma_new_values_collection (NULL, 0, true);
+  ecma_completion_value_t call_completion;
+
+  MEM_DEFINE_LOCAL_ARRAY (arg_values, args_count, ecma_value_t);
 
   for (uint32_t i = 0; i < args_count; ++i)
   {
-    ecma_value_t arg_value;
-    jerry_api_convert_api_value_to_ecma_value (&arg_value, &args_p[i]);
-
-    ecma_append_to_values_collection (arg_collection_p, arg_value, true);
-
-    ecma_free_value (arg_value, true);
+    jerry_api_convert_api_value_to_ecma_value (&arg_values[i], &args_p[i]);
   }
 
-  ecma_completion_value_t call_completion;
-
   if (is_invoke_as_constructor)
   {
     JERRY_ASSERT (this_arg_p == NULL);
     JERRY_ASSERT (jerry_api_is_constructor (function_object_p));
 
-    call_completion = ecma_op_function_construct (function_object_p, arg_collection_p);
+    call_completion = ecma_op_function_construct (function_object_p, arg_values, args_count);
   }
   else
   {
@@ -1205,10 +1195,16 @@ jerry_api_invoke_function (bool is_invoke_as_constructor, /**< true - invoke fun
 
     call_completion = ecma_op_function_call (function_object_p,
                                              this_arg_val,
-                                             arg_collection_p);
+                                             arg_values,
+                                             args_count);
+  }
+
+  for (uint32_t i = 0; i < args_count; ++i)
+  {
+    ecma_free_value (arg_values[i], true);
   }
 
-  ecma_free_values_collection (arg_collection_p, true);
+  MEM_FINALIZE_LOCAL_ARRAY (arg_values);
 
   if (!ecma_is_completion_value_normal (call_completion))
   {
@@ -1375,6 +1371,140 @@ jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
   return status;
 } /* jerry_api_eval */
 
+/**
+ * Precompiled script
+ */
+struct jerry_api_script_t
+{
+  const bytecode_data_header_t *bytecode_data_p; /**< byte-code of the script's global code */
+  bool is_contains_functions; /**< are there functions, declared in the script
+                               *   (the functions reference the byte-code, so it can't be freed with the script) */
+};
+
+/**
+ * Compile script source to byte-code, that can be run multiple times without re-parsing
+ *
+ * Note:
+ *      returned script should be released with jerry_api_release_script, when it becomes unnecessary,
+ *      but before jerry_cleanup
+ *
+ * @return pointer to the precompiled script - if the source was parsed successfully,
+ *         NULL - otherwise (there is a SyntaxError or ReferenceError in the source).
+ */
+jerry_api_script_t *
+jerry_api_compile_script (const jerry_api_char_t *source_p, /**< script source */
+                          size_t source_size, /**< script source size */
+                          bool is_source_kept) /**< flag, indicating whether the source buffer is kept
+                                                *   unchanged until jerry_cleanup (see also: jerry_parse) */
+{
+  jerry_assert_api_available ();
+
+  parser_set_show_instrs ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
+
+  const bytecode_data_header_t *bytecode_data_p;
+  bool is_contains_functions;
+
+  jsp_status_t parse_status = parser_parse_script (source_p,
+                                                   source_size,
+                                                   is_source_kept,
+                                                   &bytecode_data_p,
+                                                   &is_contains_functions);
+
+  if (parse_status != JSP_STATUS_OK)
+  {
+    JERRY_ASSERT (parse_status == JSP_STATUS_SYNTAX_ERROR || parse_status == JSP_STATUS_REFERENCE_ERROR);
+
+    return NULL;
+  }
+
+  jerry_api_script_t *script_p = (jerry_api_script_t *) mem_heap_alloc_block (sizeof (jerry_api_script_t),
+                                                                              MEM_HEAP_ALLOC_LONG_TERM);
+  script_p->bytecode_data_p = bytecode_data_p;
+  script_p->is_contains_functions = is_contains_functions;
+
+  return script_p;
+} /* jerry_api_compile_script */
+
+/**
+ * Run precompiled script as global code
+ *
+ * Note:
+ *      the script can be run any number of times, including from within an external function's handler
+ *
+ * Note:
+ *      the returned value is always undefined, as global code doesn't produce a value,
+ *      and the value should be freed with jerry_api_release_value
+ *
+ * @return completion code
+ */
+jerry_completion_code_t
+jerry_api_run_script (jerry_api_script_t *script_p, /**< precompiled script */
+                      jerry_api_value_t *retval_p) /**< out: returned value */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (script_p != NULL);
+
+  ecma_completion_value_t completion = vm_run_global_code (script_p->bytecode_data_p);
+
+  if (ecma_is_completion_value_return (completion))
+  {
+    completion = ecma_make_normal_completion_value (ecma_get_completion_value_value (completion));
+  }
+
+  jerry_completion_code_t status = jerry_api_convert_eval_completion_to_retval (retval_p, completion);
+
+  ecma_free_completion_value (completion);
+
+  return status;
+} /* jerry_api_run_script */
+
+/**
+ * Release precompiled script
+ *
+ * Note:
+ *      the script should not be running at the moment
+ */
+void
+jerry_api_release_script (jerry_api_script_t *script_p) /**< precompiled script */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (script_p != NULL);
+
+  if (!script_p->is_contains_functions)
+  {
+    serializer_remove_bytecode_data (script_p->bytecode_data_p);
+  }
+
+  mem_heap_free_block (script_p);
+} /* jerry_api_release_script */
+
+/**
+ * Set limit of memory, that can be occupied by the compiled eval code cache
+ *
+ * Note:
+ *      zero limit disables the cache
+ */
+void
+jerry_api_set_eval_cache_size_limit (size_t size_limit) /**< limit, in bytes */
+{
+  jerry_assert_api_available ();
+
+  ecma_eval_cache_set_size_limit (size_limit);
+} /* jerry_api_set_eval_cache_size_limit */
+
+/**
+ * Get statistics of the compiled eval code cache
+ */
+void
+jerry_api_get_eval_cache_stats (jerry_api_eval_cache_stats_t *out_stats_p) /**< out: statistics */
+{
+  jerry_assert_api_available ();
+
+  ecma_eval_cache_get_stats (out_stats_p);
+} /* jerry_api_get_eval_cache_stats */
+
 /**
  * Perform GC
  */
@@ -1387,10 +1517,10 @@ jerry_api_gc (void)
 } /* jerry_api_gc */
 
 /**
- * Jerry engine initialization
+ * Process run-time configuration flags and make Jerry API available
  */
-void
-jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+static void
+jerry_init_flags (jerry_flag_t flags) /**< combination of Jerry flags */
 {
   if (flags & (JERRY_FLAG_ENABLE_LOG))
   {
@@ -1418,12 +1548,229 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
   jerry_flags = flags;
 
   jerry_make_api_available ();
+} /* jerry_init_flags */
+
+/**
+ * Jerry engine initialization
+ */
+void
+jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  jerry_init_flags (flags);
 
   mem_init ();
   serializer_init ();
   ecma_init ();
+
+  parser_set_lazy_functions ((jerry_flags & JERRY_FLAG_LAZY_FUNCTIONS) != 0);
 } /* jerry_init */
 
+/**
+ * Get memory regions, that make up engine's state saved to a heap image
+ */
+static void
+jerry_heap_image_get_regions (mem_image_regions_t *regions_p) /**< out: list of regions */
+{
+  mem_image_regions_init (regions_p);
+
+  mem_get_image_regions (regions_p);
+  serializer_get_image_regions (regions_p);
+  ecma_get_image_regions (regions_p);
+  vm_get_image_regions (regions_p);
+} /* jerry_heap_image_get_regions */
+
+/**
+ * Calculate identifier of the engine's build, that is checked upon restoring a heap image
+ *
+ * @return hash of the build's date, commit hash and branch name
+ */
+static uint32_t
+jerry_heap_image_get_build_id (void)
+{
+  const char *strings[] = { jerry_build_date, jerry_commit_hash, jerry_branch_name };
+
+  /* FNV-1a */
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < sizeof (strings) / sizeof (strings[0]); i++)
+  {
+    for (const char *char_p = strings[i]; *char_p != '\0'; char_p++)
+    {
+      hash = (hash ^ (uint8_t) *char_p) * 16777619u;
+    }
+
+    /* account for the string's terminator, so that boundaries between the strings affect the hash */
+    hash *= 16777619u;
+  }
+
+  return hash;
+} /* jerry_heap_image_get_build_id */
+
+/**
+ * Initialize heap image header, corresponding to the engine
+ */
+static void
+jerry_heap_image_init_header (jerry_heap_image_header_t *header_p, /**< out: header */
+                              const mem_image_regions_t *regions_p) /**< memory regions of the image */
+{
+  /* the heap is the first of the regions (see also: mem_heap_get_image_regions) */
+  header_p->heap_address = (uint64_t) (uintptr_t) regions_p->regions[0].region_p;
+  header_p->code_address = (uint64_t) (uintptr_t) &jerry_init;
+  header_p->build_id = jerry_heap_image_get_build_id ();
+  header_p->regions_num = regions_p->regions_num;
+  header_p->regions_size = 0;
+
+  for (uint32_t i = 0; i < regions_p->regions_num; i++)
+  {
+    header_p->regions_size += (uint32_t) regions_p->regions[i].size;
+  }
+} /* jerry_heap_image_init_header */
+
+/**
+ * Save the engine's heap and global state to a heap image
+ *
+ * The image can be used to initialize the engine with jerry_init_from_heap_image, instead of
+ * instantiating built-in objects and running initialization scripts again.
+ *
+ * Note:
+ *      the image can only be restored by the same build of the engine, with the engine's heap
+ *      and code placed at the same addresses (i.e. in the same process, or in a process
+ *      of a binary that is not position-independent), as the image contains raw pointers;
+ *
+ *      the routine should not be called during execution of code (i.e. from external function handlers);
+ *
+ *      the image can't be saved if external magic strings are registered, or byte-code
+ *      loaded from a snapshot without copying (see also: jerry_exec_snapshot) or parsed
+ *      in lazy functions mode (see also: JERRY_FLAG_LAZY_FUNCTIONS) is alive,
+ *      as the engine's state references memory outside of the heap in the cases
+ *
+ * @return size of the image, if it was saved successfully (i.e. buffer size is sufficient),
+ *         0 - otherwise.
+ */
+size_t
+jerry_save_heap_image (uint8_t *buffer_p, /**< buffer to save the image to */
+                       size_t buffer_size) /**< the buffer's size */
+{
+  jerry_assert_api_available ();
+
+  if (lit_get_magic_string_ex_count () != 0
+      || !serializer_is_bytecode_in_heap ())
+  {
+    return 0;
+  }
+
+  ecma_prepare_for_image ();
+
+  mem_image_regions_t regions;
+  jerry_heap_image_get_regions (&regions);
+
+  jerry_heap_image_header_t header;
+  jerry_heap_image_init_header (&header, &regions);
+
+  uint64_t version = JERRY_HEAP_IMAGE_VERSION;
+  size_t buffer_write_offset = 0;
+
+  if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, version)
+      || !jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, header))
+  {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < regions.regions_num; i++)
+  {
+    uint32_t region_size = (uint32_t) regions.regions[i].size;
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, region_size))
+    {
+      return 0;
+    }
+  }
+
+  for (uint32_t i = 0; i < regions.regions_num; i++)
+  {
+    if (buffer_write_offset + regions.regions[i].size > buffer_size)
+    {
+      return 0;
+    }
+
+    memcpy (buffer_p + buffer_write_offset, regions.regions[i].region_p, regions.regions[i].size);
+    buffer_write_offset += regions.regions[i].size;
+  }
+
+  return buffer_write_offset;
+} /* jerry_save_heap_image */
+
+/**
+ * Initialize the engine from a heap image, saved with jerry_save_heap_image
+ *
+ * If the image doesn't correspond to the engine's build, heap address or memory layout,
+ * the engine is initialized in the usual way (see also: jerry_init).
+ *
+ * Note:
+ *      external magic strings, if required, should be registered after the initialization
+ *
+ * @return true - if the engine was initialized from the image,
+ *         false - if the image is not valid for the engine, and so, it was initialized with jerry_init.
+ */
+bool
+jerry_init_from_heap_image (jerry_flag_t flags, /**< combination of Jerry flags */
+                            const void *image_p, /**< heap image */
+                            size_t image_size) /**< size of the image */
+{
+  const uint8_t *image_data_p = (const uint8_t *) image_p;
+  size_t image_read_offset = 0;
+
+  mem_image_regions_t regions;
+  jerry_heap_image_get_regions (&regions);
+
+  jerry_heap_image_header_t expected_header;
+  jerry_heap_image_init_header (&expected_header, &regions);
+
+  uint64_t version;
+  jerry_heap_image_header_t header;
+
+  bool is_valid = (jrt_read_from_buffer_by_offset (image_data_p, image_size, &image_read_offset, &version)
+                   && version == JERRY_HEAP_IMAGE_VERSION
+                   && jrt_read_from_buffer_by_offset (image_data_p, image_size, &image_read_offset, &header)
+                   && header.heap_address == expected_header.heap_address
+                   && header.code_address == expected_header.code_address
+                   && header.build_id == expected_header.build_id
+                   && header.regions_num == expected_header.regions_num
+                   && header.regions_size == expected_header.regions_size);
+
+  for (uint32_t i = 0; is_valid && i < regions.regions_num; i++)
+  {
+    uint32_t region_size;
+
+    is_valid = (jrt_read_from_buffer_by_offset (image_data_p, image_size, &image_read_offset, &region_size)
+                && region_size == regions.regions[i].size);
+  }
+
+  if (!is_valid
+      || image_size - image_read_offset != expected_header.regions_size)
+  {
+    jerry_init (flags);
+
+    return false;
+  }
+
+  jerry_init_flags (flags);
+
+  for (uint32_t i = 0; i < regions.regions_num; i++)
+  {
+    memcpy (regions.regions[i].region_p, image_data_p + image_read_offset, regions.regions[i].size);
+    image_read_offset += regions.regions[i].size;
+  }
+
+  serializer_init_from_image ();
+  ecma_init_from_image ();
+  vm_init_from_image ();
+
+  parser_set_lazy_functions ((jerry_flags & JERRY_FLAG_LAZY_FUNCTIONS) != 0);
+
+  return true;
+} /* jerry_init_from_heap_image */
+
 /**
  * Terminate Jerry engine
  */
@@ -1436,6 +1783,14 @@ jerry_cleanup (void)
 
   ecma_finalize ();
   serializer_free ();
+
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    jsp_mm_stats_print ();
+  }
+#endif /* MEM_STATS */
+
   mem_finalize (is_show_mem_stats);
   vm_finalize ();
 } /* jerry_cleanup */
@@ -1475,6 +1830,28 @@ jerry_reg_err_callback (jerry_error_callback_t callback) /**< pointer to callbac
   JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("Error callback is not implemented", callback);
 } /* jerry_reg_err_callback */
 
+/**
+ * Prepare engine for running parsed global code (see also: jerry_run)
+ */
+static void
+jerry_init_program (const bytecode_data_header_t *bytecode_data_p) /**< byte-code of the global code */
+{
+#ifdef MEM_STATS
+  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
+  {
+    mem_stats_print ();
+    mem_stats_reset_peak ();
+
+    jsp_mm_stats_print ();
+    jsp_mm_stats_reset_peak ();
+  }
+#endif /* MEM_STATS */
+
+  bool is_show_mem_stats_per_instruction = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
+
+  vm_init (bytecode_data_p, is_show_mem_stats_per_instruction);
+} /* jerry_init_program */
+
 /**
  * Parse script for specified context
  *
@@ -1483,7 +1860,11 @@ jerry_reg_err_callback (jerry_error_callback_t callback) /**< pointer to callbac
  */
 bool
 jerry_parse (const jerry_api_char_t* source_p, /**< script source */
-             size_t source_size) /**< script source size */
+             size_t source_size, /**< script source size */
+             bool is_source_kept) /**< flag, indicating whether the source buffer is kept unchanged
+                                   *   until jerry_cleanup, so that in lazy functions mode functions'
+                                   *   code could be compiled from the buffer upon first call
+                                   *   (see also: JERRY_FLAG_LAZY_FUNCTIONS) */
 {
   jerry_assert_api_available ();
 
@@ -1496,7 +1877,9 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
 
   parse_status = parser_parse_script (source_p,
                                       source_size,
-                                      &bytecode_data_p);
+                                      is_source_kept,
+                                      &bytecode_data_p,
+                                      NULL);
 
   if (parse_status != JSP_STATUS_OK)
   {
@@ -1505,48 +1888,89 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
     return false;
   }
 
-#ifdef MEM_STATS
-  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
-  {
-    mem_stats_print ();
-    mem_stats_reset_peak ();
-  }
-#endif /* MEM_STATS */
-
-  bool is_show_mem_stats_per_instruction = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
-
-  vm_init (bytecode_data_p, is_show_mem_stats_per_instruction);
+  jerry_init_program (bytecode_data_p);
 
   return true;
 } /* jerry_parse */
 
 /**
- * Run Jerry in specified run context
+ * Parse script for specified context, reading the script's source by chunks during parse
  *
- * @return completion status
+ * Note:
+ *      reading of the source is interleaved with parse, so the source can be read from a file or pipe
+ *      while the already read part is being parsed
+ *
+ * Note:
+ *      the source is read to the specified buffer, which should be larger than the source,
+ *      and should not be changed until the parse finishes (or until jerry_cleanup, if is_buffer_kept is true)
+ *
+ * @return true - if the source was parsed successfully,
+ *         false - otherwise (there is an early error in the source, or the buffer is too small).
  */
-jerry_completion_code_t
-jerry_run (void)
+bool
+jerry_parse_stream (jerry_source_read_callback_t read_callback_p, /**< callback for reading source chunks */
+                    void *user_data_p, /**< user data, passed to the callback */
+                    jerry_api_char_t *buffer_p, /**< buffer to read the source to */
+                    size_t buffer_size, /**< size of the buffer */
+                    bool is_buffer_kept) /**< flag, indicating whether the buffer is kept unchanged
+                                          *   until jerry_cleanup (see also: jerry_parse) */
 {
   jerry_assert_api_available ();
 
-  return vm_run_global ();
-} /* jerry_run */
-/**
- * Simple jerry runner
- *
- * @return completion status
- */
-jerry_completion_code_t
-jerry_run_simple (const jerry_api_char_t *script_source, /**< script source */
-                  size_t script_source_size, /**< script source size */
-                  jerry_flag_t flags) /**< combination of Jerry flags */
-{
-  jerry_init (flags);
+  bool is_show_instructions = ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
+
+  parser_set_show_instrs (is_show_instructions);
+
+  const bytecode_data_header_t *bytecode_data_p;
+  jsp_status_t parse_status;
+
+  parse_status = parser_parse_script_stream (read_callback_p,
+                                             user_data_p,
+                                             buffer_p,
+                                             buffer_size,
+                                             is_buffer_kept,
+                                             &bytecode_data_p);
+
+  if (parse_status != JSP_STATUS_OK)
+  {
+    JERRY_ASSERT (parse_status == JSP_STATUS_SYNTAX_ERROR || parse_status == JSP_STATUS_REFERENCE_ERROR);
+
+    return false;
+  }
+
+  jerry_init_program (bytecode_data_p);
+
+  return true;
+} /* jerry_parse_stream */
+
+/**
+ * Run Jerry in specified run context
+ *
+ * @return completion status
+ */
+jerry_completion_code_t
+jerry_run (void)
+{
+  jerry_assert_api_available ();
+
+  return vm_run_global ();
+} /* jerry_run */
+/**
+ * Simple jerry runner
+ *
+ * @return completion status
+ */
+jerry_completion_code_t
+jerry_run_simple (const jerry_api_char_t *script_source, /**< script source */
+                  size_t script_source_size, /**< script source size */
+                  jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  jerry_init (flags);
 
   jerry_completion_code_t ret_code = JERRY_COMPLETION_CODE_OK;
 
-  if (!jerry_parse (script_source, script_source_size))
+  /* the source is kept until jerry_cleanup, that is called upon the script's completion */
+  if (!jerry_parse (script_source, script_source_size, true))
   {
     /* unhandled SyntaxError */
     ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
@@ -1628,29 +2052,27 @@ jerry_register_external_magic_strings (const jerry_api_char_ptr_t* ex_str_items,
   lit_magic_strings_ex_set ((const lit_utf8_byte_t **) ex_str_items, count, (const lit_utf8_size_t *) str_lengths);
 } /* jerry_register_external_magic_strings */
 
+#ifdef JERRY_ENABLE_SNAPSHOT
 /**
- * Generate snapshot from specified source
+ * Parse source for dumping it to snapshot
  *
- * @return size of snapshot, if it was generated succesfully
- *          (i.e. there are no syntax errors in source code, buffer size is sufficient,
- *           and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT),
- *         0 - otherwise.
+ * @return status of the parse
  */
-size_t
-jerry_parse_and_save_snapshot (const jerry_api_char_t* source_p, /**< script source */
-                               size_t source_size, /**< script source size */
-                               bool is_for_global, /**< snapshot would be executed as global (true)
-                                                    *   or eval (false) */
-                               uint8_t *buffer_p, /**< buffer to dump snapshot to */
-                               size_t buffer_size) /**< the buffer's size */
+static jsp_status_t
+jerry_snapshot_parse (const jerry_api_char_t* source_p, /**< script source */
+                      size_t source_size, /**< script source size */
+                      bool is_for_global, /**< snapshot would be executed as global (true)
+                                           *   or eval (false) */
+                      const bytecode_data_header_t **out_bytecode_data_p) /**< out: byte-code of the source */
 {
-#ifdef JERRY_ENABLE_SNAPSHOT
   jsp_status_t parse_status;
-  const bytecode_data_header_t *bytecode_data_p;
+
+  /* code of all functions is compiled for snapshot, so that execution of the snapshot doesn't involve parser */
+  parser_set_lazy_functions (false);
 
   if (is_for_global)
   {
-    parse_status = parser_parse_script (source_p, source_size, &bytecode_data_p);
+    parse_status = parser_parse_script (source_p, source_size, false, out_bytecode_data_p, NULL);
   }
   else
   {
@@ -1659,11 +2081,205 @@ jerry_parse_and_save_snapshot (const jerry_api_char_t* source_p, /**< script sou
     parse_status = parser_parse_eval (source_p,
                                       source_size,
                                       false,
-                                      &bytecode_data_p,
+                                      out_bytecode_data_p,
                                       &code_contains_functions);
   }
 
-  if (parse_status != JSP_STATUS_OK)
+  parser_set_lazy_functions ((jerry_flags & JERRY_FLAG_LAZY_FUNCTIONS) != 0);
+
+  return parse_status;
+} /* jerry_snapshot_parse */
+
+/**
+ * Run byte-code, loaded from snapshot
+ *
+ * @return completion code
+ */
+static jerry_completion_code_t
+jerry_snapshot_run (const bytecode_data_header_t *bytecode_data_p, /**< byte-code */
+                    bool is_run_global, /**< run the byte-code as global (true) or eval (false) code */
+                    jerry_api_value_t *retval_p) /**< out: returned value (ECMA-262 'undefined' if code is executed
+                                                  *        as global scope code) */
+{
+  jerry_completion_code_t ret_code;
+
+  if (is_run_global)
+  {
+    vm_init (bytecode_data_p, false);
+
+    ret_code = vm_run_global ();
+
+    vm_finalize ();
+  }
+  else
+  {
+    /* vm should be already initialized */
+    ecma_completion_value_t completion = vm_run_eval (bytecode_data_p, false);
+
+    ret_code = jerry_api_convert_eval_completion_to_retval (retval_p, completion);
+
+    ecma_free_completion_value (completion);
+  }
+
+  return ret_code;
+} /* jerry_snapshot_run */
+
+/**
+ * Load literal table and byte-code with idx-to-lit map of a snapshot
+ *
+ * @return pointer to byte-code header, upon success,
+ *         NULL - upon failure (i.e., in case snapshot format is not valid)
+ */
+static const bytecode_data_header_t *
+jerry_snapshot_load (const uint8_t *lit_table_p, /**< literal table */
+                     uint32_t lit_table_size, /**< size of literal table */
+                     const uint8_t *bytecode_and_idx_map_p, /**< instructions array and idx-to-lit map */
+                     uint32_t bytecode_size, /**< size of instructions array */
+                     uint32_t idx_to_lit_map_size, /**< size of idx-to-lit map */
+                     bool is_copy) /**< flag, indicating whether the data should be copied to engine's memory
+                                    *   (see also: jerry_exec_snapshot) */
+{
+  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
+  uint32_t literals_num;
+
+  if (!lit_load_literals_from_snapshot (lit_table_p,
+                                        lit_table_size,
+                                        &lit_map_p,
+                                        &literals_num,
+                                        is_copy))
+  {
+    JERRY_ASSERT (lit_map_p == NULL);
+    return NULL;
+  }
+
+  const bytecode_data_header_t *bytecode_data_p;
+  bytecode_data_p = serializer_load_bytecode_with_idx_map (bytecode_and_idx_map_p,
+                                                           bytecode_size,
+                                                           idx_to_lit_map_size,
+                                                           lit_map_p,
+                                                           literals_num,
+                                                           is_copy);
+
+  if (lit_map_p != NULL)
+  {
+    mem_heap_free_block (lit_map_p);
+  }
+
+  return bytecode_data_p;
+} /* jerry_snapshot_load */
+
+/**
+ * Load compact snapshot (see also: jerry_compact_snapshot)
+ *
+ * Note:
+ *      the snapshot's data is decoded to engine's memory, so the snapshot buffer is not referenced
+ *      after the function returns
+ *
+ * @return pointer to byte-code header, upon success,
+ *         NULL - upon failure (i.e., in case snapshot format is not valid)
+ */
+static const bytecode_data_header_t *
+jerry_load_compact_snapshot (const uint8_t *snapshot_data_p, /**< snapshot */
+                             size_t snapshot_size, /**< size of snapshot */
+                             size_t snapshot_read, /**< offset of the snapshot's header */
+                             bool *out_is_run_global_p) /**< out: flag, indicating whether the byte-code
+                                                         *        should be run as global code */
+{
+  jerry_snapshot_compact_header_t header;
+
+  if (!jrt_read_from_buffer_by_offset (snapshot_data_p, snapshot_size, &snapshot_read, &header))
+  {
+    return NULL;
+  }
+
+  const size_t decoded_size = JERRY_ALIGNUP ((size_t) header.bytecode_size + header.idx_to_lit_map_size,
+                                             MEM_ALIGNMENT);
+  const size_t alloc_size = decoded_size + (header.is_compressed ? header.encoded_size : 0);
+
+  /* sizes, exceeding size of the heap, could only be specified by a corrupted header */
+  if (header.lit_table_size > header.encoded_size
+      || decoded_size == 0
+      || alloc_size > CONFIG_MEM_HEAP_AREA_SIZE
+      || (!header.is_compressed && snapshot_size - snapshot_read != header.encoded_size))
+  {
+    return NULL;
+  }
+
+  uint8_t *buffer_p = (uint8_t *) mem_heap_alloc_block (alloc_size, MEM_HEAP_ALLOC_SHORT_TERM);
+
+  const uint8_t *encoded_p = snapshot_data_p + snapshot_read;
+  bool is_ok = true;
+
+  if (header.is_compressed)
+  {
+    is_ok = jrt_lz_decompress (encoded_p, snapshot_size - snapshot_read, buffer_p + decoded_size, header.encoded_size);
+    encoded_p = buffer_p + decoded_size;
+  }
+
+  const bytecode_data_header_t *bytecode_data_p = NULL;
+
+  if (is_ok
+      && serializer_decode_bytecode_with_idx_map_compact (encoded_p + header.lit_table_size,
+                                                          header.encoded_size - header.lit_table_size,
+                                                          header.bytecode_size,
+                                                          header.idx_to_lit_map_size,
+                                                          buffer_p))
+  {
+    bytecode_data_p = jerry_snapshot_load (encoded_p,
+                                           header.lit_table_size,
+                                           buffer_p,
+                                           header.bytecode_size,
+                                           header.idx_to_lit_map_size,
+                                           true);
+  }
+
+  mem_heap_free_block (buffer_p);
+
+  *out_is_run_global_p = header.is_run_global;
+
+  return bytecode_data_p;
+} /* jerry_load_compact_snapshot */
+
+/**
+ * Get current value of the monotonic clock, used for snapshot statistics
+ *
+ * @return time in microseconds,
+ *         or 0 - if the clock is not available
+ */
+static uint64_t
+jerry_snapshot_get_time_us (void)
+{
+  struct timespec ts;
+
+  if (clock_gettime (CLOCK_MONOTONIC, &ts) != 0)
+  {
+    return 0;
+  }
+
+  return (uint64_t) ts.tv_sec * 1000000u + (uint64_t) ts.tv_nsec / 1000u;
+} /* jerry_snapshot_get_time_us */
+#endif /* JERRY_ENABLE_SNAPSHOT */
+
+/**
+ * Generate snapshot from specified source
+ *
+ * @return size of snapshot, if it was generated succesfully
+ *          (i.e. there are no syntax errors in source code, buffer size is sufficient,
+ *           and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT),
+ *         0 - otherwise.
+ */
+size_t
+jerry_parse_and_save_snapshot (const jerry_api_char_t* source_p, /**< script source */
+                               size_t source_size, /**< script source size */
+                               bool is_for_global, /**< snapshot would be executed as global (true)
+                                                    *   or eval (false) */
+                               uint8_t *buffer_p, /**< buffer to dump snapshot to */
+                               size_t buffer_size) /**< the buffer's size */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT
+  const bytecode_data_header_t *bytecode_data_p;
+
+  if (jerry_snapshot_parse (source_p, source_size, is_for_global, &bytecode_data_p) != JSP_STATUS_OK)
   {
     return 0;
   }
@@ -1755,7 +2371,11 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
                                     *   after the function returns (in the case, the passed
                                     *   buffer could be freed after the call);
                                     *   otherwise (if flag not set) - the buffer could be freed
-                                    *   only after engine stops (i.e. after call to jerry_cleanup). */
+                                    *   only after engine stops (i.e. after call to jerry_cleanup);
+                                    *   the buffer is never written to, so it could be a read-only
+                                    *   memory mapping of a snapshot file;
+                                    *   compact snapshots are always decoded to engine's memory,
+                                    *   so the flag is ignored for them. */
                      jerry_api_value_t *retval_p) /**< out: returned value (ECMA-262 'undefined' if code is executed
                                                    *        as global scope code) */
 {
@@ -1776,90 +2396,719 @@ jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
     return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
   }
 
-  if (version != JERRY_SNAPSHOT_VERSION)
+  if (version != JERRY_SNAPSHOT_VERSION && version != JERRY_SNAPSHOT_COMPACT_VERSION)
   {
     return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION;
   }
 
-  const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) (snapshot_data_p + snapshot_read);
-  if (snapshot_read + sizeof (jerry_snapshot_header_t) > snapshot_size)
+  const bool is_show_snapshot_stats = ((jerry_flags & JERRY_FLAG_SNAPSHOT_STATS) != 0);
+  const uint64_t load_start_time_us = is_show_snapshot_stats ? jerry_snapshot_get_time_us () : 0;
+
+  const bytecode_data_header_t *bytecode_data_p;
+  bool is_run_global;
+
+  if (version == JERRY_SNAPSHOT_COMPACT_VERSION)
   {
-    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    bytecode_data_p = jerry_load_compact_snapshot (snapshot_data_p, snapshot_size, snapshot_read, &is_run_global);
   }
+  else
+  {
+    const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) (snapshot_data_p + snapshot_read);
+    if (snapshot_read + sizeof (jerry_snapshot_header_t) > snapshot_size)
+    {
+      return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    }
 
-  snapshot_read += sizeof (jerry_snapshot_header_t);
+    snapshot_read += sizeof (jerry_snapshot_header_t);
 
-  if (snapshot_read + header_p->lit_table_size > snapshot_size)
+    if (snapshot_read + header_p->lit_table_size > snapshot_size
+        || (snapshot_read + header_p->lit_table_size + header_p->bytecode_size + header_p->idx_to_lit_map_size
+            > snapshot_size))
+    {
+      return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    }
+
+    bytecode_data_p = jerry_snapshot_load (snapshot_data_p + snapshot_read,
+                                           header_p->lit_table_size,
+                                           snapshot_data_p + snapshot_read + header_p->lit_table_size,
+                                           header_p->bytecode_size,
+                                           header_p->idx_to_lit_map_size,
+                                           is_copy);
+    is_run_global = header_p->is_run_global;
+  }
+
+  if (bytecode_data_p == NULL)
   {
     return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
   }
 
+  const uint64_t run_start_time_us = is_show_snapshot_stats ? jerry_snapshot_get_time_us () : 0;
+
+  jerry_completion_code_t ret_code = jerry_snapshot_run (bytecode_data_p, is_run_global, retval_p);
+
+  if (is_show_snapshot_stats)
+  {
+    const uint64_t run_end_time_us = jerry_snapshot_get_time_us ();
+
+    printf ("Snapshot load time (us): %llu\n", (unsigned long long) (run_start_time_us - load_start_time_us));
+    printf ("Snapshot run time (us):  %llu\n", (unsigned long long) (run_end_time_us - run_start_time_us));
+  }
+
+  return ret_code;
+#else /* JERRY_ENABLE_SNAPSHOT */
+  (void) snapshot_p;
+  (void) snapshot_size;
+  (void) is_copy;
+  (void) retval_p;
+
+  return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION;
+#endif /* !JERRY_ENABLE_SNAPSHOT */
+} /* jerry_exec_snapshot */
+
+/**
+ * Convert snapshot to compact snapshot
+ *
+ * In a compact snapshot, instructions are stored without arguments, unused by their opcodes,
+ * and idx-to-lit map is stored with variable-length encoded numbers and delta-coded literal indexes.
+ * Upon request, the snapshot's data is additionally compressed with LZ77-class compression
+ * (if it decreases the snapshot's size).
+ *
+ * Compact snapshots are executed with jerry_exec_snapshot.
+ *
+ * Note:
+ *      the engine should be initialized, as temporary buffers are allocated from engine's heap;
+ *      the buffer should be large enough to hold the snapshot's data encoded without compression
+ *
+ * @return size of compact snapshot, if it was generated succesfully
+ *          (i.e. the snapshot is valid, buffer size is sufficient,
+ *           and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT),
+ *         0 - otherwise.
+ */
+size_t
+jerry_compact_snapshot (const void *snapshot_p, /**< snapshot */
+                        size_t snapshot_size, /**< size of snapshot */
+                        bool is_compress, /**< flag, indicating whether the snapshot's data should be compressed */
+                        uint8_t *buffer_p, /**< buffer to save compact snapshot to */
+                        size_t buffer_size) /**< the buffer's size */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT
+  const uint8_t *snapshot_data_p = (const uint8_t *) snapshot_p;
+  size_t snapshot_read = 0;
+
+  uint64_t version;
+  jerry_snapshot_header_t header;
+
+  if (!jrt_read_from_buffer_by_offset (snapshot_data_p, snapshot_size, &snapshot_read, &version)
+      || version != JERRY_SNAPSHOT_VERSION
+      || !jrt_read_from_buffer_by_offset (snapshot_data_p, snapshot_size, &snapshot_read, &header)
+      || (snapshot_read + header.lit_table_size + header.bytecode_size + header.idx_to_lit_map_size
+          > snapshot_size))
+  {
+    return 0;
+  }
+
+  jerry_snapshot_compact_header_t compact_header;
+  compact_header.lit_table_size = header.lit_table_size;
+  compact_header.bytecode_size = header.bytecode_size;
+  compact_header.idx_to_lit_map_size = header.idx_to_lit_map_size;
+  compact_header.is_run_global = header.is_run_global;
+  compact_header.is_compressed = false;
+
+  size_t buffer_write_offset = 0;
+  uint64_t compact_version = JERRY_SNAPSHOT_COMPACT_VERSION;
+
+  if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, compact_version)
+      || !jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, compact_header))
+  {
+    return 0;
+  }
+
+  const size_t header_offset = buffer_write_offset - sizeof (jerry_snapshot_compact_header_t);
+  const size_t encoded_offset = buffer_write_offset;
+
+  if (buffer_write_offset + header.lit_table_size > buffer_size)
+  {
+    return 0;
+  }
+
+  memcpy (buffer_p + buffer_write_offset, snapshot_data_p + snapshot_read, header.lit_table_size);
+  buffer_write_offset += header.lit_table_size;
+  snapshot_read += header.lit_table_size;
+
+  if (!serializer_encode_bytecode_with_idx_map_compact (snapshot_data_p + snapshot_read,
+                                                        header.bytecode_size,
+                                                        header.idx_to_lit_map_size,
+                                                        buffer_p,
+                                                        buffer_size,
+                                                        &buffer_write_offset))
+  {
+    return 0;
+  }
+
+  const size_t encoded_size = buffer_write_offset - encoded_offset;
+  compact_header.encoded_size = (uint32_t) encoded_size;
+
+  if (is_compress)
+  {
+    uint8_t *temp_buffer_p = (uint8_t *) mem_heap_alloc_block (JRT_LZ_HASH_TABLE_SIZE + encoded_size,
+                                                               MEM_HEAP_ALLOC_SHORT_TERM);
+    uint32_t *hash_table_p = (uint32_t *) temp_buffer_p;
+    uint8_t *encoded_copy_p = temp_buffer_p + JRT_LZ_HASH_TABLE_SIZE;
+
+    memcpy (encoded_copy_p, buffer_p + encoded_offset, encoded_size);
+
+    size_t compressed_size = jrt_lz_compress (encoded_copy_p,
+                                              encoded_size,
+                                              buffer_p + encoded_offset,
+                                              encoded_size,
+                                              hash_table_p);
+
+    if (compressed_size != 0
+        && compressed_size < encoded_size)
+    {
+      compact_header.is_compressed = true;
+      buffer_write_offset = encoded_offset + compressed_size;
+    }
+    else
+    {
+      /* the data is not compressible, so it is stored as is */
+      memcpy (buffer_p + encoded_offset, encoded_copy_p, encoded_size);
+    }
+
+    mem_heap_free_block (temp_buffer_p);
+  }
+
+  size_t header_write_offset = header_offset;
+  bool is_ok = jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &header_write_offset, compact_header);
+  JERRY_ASSERT (is_ok);
+
+  return buffer_write_offset;
+#else /* JERRY_ENABLE_SNAPSHOT */
+  (void) snapshot_p;
+  (void) snapshot_size;
+  (void) is_compress;
+  (void) buffer_p;
+  (void) buffer_size;
+
+  return 0;
+#endif /* !JERRY_ENABLE_SNAPSHOT */
+} /* jerry_compact_snapshot */
+
+#ifdef JERRY_ENABLE_SNAPSHOT
+/**
+ * Pad snapshot buffer with zero bytes up to MEM_ALIGNMENT
+ *
+ * @return true, if buffer size is sufficient,
+ *         false - otherwise.
+ */
+static bool
+jerry_snapshot_write_padding (uint8_t *buffer_p, /**< buffer */
+                              size_t buffer_size, /**< buffer size */
+                              size_t *in_out_buffer_offset_p) /**< in-out: buffer write offset */
+{
+  while (JERRY_ALIGNUP (*in_out_buffer_offset_p, MEM_ALIGNMENT) != *in_out_buffer_offset_p)
+  {
+    uint8_t padding = 0;
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, padding))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* jerry_snapshot_write_padding */
+
+/**
+ * Compare names of snapshot bundle's entries
+ *
+ * @return negative number - if first name is less than second name,
+ *         0 - if the names are equal,
+ *         positive number - otherwise.
+ */
+static int
+jerry_snapshot_bundle_compare_names (const uint8_t *name1_p, /**< first name */
+                                     size_t name1_size, /**< size of first name */
+                                     const uint8_t *name2_p, /**< second name */
+                                     size_t name2_size) /**< size of second name */
+{
+  int cmp = memcmp (name1_p, name2_p, JERRY_MIN (name1_size, name2_size));
+
+  if (cmp != 0)
+  {
+    return cmp;
+  }
+  else if (name1_size == name2_size)
+  {
+    return 0;
+  }
+  else
+  {
+    return (name1_size < name2_size) ? -1 : 1;
+  }
+} /* jerry_snapshot_bundle_compare_names */
+
+/**
+ * Dump snapshot bundle
+ *
+ * See also:
+ *          jerry_snapshot_bundle_header_t
+ *
+ * @return size of bundle, if it was generated succesfully,
+ *         0 - otherwise.
+ */
+static size_t
+jerry_snapshot_bundle_dump (const jerry_api_snapshot_bundle_source_t *sources_p, /**< entries' sources */
+                            uint32_t entries_count, /**< number of entries */
+                            const bytecode_data_header_t **bytecodes_p, /**< entries' byte-code */
+                            uint32_t *order_p, /**< buffer for indexes of entries, sorted by name */
+                            uint8_t *buffer_p, /**< buffer to dump bundle to */
+                            size_t buffer_size) /**< the buffer's size */
+{
+  for (uint32_t i = 0; i < entries_count; i++)
+  {
+    const uint8_t *name_p = (const uint8_t *) sources_p[i].name_p;
+    size_t name_size = strlen (sources_p[i].name_p);
+
+    uint32_t pos = i;
+
+    while (pos > 0)
+    {
+      const jerry_api_snapshot_bundle_source_t *prev_p = &sources_p[order_p[pos - 1u]];
+
+      int cmp = jerry_snapshot_bundle_compare_names ((const uint8_t *) prev_p->name_p,
+                                                     strlen (prev_p->name_p),
+                                                     name_p,
+                                                     name_size);
+      if (cmp == 0)
+      {
+        /* entries' names should be unique */
+        return 0;
+      }
+      else if (cmp < 0)
+      {
+        break;
+      }
+
+      order_p[pos] = order_p[pos - 1u];
+      pos--;
+    }
+
+    order_p[pos] = i;
+  }
+
+  size_t buffer_write_offset = 0;
+
+  uint64_t version = JERRY_SNAPSHOT_BUNDLE_VERSION;
+  if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, version))
+  {
+    return 0;
+  }
+
+  jerry_snapshot_bundle_header_t header;
+  header.entries_count = entries_count;
+
+  size_t header_offset = buffer_write_offset;
+  size_t index_offset = header_offset + JERRY_ALIGNUP (sizeof (jerry_snapshot_bundle_header_t), MEM_ALIGNMENT);
+  size_t names_offset = index_offset + JERRY_ALIGNUP (sizeof (jerry_snapshot_bundle_index_entry_t) * entries_count,
+                                                      MEM_ALIGNMENT);
+
+  if (names_offset > buffer_size)
+  {
+    return 0;
+  }
+  buffer_write_offset = names_offset;
+
+  for (uint32_t i = 0; i < entries_count; i++)
+  {
+    const char *name_p = sources_p[order_p[i]].name_p;
+    size_t name_size = strlen (name_p);
+
+    if (buffer_write_offset + name_size > buffer_size)
+    {
+      return 0;
+    }
+
+    memcpy (buffer_p + buffer_write_offset, name_p, name_size);
+    buffer_write_offset += name_size;
+  }
+
+  if (!jerry_snapshot_write_padding (buffer_p, buffer_size, &buffer_write_offset))
+  {
+    return 0;
+  }
+  header.names_size = (uint32_t) (buffer_write_offset - names_offset);
+
   lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
   uint32_t literals_num;
 
-  if (!lit_load_literals_from_snapshot (snapshot_data_p + snapshot_read,
-                                        header_p->lit_table_size,
-                                        &lit_map_p,
-                                        &literals_num,
-                                        is_copy))
+  if (!lit_dump_literals_for_snapshot (buffer_p,
+                                       buffer_size,
+                                       &buffer_write_offset,
+                                       &lit_map_p,
+                                       &literals_num,
+                                       &header.lit_table_size))
   {
     JERRY_ASSERT (lit_map_p == NULL);
-    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    return 0;
   }
 
-  snapshot_read += header_p->lit_table_size;
+  bool is_ok = true;
 
-  if (snapshot_read + header_p->bytecode_size + header_p->idx_to_lit_map_size > snapshot_size)
+  for (uint32_t lit_index = 0; lit_index < literals_num && is_ok; lit_index++)
   {
-    mem_heap_free_block (lit_map_p);
-    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    is_ok = jrt_write_to_buffer_by_offset (buffer_p,
+                                           buffer_size,
+                                           &buffer_write_offset,
+                                           lit_map_p[lit_index].literal_offset);
   }
 
-  const bytecode_data_header_t *bytecode_data_p;
-  bytecode_data_p = serializer_load_bytecode_with_idx_map (snapshot_data_p + snapshot_read,
-                                                           header_p->bytecode_size,
-                                                           header_p->idx_to_lit_map_size,
-                                                           lit_map_p,
-                                                           literals_num,
-                                                           is_copy);
+  is_ok = is_ok && jerry_snapshot_write_padding (buffer_p, buffer_size, &buffer_write_offset);
+
+  /*
+   * Each entry's idx-to-lit map references literals by their indexes in the entry's own list of literals,
+   * so that only the literals, used by the entry, are loaded upon the entry's execution
+   */
+  lit_cpointer_t *entry_lit_cps_p = NULL;
+  lit_mem_to_snapshot_id_map_entry_t *entry_lit_map_p = NULL;
+
+  if (literals_num != 0)
+  {
+    entry_lit_cps_p = (lit_cpointer_t *) mem_heap_alloc_block (sizeof (lit_cpointer_t) * literals_num,
+                                                               MEM_HEAP_ALLOC_SHORT_TERM);
+    entry_lit_map_p = ((lit_mem_to_snapshot_id_map_entry_t *)
+                       mem_heap_alloc_block (sizeof (lit_mem_to_snapshot_id_map_entry_t) * literals_num,
+                                             MEM_HEAP_ALLOC_SHORT_TERM));
+  }
+
+  uint32_t name_offset = 0;
+
+  for (uint32_t i = 0; i < entries_count && is_ok; i++)
+  {
+    jerry_snapshot_bundle_index_entry_t entry;
+
+    entry.name_offset = name_offset;
+    entry.name_size = (uint32_t) strlen (sources_p[order_p[i]].name_p);
+    name_offset += entry.name_size;
+    entry.is_run_global = sources_p[order_p[i]].is_for_global;
+
+    const bytecode_data_header_t *bytecode_data_p = bytecodes_p[order_p[i]];
+
+    entry.literals_offset = (uint32_t) buffer_write_offset;
+    entry.literals_num = serializer_get_bytecode_literals (bytecode_data_p, entry_lit_cps_p, literals_num);
+
+    for (uint32_t j = 0; j < entry.literals_num && is_ok; j++)
+    {
+      uint32_t lit_index;
+      for (lit_index = 0; lit_index < literals_num; lit_index++)
+      {
+        if (lit_map_p[lit_index].literal_id.packed_value == entry_lit_cps_p[j].packed_value)
+        {
+          break;
+        }
+      }
+      JERRY_ASSERT (lit_index < literals_num);
+
+      entry_lit_map_p[j] = lit_map_p[lit_index];
+
+      is_ok = jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &buffer_write_offset, lit_index);
+    }
+
+    is_ok = is_ok && jerry_snapshot_write_padding (buffer_p, buffer_size, &buffer_write_offset);
+
+    entry.bytecode_offset = (uint32_t) buffer_write_offset;
+
+    is_ok = (is_ok
+             && serializer_dump_bytecode_with_idx_map (buffer_p,
+                                                       buffer_size,
+                                                       &buffer_write_offset,
+                                                       bytecode_data_p,
+                                                       entry_lit_map_p,
+                                                       entry.literals_num,
+                                                       &entry.bytecode_size,
+                                                       &entry.idx_to_lit_map_size)
+             && jerry_snapshot_write_padding (buffer_p, buffer_size, &buffer_write_offset));
+
+    size_t entry_offset = index_offset + sizeof (jerry_snapshot_bundle_index_entry_t) * i;
+    is_ok = is_ok && jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &entry_offset, entry);
+  }
 
   if (lit_map_p != NULL)
   {
     mem_heap_free_block (lit_map_p);
   }
 
-  if (bytecode_data_p == NULL)
+  if (entry_lit_cps_p != NULL)
+  {
+    mem_heap_free_block (entry_lit_cps_p);
+    mem_heap_free_block (entry_lit_map_p);
+  }
+
+  if (!is_ok
+      || buffer_write_offset != (uint32_t) buffer_write_offset)
+  {
+    return 0;
+  }
+
+  is_ok = jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &header_offset, header);
+  JERRY_ASSERT (is_ok);
+
+  return buffer_write_offset;
+} /* jerry_snapshot_bundle_dump */
+#endif /* JERRY_ENABLE_SNAPSHOT */
+
+/**
+ * Generate snapshot bundle from specified sources
+ *
+ * Note:
+ *      literals of all entries are stored in one table, so that literals that are shared
+ *      between the entries are stored only once
+ *
+ * @return size of bundle, if it was generated succesfully
+ *          (i.e. there are no syntax errors in the sources, names of the entries are unique, buffer size
+ *           is sufficient, and snapshot support is enabled in current configuration through JERRY_ENABLE_SNAPSHOT),
+ *         0 - otherwise.
+ */
+size_t
+jerry_parse_and_save_snapshot_bundle (const jerry_api_snapshot_bundle_source_t *sources_p, /**< entries' sources */
+                                      size_t sources_count, /**< number of entries */
+                                      uint8_t *buffer_p, /**< buffer to dump bundle to */
+                                      size_t buffer_size) /**< the buffer's size */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT
+  JERRY_ASSERT (sources_p != NULL || sources_count == 0);
+
+  if (sources_count == 0
+      || sources_count != (uint32_t) sources_count)
+  {
+    return 0;
+  }
+
+  const bytecode_data_header_t **bytecodes_p;
+  bytecodes_p = (const bytecode_data_header_t **) mem_heap_alloc_block (sizeof (bytecodes_p[0]) * sources_count,
+                                                                        MEM_HEAP_ALLOC_SHORT_TERM);
+
+  bool is_ok = true;
+
+  for (size_t i = 0; i < sources_count && is_ok; i++)
+  {
+    is_ok = (jerry_snapshot_parse (sources_p[i].source_p,
+                                   sources_p[i].source_size,
+                                   sources_p[i].is_for_global,
+                                   &bytecodes_p[i]) == JSP_STATUS_OK);
+  }
+
+  size_t bundle_size = 0;
+
+  if (is_ok)
+  {
+    uint32_t *order_p = (uint32_t *) mem_heap_alloc_block (sizeof (uint32_t) * sources_count,
+                                                           MEM_HEAP_ALLOC_SHORT_TERM);
+
+    bundle_size = jerry_snapshot_bundle_dump (sources_p,
+                                              (uint32_t) sources_count,
+                                              bytecodes_p,
+                                              order_p,
+                                              buffer_p,
+                                              buffer_size);
+
+    mem_heap_free_block (order_p);
+  }
+
+  mem_heap_free_block (bytecodes_p);
+
+  return bundle_size;
+#else /* JERRY_ENABLE_SNAPSHOT */
+  (void) sources_p;
+  (void) sources_count;
+  (void) buffer_p;
+  (void) buffer_size;
+
+  return 0;
+#endif /* !JERRY_ENABLE_SNAPSHOT */
+} /* jerry_parse_and_save_snapshot_bundle */
+
+/**
+ * Execute entry of snapshot bundle
+ *
+ * Note:
+ *      only the entry's byte-code and the literals, used by the entry, are loaded
+ *
+ * @return completion code
+ */
+jerry_completion_code_t
+jerry_exec_snapshot_bundle_entry (const void *bundle_p, /**< snapshot bundle */
+                                  size_t bundle_size, /**< size of the bundle */
+                                  const char *name_p, /**< name of the entry to execute (zero-terminated string) */
+                                  bool is_copy, /**< flag, indicating whether the entry's data in the bundle
+                                                 *   should be copied to engine's memory (see also:
+                                                 *   jerry_exec_snapshot) */
+                                  jerry_api_value_t *retval_p) /**< out: returned value (ECMA-262 'undefined'
+                                                                *        if code is executed as global scope code) */
+{
+  jerry_api_convert_ecma_value_to_api_value (retval_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+#ifdef JERRY_ENABLE_SNAPSHOT
+  JERRY_ASSERT (bundle_p != NULL && name_p != NULL);
+
+  const uint8_t *bundle_data_p = (const uint8_t *) bundle_p;
+  size_t bundle_read = 0;
+
+  uint64_t version;
+  if (!jrt_read_from_buffer_by_offset (bundle_data_p, bundle_size, &bundle_read, &version))
   {
     return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
   }
 
-  jerry_completion_code_t ret_code;
+  if (version != JERRY_SNAPSHOT_BUNDLE_VERSION)
+  {
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION;
+  }
 
-  if (header_p->is_run_global)
+  jerry_snapshot_bundle_header_t header;
+  if (!jrt_read_from_buffer_by_offset (bundle_data_p, bundle_size, &bundle_read, &header)
+      || header.entries_count > bundle_size)
   {
-    vm_init (bytecode_data_p, false);
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
 
-    ret_code = vm_run_global ();
+  const size_t index_offset = sizeof (version) + JERRY_ALIGNUP (sizeof (jerry_snapshot_bundle_header_t),
+                                                                MEM_ALIGNMENT);
+  const size_t names_offset = index_offset + JERRY_ALIGNUP (sizeof (jerry_snapshot_bundle_index_entry_t)
+                                                            * header.entries_count,
+                                                            MEM_ALIGNMENT);
+  const size_t lit_table_offset = names_offset + header.names_size;
+  const size_t lit_offsets_offset = lit_table_offset + header.lit_table_size;
 
-    vm_finalize ();
+  uint32_t literals_num;
+  size_t lit_table_read = lit_table_offset;
+  if (lit_offsets_offset > bundle_size
+      || !jrt_read_from_buffer_by_offset (bundle_data_p, lit_offsets_offset, &lit_table_read, &literals_num)
+      || literals_num > bundle_size
+      || lit_offsets_offset + sizeof (uint32_t) * literals_num > bundle_size)
+  {
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
   }
-  else
+
+  /* binary search in the index, sorted by the entries' names */
+  jerry_snapshot_bundle_index_entry_t entry;
+  size_t name_size = strlen (name_p);
+
+  uint32_t lower = 0;
+  uint32_t upper = header.entries_count;
+  bool is_found = false;
+
+  while (lower < upper && !is_found)
   {
-    /* vm should be already initialized */
-    ecma_completion_value_t completion = vm_run_eval (bytecode_data_p, false);
+    uint32_t middle = lower + (upper - lower) / 2u;
 
-    ret_code = jerry_api_convert_eval_completion_to_retval (retval_p, completion);
+    size_t entry_offset = index_offset + sizeof (jerry_snapshot_bundle_index_entry_t) * middle;
+    if (!jrt_read_from_buffer_by_offset (bundle_data_p, names_offset, &entry_offset, &entry)
+        || entry.name_offset > header.names_size
+        || entry.name_size > header.names_size - entry.name_offset)
+    {
+      return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+    }
 
-    ecma_free_completion_value (completion);
+    int cmp = jerry_snapshot_bundle_compare_names (bundle_data_p + names_offset + entry.name_offset,
+                                                   entry.name_size,
+                                                   (const uint8_t *) name_p,
+                                                   name_size);
+
+    if (cmp == 0)
+    {
+      is_found = true;
+    }
+    else if (cmp < 0)
+    {
+      lower = middle + 1u;
+    }
+    else
+    {
+      upper = middle;
+    }
   }
 
-  return ret_code;
+  if (!is_found)
+  {
+    return JERRY_COMPLETION_CODE_SNAPSHOT_ENTRY_NOT_FOUND;
+  }
+
+  if (entry.literals_num > literals_num
+      || entry.literals_offset > bundle_size
+      || sizeof (uint32_t) * entry.literals_num > bundle_size - entry.literals_offset
+      || entry.bytecode_offset > bundle_size
+      || entry.bytecode_size > bundle_size - entry.bytecode_offset
+      || entry.idx_to_lit_map_size > bundle_size - entry.bytecode_offset - entry.bytecode_size)
+  {
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
+
+  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
+  bool is_ok = true;
+
+  if (entry.literals_num != 0)
+  {
+    lit_map_p = ((lit_mem_to_snapshot_id_map_entry_t *)
+                 mem_heap_alloc_block (sizeof (lit_mem_to_snapshot_id_map_entry_t) * entry.literals_num,
+                                       MEM_HEAP_ALLOC_SHORT_TERM));
+
+    size_t entry_literals_read = entry.literals_offset;
+
+    for (uint32_t i = 0; i < entry.literals_num && is_ok; i++)
+    {
+      uint32_t lit_index;
+      is_ok = (jrt_read_from_buffer_by_offset (bundle_data_p, bundle_size, &entry_literals_read, &lit_index)
+               && lit_index < literals_num);
+
+      if (is_ok)
+      {
+        size_t lit_offset_read = lit_offsets_offset + sizeof (uint32_t) * lit_index;
+        uint32_t lit_offset;
+
+        is_ok = jrt_read_from_buffer_by_offset (bundle_data_p, bundle_size, &lit_offset_read, &lit_offset);
+
+        size_t lit_read = lit_offset;
+        is_ok = (is_ok
+                 && lit_load_literal_from_snapshot (bundle_data_p + lit_table_offset,
+                                                    header.lit_table_size,
+                                                    &lit_read,
+                                                    &lit_map_p[i].literal_id));
+        lit_map_p[i].literal_offset = lit_offset;
+      }
+    }
+  }
+
+  const bytecode_data_header_t *bytecode_data_p = NULL;
+
+  if (is_ok)
+  {
+    bytecode_data_p = serializer_load_bytecode_with_idx_map (bundle_data_p + entry.bytecode_offset,
+                                                             entry.bytecode_size,
+                                                             entry.idx_to_lit_map_size,
+                                                             lit_map_p,
+                                                             entry.literals_num,
+                                                             is_copy);
+  }
+
+  if (lit_map_p != NULL)
+  {
+    mem_heap_free_block (lit_map_p);
+  }
+
+  if (bytecode_data_p == NULL)
+  {
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT;
+  }
+
+  return jerry_snapshot_run (bytecode_data_p, entry.is_run_global, retval_p);
 #else /* JERRY_ENABLE_SNAPSHOT */
-  (void) snapshot_p;
-  (void) snapshot_size;
+  (void) bundle_p;
+  (void) bundle_size;
+  (void) name_p;
   (void) is_copy;
   (void) retval_p;
 
   return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION;
 #endif /* !JERRY_ENABLE_SNAPSHOT */
-} /* jerry_exec_snapshot */
+} /* jerry_exec_snapshot_bundle_entry */
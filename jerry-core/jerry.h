@@ -41,6 +41,15 @@ typedef uint32_t jerry_flag_t;
                                                      *   FIXME: Remove. */
 #define JERRY_FLAG_ENABLE_LOG             (1u << 5) /**< enable logging */
 #define JERRY_FLAG_ABORT_ON_FAIL          (1u << 6) /**< abort instead of exit in case of failure */
+#define JERRY_FLAG_LAZY_FUNCTIONS         (1u << 7) /**< compile code of functions upon first call
+                                                     *   (in the mode, functions' bodies are checked for early
+                                                     *    errors during parse, but their byte-code is not kept,
+                                                     *    and functions' code is compiled from the script's
+                                                     *    source buffer, so the mode applies only to scripts,
+                                                     *    whose buffer is kept unchanged until jerry_cleanup,
+                                                     *    see also: is_source_kept argument of jerry_parse) */
+#define JERRY_FLAG_SNAPSHOT_STATS         (1u << 8) /**< dump time, spent on loading and on running of each
+                                                     *   executed snapshot */
 
 /**
  * Error codes
@@ -81,10 +90,14 @@ typedef void (*jerry_error_callback_t) (jerry_fatal_code_t);
 extern EXTERN_C void jerry_init (jerry_flag_t);
 extern EXTERN_C void jerry_cleanup (void);
 
+extern EXTERN_C size_t jerry_save_heap_image (uint8_t *, size_t);
+extern EXTERN_C bool jerry_init_from_heap_image (jerry_flag_t, const void *, size_t);
+
 extern EXTERN_C void jerry_get_memory_limits (size_t *, size_t *);
 extern EXTERN_C void jerry_reg_err_callback (jerry_error_callback_t);
 
-extern EXTERN_C bool jerry_parse (const jerry_api_char_t *, size_t);
+extern EXTERN_C bool jerry_parse (const jerry_api_char_t *, size_t, bool);
+extern EXTERN_C bool jerry_parse_stream (jerry_source_read_callback_t, void *, jerry_api_char_t *, size_t, bool);
 extern EXTERN_C jerry_completion_code_t jerry_run (void);
 
 extern EXTERN_C jerry_completion_code_t
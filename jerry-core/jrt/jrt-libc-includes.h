@@ -22,5 +22,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #endif /* !JRT_LIBC_INCLUDES_H */
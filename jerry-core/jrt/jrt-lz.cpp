@@ -0,0 +1,299 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * LZ77-class compression of byte arrays
+ *
+ * Compressed data is a sequence of items, each consisting of:
+ *  - token byte: number of literal bytes in the high nibble, and length of match (minus JRT_LZ_MIN_MATCH)
+ *    in the low nibble; nibble value 15 means that the rest of the value follows in variable-length encoding;
+ *  - rest of literals number (if any);
+ *  - literal bytes;
+ *  - 16-bit little-endian backward offset of match, and rest of the match's length (if any).
+ *
+ * The last item may contain only literals; decompression stops when the known uncompressed size is reached.
+ */
+
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+#include "jrt-lz.h"
+
+/**
+ * Minimum length of a match
+ */
+#define JRT_LZ_MIN_MATCH (4u)
+
+/**
+ * Maximum backward offset of a match
+ */
+#define JRT_LZ_MAX_OFFSET (0xffffu)
+
+/**
+ * Maximum value, stored in a nibble of item's token
+ */
+#define JRT_LZ_NIBBLE_MAX (0xfu)
+
+/**
+ * Calculate hash of JRT_LZ_MIN_MATCH bytes
+ *
+ * @return hash value
+ */
+static uint32_t
+jrt_lz_hash (const uint8_t *data_p) /**< data */
+{
+  uint32_t value;
+  memcpy (&value, data_p, sizeof (value));
+
+  return (value * 2654435761u) >> (32u - JRT_LZ_HASH_LOG);
+} /* jrt_lz_hash */
+
+/**
+ * Write a compressed item
+ *
+ * @return true, if the item was written successfully (i.e. buffer size is sufficient),
+ *         false - otherwise.
+ */
+static bool
+jrt_lz_write_item (uint8_t *dst_p, /**< buffer for compressed data */
+                   size_t dst_size, /**< size of the buffer */
+                   size_t *in_out_dst_offset_p, /**< in-out: buffer write offset */
+                   const uint8_t *literals_p, /**< literal bytes */
+                   size_t literals_num, /**< number of literal bytes */
+                   size_t match_offset, /**< backward offset of match */
+                   size_t match_length) /**< length of match (0 - if there is no match) */
+{
+  JERRY_ASSERT (match_length == 0 || (match_length >= JRT_LZ_MIN_MATCH && match_offset <= JRT_LZ_MAX_OFFSET));
+
+  size_t match_length_code = (match_length == 0) ? 0 : match_length - JRT_LZ_MIN_MATCH;
+
+  uint8_t token = (uint8_t) ((JERRY_MIN (literals_num, JRT_LZ_NIBBLE_MAX) << 4u)
+                             | JERRY_MIN (match_length_code, JRT_LZ_NIBBLE_MAX));
+
+  if (!jrt_write_to_buffer_by_offset (dst_p, dst_size, in_out_dst_offset_p, token))
+  {
+    return false;
+  }
+
+  if (literals_num >= JRT_LZ_NIBBLE_MAX
+      && !jrt_write_varint_to_buffer_by_offset (dst_p,
+                                                dst_size,
+                                                in_out_dst_offset_p,
+                                                (uint32_t) (literals_num - JRT_LZ_NIBBLE_MAX)))
+  {
+    return false;
+  }
+
+  if (*in_out_dst_offset_p + literals_num > dst_size)
+  {
+    return false;
+  }
+
+  memcpy (dst_p + *in_out_dst_offset_p, literals_p, literals_num);
+  *in_out_dst_offset_p += literals_num;
+
+  if (match_length == 0)
+  {
+    return true;
+  }
+
+  uint8_t offset_low = (uint8_t) (match_offset & 0xffu);
+  uint8_t offset_high = (uint8_t) (match_offset >> 8u);
+
+  if (!jrt_write_to_buffer_by_offset (dst_p, dst_size, in_out_dst_offset_p, offset_low)
+      || !jrt_write_to_buffer_by_offset (dst_p, dst_size, in_out_dst_offset_p, offset_high))
+  {
+    return false;
+  }
+
+  return (match_length_code < JRT_LZ_NIBBLE_MAX
+          || jrt_write_varint_to_buffer_by_offset (dst_p,
+                                                   dst_size,
+                                                   in_out_dst_offset_p,
+                                                   (uint32_t) (match_length_code - JRT_LZ_NIBBLE_MAX)));
+} /* jrt_lz_write_item */
+
+/**
+ * Compress data
+ *
+ * @return size of compressed data, if compression completed successfully (i.e. buffer size is sufficient),
+ *         0 - otherwise.
+ */
+size_t
+jrt_lz_compress (const uint8_t *src_p, /**< data to compress */
+                 size_t src_size, /**< size of the data */
+                 uint8_t *dst_p, /**< buffer for compressed data */
+                 size_t dst_size, /**< size of the buffer */
+                 uint32_t *hash_table_p) /**< buffer of JRT_LZ_HASH_TABLE_SIZE bytes for the compressor's
+                                          *   hash table, containing positions of last occurrences
+                                          *   of byte sequences with corresponding hashes (plus one) */
+{
+  memset (hash_table_p, 0, JRT_LZ_HASH_TABLE_SIZE);
+
+  size_t dst_offset = 0;
+  size_t literals_start = 0;
+  size_t pos = 0;
+
+  while (pos + JRT_LZ_MIN_MATCH <= src_size)
+  {
+    uint32_t hash = jrt_lz_hash (src_p + pos);
+    size_t candidate_pos_plus_one = hash_table_p[hash];
+    hash_table_p[hash] = (uint32_t) (pos + 1u);
+
+    if (candidate_pos_plus_one == 0
+        || pos - (candidate_pos_plus_one - 1u) > JRT_LZ_MAX_OFFSET
+        || memcmp (src_p + candidate_pos_plus_one - 1u, src_p + pos, JRT_LZ_MIN_MATCH) != 0)
+    {
+      pos++;
+      continue;
+    }
+
+    size_t candidate_pos = candidate_pos_plus_one - 1u;
+    size_t match_length = JRT_LZ_MIN_MATCH;
+
+    while (pos + match_length < src_size
+           && src_p[candidate_pos + match_length] == src_p[pos + match_length])
+    {
+      match_length++;
+    }
+
+    if (!jrt_lz_write_item (dst_p,
+                            dst_size,
+                            &dst_offset,
+                            src_p + literals_start,
+                            pos - literals_start,
+                            pos - candidate_pos,
+                            match_length))
+    {
+      return 0;
+    }
+
+    pos += match_length;
+    literals_start = pos;
+  }
+
+  if (literals_start < src_size
+      && !jrt_lz_write_item (dst_p, dst_size, &dst_offset, src_p + literals_start, src_size - literals_start, 0, 0))
+  {
+    return 0;
+  }
+
+  return dst_offset;
+} /* jrt_lz_compress */
+
+/**
+ * Decompress data
+ *
+ * @return true, if the compressed data is valid and its uncompressed size is equal to the specified size,
+ *         false - otherwise.
+ */
+bool
+jrt_lz_decompress (const uint8_t *src_p, /**< compressed data */
+                   size_t src_size, /**< size of the compressed data */
+                   uint8_t *dst_p, /**< buffer for uncompressed data */
+                   size_t dst_size) /**< size of uncompressed data */
+{
+  size_t src_offset = 0;
+  size_t dst_offset = 0;
+
+  while (dst_offset < dst_size)
+  {
+    uint8_t token;
+
+    if (!jrt_read_from_buffer_by_offset (src_p, src_size, &src_offset, &token))
+    {
+      return false;
+    }
+
+    size_t literals_num = (size_t) (token >> 4u);
+
+    if (literals_num == JRT_LZ_NIBBLE_MAX)
+    {
+      uint32_t literals_num_rest;
+
+      if (!jrt_read_varint_from_buffer_by_offset (src_p, src_size, &src_offset, &literals_num_rest))
+      {
+        return false;
+      }
+
+      literals_num += literals_num_rest;
+    }
+
+    if (literals_num > src_size - src_offset
+        || literals_num > dst_size - dst_offset)
+    {
+      return false;
+    }
+
+    memcpy (dst_p + dst_offset, src_p + src_offset, literals_num);
+    src_offset += literals_num;
+    dst_offset += literals_num;
+
+    if (dst_offset == dst_size)
+    {
+      break;
+    }
+
+    uint8_t offset_low, offset_high;
+
+    if (!jrt_read_from_buffer_by_offset (src_p, src_size, &src_offset, &offset_low)
+        || !jrt_read_from_buffer_by_offset (src_p, src_size, &src_offset, &offset_high))
+    {
+      return false;
+    }
+
+    size_t match_offset = (size_t) offset_low | ((size_t) offset_high << 8u);
+    size_t match_length = (size_t) (token & JRT_LZ_NIBBLE_MAX);
+
+    if (match_length == JRT_LZ_NIBBLE_MAX)
+    {
+      uint32_t match_length_rest;
+
+      if (!jrt_read_varint_from_buffer_by_offset (src_p, src_size, &src_offset, &match_length_rest))
+      {
+        return false;
+      }
+
+      match_length += match_length_rest;
+    }
+
+    match_length += JRT_LZ_MIN_MATCH;
+
+    if (match_offset == 0
+        || match_offset > dst_offset
+        || match_length > dst_size - dst_offset)
+    {
+      return false;
+    }
+
+    const uint8_t *match_p = dst_p + dst_offset - match_offset;
+
+    if (match_offset >= match_length)
+    {
+      memcpy (dst_p + dst_offset, match_p, match_length);
+    }
+    else
+    {
+      /* the match overlaps with the data being produced */
+      for (size_t i = 0; i < match_length; i++)
+      {
+        dst_p[dst_offset + i] = match_p[i];
+      }
+    }
+
+    dst_offset += match_length;
+  }
+
+  return (src_offset == src_size);
+} /* jrt_lz_decompress */
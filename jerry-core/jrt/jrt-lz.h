@@ -0,0 +1,32 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LZ_H
+#define JERRY_LZ_H
+
+/**
+ * Logarithm of number of entries in hash table, used by the compressor to look for matches
+ */
+#define JRT_LZ_HASH_LOG (12u)
+
+/**
+ * Size of buffer for the compressor's hash table
+ */
+#define JRT_LZ_HASH_TABLE_SIZE ((1u << JRT_LZ_HASH_LOG) * sizeof (uint32_t))
+
+extern size_t jrt_lz_compress (const uint8_t *, size_t, uint8_t *, size_t, uint32_t *);
+extern bool jrt_lz_decompress (const uint8_t *, size_t, uint8_t *, size_t);
+
+#endif /* !JERRY_LZ_H */
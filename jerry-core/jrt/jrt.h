@@ -282,4 +282,90 @@ jrt_write_to_buffer_by_offset (uint8_t *buffer_p, /**< buffer */
   return true;
 } /* jrt_write_to_buffer_by_offset */
 
+/**
+ * Write unsigned integer to specified buffer in variable-length encoding
+ *
+ * The value is written in groups of 7 bits, starting from the least significant group;
+ * the most significant bit of each byte indicates whether more bytes follow.
+ *
+ * Note:
+ *      Offset is in-out and is incremented if the write operation completes successfully.
+ *
+ * @return true, if write was successful, i.e. the encoded value fits into the buffer,
+ *         false - otherwise.
+ */
+inline bool __attr_always_inline___
+jrt_write_varint_to_buffer_by_offset (uint8_t *buffer_p, /**< buffer */
+                                      size_t buffer_size, /**< size of buffer */
+                                      size_t *in_out_buffer_offset_p, /**< in: offset to write to,
+                                                                       *   out: offset, incremented on
+                                                                       *        size of encoded value */
+                                      uint32_t value) /**< value */
+{
+  size_t offset = *in_out_buffer_offset_p;
+
+  do
+  {
+    if (offset >= buffer_size)
+    {
+      return false;
+    }
+
+    uint8_t byte = (uint8_t) (value & 0x7fu);
+    value >>= 7;
+
+    buffer_p[offset++] = (uint8_t) (value != 0 ? (byte | 0x80u) : byte);
+  }
+  while (value != 0);
+
+  *in_out_buffer_offset_p = offset;
+
+  return true;
+} /* jrt_write_varint_to_buffer_by_offset */
+
+/**
+ * Read unsigned integer in variable-length encoding from specified buffer
+ *
+ * See also:
+ *          jrt_write_varint_to_buffer_by_offset
+ *
+ * Note:
+ *      Offset is in-out and is incremented if the read operation completes successfully.
+ *
+ * @return true, if read was successful, i.e. the encoded value is not truncated and fits into uint32_t,
+ *         false - otherwise.
+ */
+inline bool __attr_always_inline___
+jrt_read_varint_from_buffer_by_offset (const uint8_t *buffer_p, /**< buffer */
+                                       size_t buffer_size, /**< size of buffer */
+                                       size_t *in_out_buffer_offset_p, /**< in: offset to read from,
+                                                                        *   out: offset, incremented on
+                                                                        *        size of encoded value */
+                                       uint32_t *out_value_p) /**< out: value */
+{
+  size_t offset = *in_out_buffer_offset_p;
+  uint32_t value = 0;
+
+  for (uint32_t shift = 0; shift < 32; shift += 7)
+  {
+    if (offset >= buffer_size)
+    {
+      return false;
+    }
+
+    uint8_t byte = buffer_p[offset++];
+    value |= ((uint32_t) (byte & 0x7fu)) << shift;
+
+    if ((byte & 0x80u) == 0)
+    {
+      *in_out_buffer_offset_p = offset;
+      *out_value_p = value;
+
+      return true;
+    }
+  }
+
+  return false;
+} /* jrt_read_varint_from_buffer_by_offset */
+
 #endif /* !JERRY_GLOBALS_H */
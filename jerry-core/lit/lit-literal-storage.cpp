@@ -55,6 +55,66 @@ lit_charset_record_t::set_prev (rcs_record_t *prev_rec_p) /**< pointer to the re
   it.write<uint16_t> (cpointer_t::compress (prev_rec_p).packed_value);
 } /* lit_charset_record_t::set_prev */
 
+/**
+ * Get the number of references to the record from ecma-strings
+ *
+ * @return references count
+ */
+uint16_t
+lit_charset_record_t::get_refs () const
+{
+  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+  it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
+  it.skip<uint16_t> ();
+
+  return it.read<uint16_t> ();
+} /* lit_charset_record_t::get_refs */
+
+/**
+ * Set the number of references to the record from ecma-strings
+ */
+void
+lit_charset_record_t::set_refs (uint16_t refs) /**< references count */
+{
+  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+  it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
+  it.skip<uint16_t> ();
+
+  it.write<uint16_t> (refs);
+} /* lit_charset_record_t::set_refs */
+
+/**
+ * Increase references count of the record
+ *
+ * Note:
+ *      upon overflow of the counter, the record becomes pinned, i.e. it would never be freed
+ */
+void
+lit_charset_record_t::ref ()
+{
+  uint16_t refs = get_refs ();
+
+  if (refs != _refs_pinned)
+  {
+    set_refs ((uint16_t) (refs + 1));
+  }
+} /* lit_charset_record_t::ref */
+
+/**
+ * Decrease references count of the record
+ */
+void
+lit_charset_record_t::deref ()
+{
+  uint16_t refs = get_refs ();
+  JERRY_ASSERT (refs != 0);
+
+  if (refs != _refs_pinned)
+  {
+    set_refs ((uint16_t) (refs - 1));
+  }
+} /* lit_charset_record_t::deref */
+
 /**
  * Set the charset of the record
  */
@@ -277,6 +337,47 @@ lit_number_record_t::dump_for_snapshot (uint8_t *buffer_p, /**< buffer to dump t
   return ((uint32_t) sizeof (num));
 } /* lit_number_record_t::dump_for_snapshot */
 
+/**
+ * Initialize the literal storage
+ */
+void
+lit_literal_storage_t::init (void)
+{
+  rcs_recordset_t::init ();
+
+  _index_p = NULL;
+  _index_size = 0;
+  _index_count = 0;
+
+  _collectable_count = 0;
+  _collectable_count_after_gc = 0;
+} /* lit_literal_storage_t::init */
+
+/**
+ * Free all records of the literal storage, and the storage's index
+ */
+void
+lit_literal_storage_t::cleanup (void)
+{
+  index_free ();
+
+  _collectable_count = 0;
+  _collectable_count_after_gc = 0;
+
+  rcs_recordset_t::cleanup ();
+} /* lit_literal_storage_t::cleanup */
+
+/**
+ * Finalize the literal storage
+ */
+void
+lit_literal_storage_t::finalize (void)
+{
+  index_free ();
+
+  rcs_recordset_t::finalize ();
+} /* lit_literal_storage_t::finalize */
+
 /**
  * Create charset record in the literal storage
  *
@@ -294,6 +395,16 @@ lit_literal_storage_t::create_charset_record (const lit_utf8_byte_t *str, /**< s
   ret->set_alignment_bytes_count (alignment);
   ret->set_charset (str, buf_size);
   ret->set_hash (lit_utf8_string_calc_hash (str, ret->get_length ()));
+  ret->set_marked (false);
+  ret->set_refs (0);
+
+  _collectable_count++;
+
+  index_hash_t index_hash = index_hash_string (str, buf_size);
+  if (index_find_string (str, buf_size, index_hash) == NULL)
+  {
+    index_insert (ret, index_hash);
+  }
 
   return ret;
 } /* lit_literal_storage_t::create_charset_record */
@@ -309,6 +420,15 @@ lit_literal_storage_t::create_magic_record (lit_magic_string_id_t id) /**< id of
   lit_magic_record_t *ret = alloc_record<lit_magic_record_t> (LIT_MAGIC_STR);
   ret->set_magic_str_id (id);
 
+  const lit_utf8_byte_t *str_p = lit_get_magic_string_utf8 (id);
+  lit_utf8_size_t str_size = lit_get_magic_string_size (id);
+
+  index_hash_t index_hash = index_hash_string (str_p, str_size);
+  if (index_find_string (str_p, str_size, index_hash) == NULL)
+  {
+    index_insert (ret, index_hash);
+  }
+
   return ret;
 } /* lit_literal_storage_t::create_magic_record */
 
@@ -323,6 +443,15 @@ lit_literal_storage_t::create_magic_record_ex (lit_magic_string_ex_id_t id) /**<
   lit_magic_record_t *ret = alloc_record<lit_magic_record_t> (LIT_MAGIC_STR_EX);
   ret->set_magic_str_id (id);
 
+  const lit_utf8_byte_t *str_p = lit_get_magic_string_ex_utf8 (id);
+  lit_utf8_size_t str_size = lit_get_magic_string_ex_size (id);
+
+  index_hash_t index_hash = index_hash_string (str_p, str_size);
+  if (index_find_string (str_p, str_size, index_hash) == NULL)
+  {
+    index_insert (ret, index_hash);
+  }
+
   return ret;
 } /* lit_literal_storage_t::create_magic_record_ex */
 
@@ -340,9 +469,535 @@ lit_literal_storage_t::create_number_record (ecma_number_t num) /**< number */
   it_this.skip (ret->header_size ());
   it_this.write<ecma_number_t> (num);
 
+  ret->set_marked (false);
+
+  _collectable_count++;
+
+  index_hash_t index_hash = index_hash_number (num);
+  if (index_find_number (num, index_hash) == NULL)
+  {
+    index_insert (ret, index_hash);
+  }
+
   return ret;
 } /* lit_literal_storage_t::create_number_record */
 
+/**
+ * Find charset or magic string record, holding the specified string
+ *
+ * @return pointer to the record - if a literal with the string exists,
+ *         NULL - otherwise
+ */
+rcs_record_t *
+lit_literal_storage_t::find_string_record (const lit_utf8_byte_t *str_p, /**< string to search for */
+                                           lit_utf8_size_t str_size) /**< size of the string */
+{
+  return index_find_string (str_p, str_size, index_hash_string (str_p, str_size));
+} /* lit_literal_storage_t::find_string_record */
+
+/**
+ * Find number record, holding the specified number
+ *
+ * @return pointer to the record - if a literal with the number exists,
+ *         NULL - otherwise
+ */
+rcs_record_t *
+lit_literal_storage_t::find_number_record (ecma_number_t num) /**< number to search for */
+{
+  return index_find_number (num, index_hash_number (num));
+} /* lit_literal_storage_t::find_number_record */
+
+/**
+ * Mark the record as used during literal storage garbage collection
+ *
+ * Note:
+ *      magic string records are never freed, so they are not marked
+ */
+void
+lit_literal_storage_t::mark_record (rcs_record_t *rec_p) /**< record to mark */
+{
+  switch (rec_p->get_type ())
+  {
+    case LIT_STR:
+    {
+      static_cast<lit_charset_record_t *> (rec_p)->set_marked (true);
+      break;
+    }
+    case LIT_NUMBER:
+    {
+      static_cast<lit_number_record_t *> (rec_p)->set_marked (true);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (rec_p->get_type () == LIT_MAGIC_STR
+                    || rec_p->get_type () == LIT_MAGIC_STR_EX);
+      break;
+    }
+  }
+} /* lit_literal_storage_t::mark_record */
+
+/**
+ * Free charset and number records that were not marked and are not referenced from ecma-strings,
+ * and clear marks of the remaining records.
+ *
+ * Note:
+ *      records are not moved, as compressed pointers to them are held by byte-code and ecma-strings;
+ *      instead, adjacent free records are merged and chunked list's nodes that became unused are released
+ *      (see also: rcs_recordset_t::free_record).
+ *
+ * @return number of freed records
+ */
+uint32_t
+lit_literal_storage_t::free_unmarked_records (void)
+{
+  uint32_t freed_count = 0;
+
+  rcs_record_t *rec_p = get_first ();
+
+  while (rec_p != NULL)
+  {
+    rcs_record_t *next_rec_p = get_next (rec_p);
+
+    /* free records, adjacent to the record, are merged with it upon the record's deallocation */
+    while (next_rec_p != NULL
+           && next_rec_p->get_type () < _first_type_id)
+    {
+      next_rec_p = get_next (next_rec_p);
+    }
+
+    bool is_unused = false;
+
+    switch (rec_p->get_type ())
+    {
+      case LIT_STR:
+      {
+        lit_charset_record_t *charset_rec_p = static_cast<lit_charset_record_t *> (rec_p);
+
+        is_unused = (!charset_rec_p->is_marked () && charset_rec_p->get_refs () == 0);
+        charset_rec_p->set_marked (false);
+
+        break;
+      }
+      case LIT_NUMBER:
+      {
+        lit_number_record_t *number_rec_p = static_cast<lit_number_record_t *> (rec_p);
+
+        is_unused = !number_rec_p->is_marked ();
+        number_rec_p->set_marked (false);
+
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+
+    if (is_unused)
+    {
+      index_remove (rec_p, index_hash_record (rec_p));
+      free_record (rec_p);
+
+      JERRY_ASSERT (_collectable_count != 0);
+      _collectable_count--;
+
+      freed_count++;
+    }
+
+    rec_p = next_rec_p;
+  }
+
+  _collectable_count_after_gc = _collectable_count;
+
+  return freed_count;
+} /* lit_literal_storage_t::free_unmarked_records */
+
+/**
+ * Check whether enough charset and number records were created since previous garbage collection
+ * for the next collection to be worth its cost
+ *
+ * @return true - if garbage collection is recommended,
+ *         false - otherwise
+ */
+bool
+lit_literal_storage_t::is_gc_recommended (void) const
+{
+  JERRY_ASSERT (_collectable_count >= _collectable_count_after_gc);
+
+  uint32_t new_records_count = _collectable_count - _collectable_count_after_gc;
+
+  return (new_records_count >= _gc_min_new_records
+          && new_records_count >= _collectable_count_after_gc);
+} /* lit_literal_storage_t::is_gc_recommended */
+
+/**
+ * Calculate index hash of a string
+ *
+ * Note:
+ *      unlike the hash stored in charset records, all characters of the string are taken into account,
+ *      so that identifiers with common suffix are spread over the index
+ *
+ * @return hash value
+ */
+lit_literal_storage_t::index_hash_t
+lit_literal_storage_t::index_hash_string (const lit_utf8_byte_t *str_p, /**< string */
+                                          lit_utf8_size_t str_size) /**< size of the string */
+{
+  JERRY_ASSERT (str_p != NULL || str_size == 0);
+
+  /* 32 bit FNV-1a */
+  uint32_t hash = 2166136261u;
+
+  for (lit_utf8_size_t i = 0; i < str_size; i++)
+  {
+    hash ^= str_p[i];
+    hash *= 16777619u;
+  }
+
+  return (index_hash_t) ((hash >> 16) ^ hash);
+} /* lit_literal_storage_t::index_hash_string */
+
+/**
+ * Calculate index hash of a number
+ *
+ * @return hash value
+ */
+lit_literal_storage_t::index_hash_t
+lit_literal_storage_t::index_hash_number (ecma_number_t num) /**< number */
+{
+  if (num == 0)
+  {
+    /* zero and negative zero are equal, and so, should get the same hash */
+    num = 0;
+  }
+
+  lit_utf8_byte_t bytes[sizeof (ecma_number_t)];
+  memcpy (bytes, &num, sizeof (num));
+
+  return index_hash_string (bytes, (lit_utf8_size_t) sizeof (bytes));
+} /* lit_literal_storage_t::index_hash_number */
+
+/**
+ * Calculate index hash of the record's value
+ *
+ * @return hash value
+ */
+lit_literal_storage_t::index_hash_t
+lit_literal_storage_t::index_hash_record (rcs_record_t *rec_p) /**< record */
+{
+  switch (rec_p->get_type ())
+  {
+    case LIT_STR:
+    {
+      lit_charset_record_t *charset_rec_p = static_cast<lit_charset_record_t *> (rec_p);
+      lit_utf8_size_t length = charset_rec_p->get_length ();
+
+      /* 32 bit FNV-1a (see also: lit_literal_storage_t::index_hash_string) */
+      uint32_t hash = 2166136261u;
+
+      rcs_record_iterator_t it (this, rec_p);
+      it.skip (lit_charset_record_t::header_size ());
+
+      for (lit_utf8_size_t i = 0; i < length; i++)
+      {
+        hash ^= it.read<lit_utf8_byte_t> ();
+        hash *= 16777619u;
+
+        it.skip<lit_utf8_byte_t> ();
+      }
+
+      return (index_hash_t) ((hash >> 16) ^ hash);
+    }
+    case LIT_MAGIC_STR:
+    {
+      lit_magic_string_id_t id = lit_magic_record_get_magic_str_id (rec_p);
+
+      return index_hash_string (lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+    }
+    case LIT_MAGIC_STR_EX:
+    {
+      lit_magic_string_ex_id_t id = lit_magic_record_ex_get_magic_str_id (rec_p);
+
+      return index_hash_string (lit_get_magic_string_ex_utf8 (id), lit_get_magic_string_ex_size (id));
+    }
+    default:
+    {
+      JERRY_ASSERT (rec_p->get_type () == LIT_NUMBER);
+
+      return index_hash_number (static_cast<lit_number_record_t *> (rec_p)->get_number ());
+    }
+  }
+} /* lit_literal_storage_t::index_hash_record */
+
+/**
+ * Lookup the index for a charset or magic string record, holding the specified string
+ *
+ * @return pointer to the record - if found,
+ *         NULL - otherwise
+ */
+rcs_record_t *
+lit_literal_storage_t::index_find_string (const lit_utf8_byte_t *str_p, /**< string to search for */
+                                          lit_utf8_size_t str_size, /**< size of the string */
+                                          index_hash_t hash) /**< index hash of the string */
+{
+  if (_index_p == NULL)
+  {
+    return NULL;
+  }
+
+  const uint32_t mask = _index_size - 1;
+
+  for (uint32_t slot = hash & mask;
+       _index_p[slot].rec_cp != MEM_CP_NULL;
+       slot = (slot + 1) & mask)
+  {
+    if (_index_p[slot].hash != hash)
+    {
+      continue;
+    }
+
+    rcs_cpointer_t cpointer;
+    cpointer.packed_value = _index_p[slot].rec_cp;
+    rcs_record_t *rec_p = rcs_cpointer_t::decompress (cpointer);
+
+    switch (rec_p->get_type ())
+    {
+      case LIT_STR:
+      {
+        lit_charset_record_t *charset_rec_p = static_cast<lit_charset_record_t *> (rec_p);
+
+        if (charset_rec_p->get_length () == str_size
+            && charset_rec_p->is_equal_utf8_string (str_p, str_size))
+        {
+          return rec_p;
+        }
+
+        break;
+      }
+      case LIT_MAGIC_STR:
+      {
+        lit_magic_string_id_t magic_id = lit_magic_record_get_magic_str_id (rec_p);
+
+        if (lit_compare_utf8_string_and_magic_string (str_p, str_size, magic_id))
+        {
+          return rec_p;
+        }
+
+        break;
+      }
+      case LIT_MAGIC_STR_EX:
+      {
+        lit_magic_string_ex_id_t magic_id = lit_magic_record_ex_get_magic_str_id (rec_p);
+
+        if (lit_compare_utf8_string_and_magic_string_ex (str_p, str_size, magic_id))
+        {
+          return rec_p;
+        }
+
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (rec_p->get_type () == LIT_NUMBER);
+
+        break;
+      }
+    }
+  }
+
+  return NULL;
+} /* lit_literal_storage_t::index_find_string */
+
+/**
+ * Lookup the index for a number record, holding the specified number
+ *
+ * @return pointer to the record - if found,
+ *         NULL - otherwise
+ */
+rcs_record_t *
+lit_literal_storage_t::index_find_number (ecma_number_t num, /**< number to search for */
+                                          index_hash_t hash) /**< index hash of the number */
+{
+  if (_index_p == NULL)
+  {
+    return NULL;
+  }
+
+  const uint32_t mask = _index_size - 1;
+
+  for (uint32_t slot = hash & mask;
+       _index_p[slot].rec_cp != MEM_CP_NULL;
+       slot = (slot + 1) & mask)
+  {
+    if (_index_p[slot].hash != hash)
+    {
+      continue;
+    }
+
+    rcs_cpointer_t cpointer;
+    cpointer.packed_value = _index_p[slot].rec_cp;
+    rcs_record_t *rec_p = rcs_cpointer_t::decompress (cpointer);
+
+    if (rec_p->get_type () == LIT_NUMBER
+        && static_cast<lit_number_record_t *> (rec_p)->get_number () == num)
+    {
+      return rec_p;
+    }
+  }
+
+  return NULL;
+} /* lit_literal_storage_t::index_find_number */
+
+/**
+ * Put the record to the index, growing the index if its load factor becomes too high
+ */
+void
+lit_literal_storage_t::index_insert (rcs_record_t *rec_p, /**< record to put */
+                                     index_hash_t hash) /**< index hash of the record's value */
+{
+  if (_index_p == NULL)
+  {
+    index_resize (_index_initial_size);
+  }
+  else if ((_index_count + 1) * 4u > _index_size * 3u)
+  {
+    index_resize (_index_size * 2u);
+  }
+
+  JERRY_ASSERT (_index_count < _index_size);
+
+  const uint32_t mask = _index_size - 1;
+  uint32_t slot = hash & mask;
+
+  while (_index_p[slot].rec_cp != MEM_CP_NULL)
+  {
+    slot = (slot + 1) & mask;
+  }
+
+  _index_p[slot].hash = hash;
+  _index_p[slot].rec_cp = rcs_cpointer_t::compress (rec_p).packed_value;
+
+  _index_count++;
+} /* lit_literal_storage_t::index_insert */
+
+/**
+ * Remove the record from the index, if it is indexed
+ */
+void
+lit_literal_storage_t::index_remove (rcs_record_t *rec_p, /**< record to remove */
+                                     index_hash_t hash) /**< index hash of the record's value */
+{
+  if (_index_p == NULL)
+  {
+    return;
+  }
+
+  const uint32_t mask = _index_size - 1;
+  const uint16_t rec_cp = rcs_cpointer_t::compress (rec_p).packed_value;
+
+  uint32_t slot = hash & mask;
+
+  while (_index_p[slot].rec_cp != rec_cp)
+  {
+    if (_index_p[slot].rec_cp == MEM_CP_NULL)
+    {
+      /* the record is a duplicate of another literal, and so, was not indexed */
+      return;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  /* backward shift of the following entries of the probe sequence into the freed slot */
+  for (uint32_t next_slot = (slot + 1) & mask;
+       _index_p[next_slot].rec_cp != MEM_CP_NULL;
+       next_slot = (next_slot + 1) & mask)
+  {
+    uint32_t home_slot = _index_p[next_slot].hash & mask;
+
+    bool is_home_between = ((slot <= next_slot)
+                            ? (slot < home_slot && home_slot <= next_slot)
+                            : (slot < home_slot || home_slot <= next_slot));
+
+    if (!is_home_between)
+    {
+      _index_p[slot] = _index_p[next_slot];
+      slot = next_slot;
+    }
+  }
+
+  _index_p[slot].hash = 0;
+  _index_p[slot].rec_cp = MEM_CP_NULL;
+
+  JERRY_ASSERT (_index_count != 0);
+  _index_count--;
+} /* lit_literal_storage_t::index_remove */
+
+/**
+ * Reallocate the index with the specified number of slots, and re-insert all its entries
+ */
+void
+lit_literal_storage_t::index_resize (uint32_t new_size) /**< new number of slots (power of 2) */
+{
+  JERRY_ASSERT (new_size != 0 && (new_size & (new_size - 1)) == 0);
+  JERRY_ASSERT (new_size > _index_count);
+
+  /*
+   * the index is grown only when its load factor would exceed 0.75 (see also: index_insert),
+   * and every record has a distinct compressed pointer, so the index never has more than
+   * 2 ^ (MEM_CP_WIDTH + 1) slots
+   */
+  JERRY_ASSERT (new_size <= (1u << (MEM_CP_WIDTH + 1)));
+
+  index_entry_t *new_index_p = (index_entry_t *) mem_heap_alloc_block (new_size * sizeof (index_entry_t),
+                                                                       MEM_HEAP_ALLOC_LONG_TERM);
+  memset (new_index_p, 0, new_size * sizeof (index_entry_t));
+
+  const uint32_t new_mask = new_size - 1;
+
+  for (uint32_t i = 0; i < _index_size; i++)
+  {
+    if (_index_p[i].rec_cp == MEM_CP_NULL)
+    {
+      continue;
+    }
+
+    uint32_t slot = _index_p[i].hash & new_mask;
+
+    while (new_index_p[slot].rec_cp != MEM_CP_NULL)
+    {
+      slot = (slot + 1) & new_mask;
+    }
+
+    new_index_p[slot] = _index_p[i];
+  }
+
+  if (_index_p != NULL)
+  {
+    mem_heap_free_block (_index_p);
+  }
+
+  _index_p = new_index_p;
+  _index_size = new_size;
+} /* lit_literal_storage_t::index_resize */
+
+/**
+ * Free the index
+ */
+void
+lit_literal_storage_t::index_free (void)
+{
+  if (_index_p != NULL)
+  {
+    mem_heap_free_block (_index_p);
+  }
+
+  _index_p = NULL;
+  _index_size = 0;
+  _index_count = 0;
+} /* lit_literal_storage_t::index_free */
+
 /**
  * Count literal records in the storage
  *
@@ -690,6 +1345,109 @@ lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< output snapshot buffer *
   return true;
 } /* lit_dump_literals_for_snapshot */
 
+/**
+ * Load literal, which dump is placed at specified offset of literal table in snapshot
+ *
+ * @return true, if load was performed successfully (i.e. literal's dump in the snapshot is consistent),
+ *         false - otherwise (i.e. snapshot is incorrect).
+ */
+bool
+lit_load_literal_from_snapshot (const uint8_t *lit_table_p, /**< buffer with literal table in snapshot */
+                                uint32_t lit_table_size, /**< size of literal table in snapshot */
+                                size_t *in_out_lit_table_read_p, /**< in: offset of the literal in the table,
+                                                                  *   out: offset of the next literal */
+                                lit_cpointer_t *out_lit_cp_p) /**< out: identifier of loaded literal
+                                                               *        in literal storage */
+{
+  rcs_record_t::type_t type;
+  if (!jrt_read_from_buffer_by_offset (lit_table_p,
+                                       lit_table_size,
+                                       in_out_lit_table_read_p,
+                                       &type))
+  {
+    return false;
+  }
+
+  literal_t lit;
+
+  if (type == LIT_STR_T)
+  {
+    lit_utf8_size_t length;
+    if (!jrt_read_from_buffer_by_offset (lit_table_p,
+                                         lit_table_size,
+                                         in_out_lit_table_read_p,
+                                         &length)
+        || (*in_out_lit_table_read_p + length > lit_table_size))
+    {
+      return false;
+    }
+
+    lit = lit_find_or_create_literal_from_utf8_string (lit_table_p + *in_out_lit_table_read_p, length);
+    *in_out_lit_table_read_p += length;
+  }
+  else if (type == LIT_MAGIC_STR_T)
+  {
+    lit_magic_string_id_t id;
+    if (!jrt_read_from_buffer_by_offset (lit_table_p,
+                                         lit_table_size,
+                                         in_out_lit_table_read_p,
+                                         &id))
+    {
+      return false;
+    }
+
+    const lit_utf8_byte_t *magic_str_p = lit_get_magic_string_utf8 (id);
+    lit_utf8_size_t magic_str_sz = lit_get_magic_string_size (id);
+
+    /*
+     * TODO:
+     *      Consider searching literal storage by magic string identifier instead of by its value
+     */
+    lit = lit_find_or_create_literal_from_utf8_string (magic_str_p, magic_str_sz);
+  }
+  else if (type == LIT_MAGIC_STR_EX_T)
+  {
+    lit_magic_string_ex_id_t id;
+    if (!jrt_read_from_buffer_by_offset (lit_table_p,
+                                         lit_table_size,
+                                         in_out_lit_table_read_p,
+                                         &id))
+    {
+      return false;
+    }
+
+    const lit_utf8_byte_t *magic_str_ex_p = lit_get_magic_string_ex_utf8 (id);
+    lit_utf8_size_t magic_str_ex_sz = lit_get_magic_string_ex_size (id);
+
+    /*
+     * TODO:
+     *      Consider searching literal storage by magic string identifier instead of by its value
+     */
+    lit = lit_find_or_create_literal_from_utf8_string (magic_str_ex_p, magic_str_ex_sz);
+  }
+  else if (type == LIT_NUMBER_T)
+  {
+    double num;
+    if (!jrt_read_from_buffer_by_offset (lit_table_p,
+                                         lit_table_size,
+                                         in_out_lit_table_read_p,
+                                         &num))
+    {
+      return false;
+    }
+
+    lit = lit_find_or_create_literal_from_num ((ecma_number_t) num);
+  }
+  else
+  {
+    return false;
+  }
+
+  *out_lit_cp_p = lit_cpointer_t::compress (lit);
+
+  return true;
+} /* lit_load_literal_from_snapshot */
+
 /**
  * Load literals from snapshot
  *
@@ -742,98 +1500,16 @@ lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< buffer with li
     uint32_t offset = (uint32_t) lit_table_read;
     JERRY_ASSERT (offset == lit_table_read);
 
-    rcs_record_t::type_t type;
-    if (!jrt_read_from_buffer_by_offset (lit_table_p,
+    if (!lit_load_literal_from_snapshot (lit_table_p,
                                          lit_table_size,
                                          &lit_table_read,
-                                         &type))
-    {
-      is_ok = false;
-      break;
-    }
-
-    literal_t lit;
-
-    if (type == LIT_STR_T)
-    {
-      lit_utf8_size_t length;
-      if (!jrt_read_from_buffer_by_offset (lit_table_p,
-                                           lit_table_size,
-                                           &lit_table_read,
-                                           &length)
-          || (lit_table_read + length > lit_table_size))
-      {
-        is_ok = false;
-        break;
-      }
-
-      lit = lit_find_or_create_literal_from_utf8_string (lit_table_p + lit_table_read, length);
-      lit_table_read += length;
-    }
-    else if (type == LIT_MAGIC_STR_T)
-    {
-      lit_magic_string_id_t id;
-      if (!jrt_read_from_buffer_by_offset (lit_table_p,
-                                           lit_table_size,
-                                           &lit_table_read,
-                                           &id))
-      {
-        is_ok = false;
-        break;
-      }
-
-      const lit_utf8_byte_t *magic_str_p = lit_get_magic_string_utf8 (id);
-      lit_utf8_size_t magic_str_sz = lit_get_magic_string_size (id);
-
-      /*
-       * TODO:
-       *      Consider searching literal storage by magic string identifier instead of by its value
-       */
-      lit = lit_find_or_create_literal_from_utf8_string (magic_str_p, magic_str_sz);
-    }
-    else if (type == LIT_MAGIC_STR_EX_T)
-    {
-      lit_magic_string_ex_id_t id;
-      if (!jrt_read_from_buffer_by_offset (lit_table_p,
-                                           lit_table_size,
-                                           &lit_table_read,
-                                           &id))
-      {
-        is_ok = false;
-        break;
-      }
-
-      const lit_utf8_byte_t *magic_str_ex_p = lit_get_magic_string_ex_utf8 (id);
-      lit_utf8_size_t magic_str_ex_sz = lit_get_magic_string_ex_size (id);
-
-      /*
-       * TODO:
-       *      Consider searching literal storage by magic string identifier instead of by its value
-       */
-      lit = lit_find_or_create_literal_from_utf8_string (magic_str_ex_p, magic_str_ex_sz);
-    }
-    else if (type == LIT_NUMBER_T)
-    {
-      double num;
-      if (!jrt_read_from_buffer_by_offset (lit_table_p,
-                                           lit_table_size,
-                                           &lit_table_read,
-                                           &num))
-      {
-        is_ok = false;
-        break;
-      }
-
-      lit = lit_find_or_create_literal_from_num ((ecma_number_t) num);
-    }
-    else
+                                         &id_map_p[lit_index].literal_id))
     {
       is_ok = false;
       break;
     }
 
     id_map_p[lit_index].literal_offset = offset;
-    id_map_p[lit_index].literal_id = lit_cpointer_t::compress (lit);
   }
 
   if (is_ok)
@@ -29,10 +29,12 @@ extern lit_literal_storage_t lit_storage;
  * ------- header -----------------------
  * type (4 bits)
  * alignment (2 bits)
- * unused (2 bits)
  * hash (8 bits)
  * length (16 bits)
+ * gc mark (1 bit)
+ * unused (1 bit)
  * pointer to prev (16 bits)
+ * references count (16 bits)
  * ------- characters -------------------
  * ...
  * chars
@@ -125,8 +127,33 @@ public:
     return get_field (_length_field_pos, _length_field_width) * RCS_DYN_STORAGE_LENGTH_UNIT;
   } /* get_size */
 
+  /**
+   * Check whether the record was marked during literal storage garbage collection
+   *
+   * @return true - if marked,
+   *         false - otherwise
+   */
+  bool
+  is_marked () const
+  {
+    return get_field (_gc_mark_field_pos, _gc_mark_field_width) != 0;
+  } /* is_marked */
+
+  /**
+   * Set or clear garbage collection mark of the record
+   */
+  void
+  set_marked (bool is_marked) /**< new value of the mark */
+  {
+    set_field (_gc_mark_field_pos, _gc_mark_field_width, is_marked);
+  } /* set_marked */
+
   rcs_record_t *get_prev () const;
 
+  uint16_t get_refs () const;
+  void ref ();
+  void deref ();
+
   lit_utf8_size_t get_charset (lit_utf8_byte_t *, size_t);
 
   int compare_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
@@ -156,6 +183,7 @@ private:
   } /* set_hash */
 
   void set_prev (rcs_record_t *);
+  void set_refs (uint16_t);
 
   void set_charset (const lit_utf8_byte_t *, lit_utf8_size_t);
 
@@ -178,12 +206,17 @@ private:
   static const uint32_t _length_field_width = 16u;
 
   /**
-   * Offset and length of 'prev' field, in bits
+   * Offset and length of 'gc mark' field, in bits
+   */
+  static const uint32_t _gc_mark_field_pos = _length_field_pos + _length_field_width;
+  static const uint32_t _gc_mark_field_width = 1u;
+
+  /**
+   * Value of references counter, upon which the record becomes pinned (i.e. it is never freed)
    */
-  static const uint32_t _prev_field_pos = _length_field_pos + _length_field_width;
-  static const uint32_t _prev_field_width = rcs_cpointer_t::bit_field_width;
+  static const uint16_t _refs_pinned = UINT16_MAX;
 
-  static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT + RCS_DYN_STORAGE_LENGTH_UNIT / 2;
+  static const size_t _header_size = 2 * RCS_DYN_STORAGE_LENGTH_UNIT;
 }; /* lit_charset_record_t */
 
 /**
@@ -321,7 +354,8 @@ private:
  * Layout:
  * ------- header -----------------------
  * type (4 bits)
- * padding  (12 bits)
+ * gc mark (1 bit)
+ * padding  (11 bits)
  * pointer to prev (16 bits)
  * --------------------------------------
  * ecma_number_t
@@ -382,6 +416,27 @@ public:
     set_pointer (prev_field_pos, prev_field_width, prev_rec_p);
   } /* set_prev */
 
+  /**
+   * Check whether the record was marked during literal storage garbage collection
+   *
+   * @return true - if marked,
+   *         false - otherwise
+   */
+  bool
+  is_marked () const
+  {
+    return get_field (gc_mark_field_pos, gc_mark_field_width) != 0;
+  } /* is_marked */
+
+  /**
+   * Set or clear garbage collection mark of the record
+   */
+  void
+  set_marked (bool is_marked) /**< new value of the mark */
+  {
+    set_field (gc_mark_field_pos, gc_mark_field_width, is_marked);
+  } /* set_marked */
+
   /**
    * Get the number which is held by the record
    *
@@ -408,6 +463,12 @@ private:
     JERRY_ASSERT (size == get_size ());
   } /* set_size */
 
+  /**
+   * Offset and length of 'gc mark' field, in bits
+   */
+  static const uint32_t gc_mark_field_pos = _fields_offset_begin;
+  static const uint32_t gc_mark_field_width = 1u;
+
   /**
    * Offset and length of 'prev' field, in bits
    */
@@ -441,11 +502,22 @@ public:
     LIT_TYPE_LAST = LIT_NUMBER
   };
 
+  void init (void);
+  void cleanup (void);
+  void finalize (void);
+
   lit_charset_record_t *create_charset_record (const lit_utf8_byte_t *, lit_utf8_size_t);
   lit_magic_record_t *create_magic_record (lit_magic_string_id_t);
   lit_magic_record_t *create_magic_record_ex (lit_magic_string_ex_id_t);
   lit_number_record_t *create_number_record (ecma_number_t);
 
+  rcs_record_t *find_string_record (const lit_utf8_byte_t *, lit_utf8_size_t);
+  rcs_record_t *find_number_record (ecma_number_t);
+
+  void mark_record (rcs_record_t *);
+  uint32_t free_unmarked_records (void);
+  bool is_gc_recommended (void) const;
+
   uint32_t count_literals (void);
 
   void dump ();
@@ -454,6 +526,58 @@ private:
   virtual rcs_record_t *get_prev (rcs_record_t *);
   virtual void set_prev (rcs_record_t *, rcs_record_t *);
   virtual size_t get_record_size (rcs_record_t *);
+
+  /**
+   * Hash value, used for placement of a record in the index
+   *
+   * Note:
+   *      the hash is wider than compressed pointers, so it addresses every slot of the largest possible index
+   */
+  typedef uint32_t index_hash_t;
+
+  /**
+   * Entry of the literal storage's hash index
+   *
+   * Note:
+   *      an entry with null compressed pointer is an empty slot
+   */
+  typedef struct
+  {
+    index_hash_t hash; /**< hash of the literal's value */
+    uint16_t rec_cp; /**< packed compressed pointer to the literal's record */
+  } index_entry_t;
+
+  static index_hash_t index_hash_string (const lit_utf8_byte_t *, lit_utf8_size_t);
+  static index_hash_t index_hash_number (ecma_number_t);
+
+  index_hash_t index_hash_record (rcs_record_t *);
+
+  rcs_record_t *index_find_string (const lit_utf8_byte_t *, lit_utf8_size_t, index_hash_t);
+  rcs_record_t *index_find_number (ecma_number_t, index_hash_t);
+  void index_insert (rcs_record_t *, index_hash_t);
+  void index_remove (rcs_record_t *, index_hash_t);
+  void index_resize (uint32_t);
+  void index_free (void);
+
+  /**
+   * Initial number of slots in the index (should be a power of 2)
+   */
+  static const uint32_t _index_initial_size = 64u;
+
+  index_entry_t *_index_p; /**< open-addressing hash table of the storage's records,
+                            *   or NULL - if no record was indexed yet */
+  uint32_t _index_size; /**< number of slots in the index (power of 2, or 0) */
+  uint32_t _index_count; /**< number of used slots in the index */
+
+  /**
+   * Minimal number of collectable records that should be created since previous garbage collection
+   * for the next collection to be recommended
+   */
+  static const uint32_t _gc_min_new_records = 256u;
+
+  uint32_t _collectable_count; /**< number of charset and number records in the storage */
+  uint32_t _collectable_count_after_gc; /**< number of charset and number records that survived
+                                         *   previous garbage collection */
 }; /* lit_literal_storage_t */
 
 #define LIT_STR_T (lit_literal_storage_t::LIT_STR)
@@ -474,6 +598,7 @@ typedef struct
 extern bool
 lit_dump_literals_for_snapshot (uint8_t *, size_t, size_t *, lit_mem_to_snapshot_id_map_entry_t **,
                                 uint32_t *, uint32_t *);
+extern bool lit_load_literal_from_snapshot (const uint8_t *, uint32_t, size_t *, lit_cpointer_t *);
 extern bool lit_load_literals_from_snapshot (const uint8_t *, uint32_t, lit_mem_to_snapshot_id_map_entry_t **,
                                              uint32_t *, bool);
 #endif /* JERRY_ENABLE_SNAPSHOT */
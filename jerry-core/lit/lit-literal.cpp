@@ -40,6 +40,25 @@ lit_finalize ()
   lit_storage.finalize ();
 } /* lit_finalize */
 
+/**
+ * Add memory region, containing literal storage's state, to list of heap image's regions
+ */
+void
+lit_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_image_regions_add (regions_p, &lit_storage, sizeof (lit_storage));
+} /* lit_get_image_regions */
+
+/**
+ * Initialize literal component after the literal storage was restored from a heap image
+ */
+void
+lit_init_from_image ()
+{
+  lit_magic_strings_init ();
+  lit_magic_strings_ex_init ();
+} /* lit_init_from_image */
+
 /**
  * Dump records from the literal storage
  */
@@ -49,6 +68,48 @@ lit_dump_literals ()
   lit_storage.dump ();
 } /* lit_dump_literals */
 
+/**
+ * Mark literal as used by a byte-code
+ *
+ * See also:
+ *          lit_free_unmarked_literals
+ */
+void
+lit_mark_literal (lit_cpointer_t lit_cp) /**< compressed pointer to literal */
+{
+  JERRY_ASSERT (lit_cp.packed_value != MEM_CP_NULL);
+
+  lit_storage.mark_record (lit_get_literal_by_cp (lit_cp));
+} /* lit_mark_literal */
+
+/**
+ * Free literals that were not marked since previous call of the routine,
+ * and are not referenced from ecma-strings.
+ *
+ * Note:
+ *      before the call, every literal used by a live byte-code should be marked with lit_mark_literal
+ *
+ * @return number of freed literals
+ */
+uint32_t
+lit_free_unmarked_literals (void)
+{
+  return lit_storage.free_unmarked_records ();
+} /* lit_free_unmarked_literals */
+
+/**
+ * Check whether there are enough literals, created since previous literal storage garbage collection,
+ * for the next collection to be worth running
+ *
+ * @return true - if garbage collection is recommended,
+ *         false - otherwise
+ */
+bool
+lit_is_gc_recommended (void)
+{
+  return lit_storage.is_gc_recommended ();
+} /* lit_is_gc_recommended */
+
 /**
  * Create new literal in literal storage from characters buffer.
  * Don't check if the same literal already exists.
@@ -62,19 +123,11 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
 {
   JERRY_ASSERT (str_p || !str_size);
 
-  for (lit_magic_string_id_t msi = (lit_magic_string_id_t) 0;
-       msi < LIT_MAGIC_STRING__COUNT;
-       msi = (lit_magic_string_id_t) (msi + 1))
-  {
-    if (lit_get_magic_string_size (msi) != str_size)
-    {
-      continue;
-    }
+  lit_magic_string_id_t magic_id;
 
-    if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_utf8 (msi), str_size))
-    {
-      return lit_storage.create_magic_record (msi);
-    }
+  if (lit_is_utf8_string_magic (str_p, str_size, &magic_id))
+  {
+    return lit_storage.create_magic_record (magic_id);
   }
 
   for (lit_magic_string_ex_id_t msi = (lit_magic_string_ex_id_t) 0;
@@ -99,6 +152,9 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
  * Find a literal in literal storage.
  * Only charset and magic string records are checked during search.
  *
+ * Note:
+ *      the lookup is performed through hash index of the literal storage
+ *
  * @return pointer to a literal or NULL if no corresponding literal exists
  */
 literal_t
@@ -107,62 +163,7 @@ lit_find_literal_by_utf8_string (const lit_utf8_byte_t *str_p, /**< a string to
 {
   JERRY_ASSERT (str_p || !str_size);
 
-  lit_string_hash_t str_hash = lit_utf8_string_calc_hash (str_p, str_size);
-
-  for (literal_t lit = lit_storage.get_first (); lit != NULL; lit = lit_storage.get_next (lit))
-  {
-    rcs_record_t::type_t type = lit->get_type ();
-
-    if (type == LIT_STR_T)
-    {
-      if (static_cast<lit_charset_record_t *>(lit)->get_hash () != str_hash)
-      {
-        continue;
-      }
-
-      if (static_cast<lit_charset_record_t *>(lit)->get_length () != str_size)
-      {
-        continue;
-      }
-
-      if (!static_cast<lit_charset_record_t *>(lit)->compare_utf8 (str_p, str_size))
-      {
-        return lit;
-      }
-    }
-    else if (type == LIT_MAGIC_STR_T)
-    {
-      lit_magic_string_id_t magic_id = lit_magic_record_get_magic_str_id (lit);
-      const lit_utf8_byte_t *magic_str_p = lit_get_magic_string_utf8 (magic_id);
-
-      if (lit_get_magic_string_size (magic_id) != str_size)
-      {
-        continue;
-      }
-
-      if (!strncmp ((const char *) magic_str_p, (const char *) str_p, str_size))
-      {
-        return lit;
-      }
-    }
-    else if (type == LIT_MAGIC_STR_EX_T)
-    {
-      lit_magic_string_ex_id_t magic_id = lit_magic_record_ex_get_magic_str_id (lit);
-      const lit_utf8_byte_t *magic_str_p = lit_get_magic_string_ex_utf8 (magic_id);
-
-      if (lit_get_magic_string_ex_size (magic_id) != str_size)
-      {
-        continue;
-      }
-
-      if (!strncmp ((const char *) magic_str_p, (const char *) str_p, str_size))
-      {
-        return lit;
-      }
-    }
-  }
-
-  return NULL;
+  return lit_storage.find_string_record (str_p, str_size);
 } /* lit_find_literal_by_utf8_string */
 
 /**
@@ -223,24 +224,7 @@ lit_find_or_create_literal_from_num (ecma_number_t num) /**< number which a lite
 literal_t
 lit_find_literal_by_num (ecma_number_t num) /**< a number to search for */
 {
-  for (literal_t lit = lit_storage.get_first (); lit != NULL; lit = lit_storage.get_next (lit))
-  {
-    rcs_record_t::type_t type = lit->get_type ();
-
-    if (type != LIT_NUMBER_T)
-    {
-      continue;
-    }
-
-    ecma_number_t lit_num = static_cast<lit_number_record_t *>(lit)->get_number ();
-
-    if (lit_num == num)
-    {
-      return lit;
-    }
-  }
-
-  return NULL;
+  return lit_storage.find_number_record (num);
 } /* lit_find_literal_by_num */
 
 /**
@@ -556,6 +540,28 @@ lit_get_literal_by_cp (lit_cpointer_t lit_cp) /**< compressed pointer to literal
   return lit;
 } /* lit_get_literal_by_cp */
 
+/**
+ * Register reference to charset literal from an ecma-string
+ */
+void
+lit_charset_literal_ref (literal_t lit) /**< charset literal */
+{
+  JERRY_ASSERT (lit->get_type () == LIT_STR_T);
+
+  static_cast<lit_charset_record_t *> (lit)->ref ();
+} /* lit_charset_literal_ref */
+
+/**
+ * Unregister reference to charset literal from an ecma-string
+ */
+void
+lit_charset_literal_deref (literal_t lit) /**< charset literal */
+{
+  JERRY_ASSERT (lit->get_type () == LIT_STR_T);
+
+  static_cast<lit_charset_record_t *> (lit)->deref ();
+} /* lit_charset_literal_deref */
+
 lit_string_hash_t
 lit_charset_literal_get_hash (literal_t lit) /**< literal */
 {
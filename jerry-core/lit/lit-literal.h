@@ -23,6 +23,8 @@
 void lit_init ();
 void lit_finalize ();
 void lit_dump_literals ();
+void lit_get_image_regions (mem_image_regions_t *);
+void lit_init_from_image ();
 
 literal_t lit_create_literal_from_utf8_string (const lit_utf8_byte_t *, lit_utf8_size_t);
 literal_t lit_find_literal_by_utf8_string (const lit_utf8_byte_t *, lit_utf8_size_t);
@@ -46,6 +48,12 @@ const char *lit_literal_to_str_internal_buf (literal_t);
 
 literal_t lit_get_literal_by_cp (lit_cpointer_t);
 
+void lit_mark_literal (lit_cpointer_t);
+uint32_t lit_free_unmarked_literals (void);
+bool lit_is_gc_recommended (void);
+
+void lit_charset_literal_ref (literal_t);
+void lit_charset_literal_deref (literal_t);
 lit_string_hash_t lit_charset_literal_get_hash (literal_t);
 ecma_number_t lit_charset_literal_get_number (literal_t);
 lit_utf8_size_t lit_charset_record_get_size (literal_t);
@@ -193,20 +193,35 @@ lit_is_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 string */
                           lit_utf8_size_t string_size, /**< string size in bytes */
                           lit_magic_string_id_t *out_id_p) /**< out: magic string's id */
 {
-  TODO (Improve performance of search);
+  lit_magic_string_id_t id;
 
-  for (lit_magic_string_id_t id = (lit_magic_string_id_t) 0;
-       id < LIT_MAGIC_STRING__COUNT;
-       id = (lit_magic_string_id_t) (id + 1))
+  /* the only magic string that can be equal to the passed string is selected by classification hash */
+  switch (lit_utf8_string_classify_hash (string_p, string_size))
   {
-    if (lit_compare_utf8_string_and_magic_string (string_p, string_size, id))
-    {
-      *out_id_p = id;
+#define LIT_MAGIC_STRING_DEF(magic_string_id, utf8_string) \
+    case LIT_CLASSIFY_HASH_CONST (utf8_string): \
+    { \
+      id = magic_string_id; \
+      break; \
+    }
+#include "lit-magic-strings.inc.h"
+#undef LIT_MAGIC_STRING_DEF
 
-      return true;
+    default:
+    {
+      id = LIT_MAGIC_STRING__COUNT;
+      break;
     }
   }
 
+  if (id != LIT_MAGIC_STRING__COUNT
+      && lit_compare_utf8_string_and_magic_string (string_p, string_size, id))
+  {
+    *out_id_p = id;
+
+    return true;
+  }
+
   *out_id_p = LIT_MAGIC_STRING__COUNT;
 
   return false;
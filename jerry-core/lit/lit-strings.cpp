@@ -19,6 +19,52 @@
 
 JERRY_STATIC_ASSERT (sizeof (lit_utf8_iterator_pos_t) == sizeof (lit_utf8_size_t));
 
+/*
+ * Substring search kernels (see also: lit_utf8_string_find, lit_utf8_string_find_last) compare
+ * a block of candidate positions at once, if the target supports vector instructions.
+ *
+ * The vectors are declared through the compiler's vector extensions, and not through <*mmintrin.h>,
+ * as the latter headers depend on the compiler's default libc.
+ */
+#if defined (__GNUC__) && defined (__AVX2__)
+# define LIT_UTF8_FIND_VECTOR_SIZE 32
+# define LIT_UTF8_FIND_VECTOR_MOVEMASK(v) ((uint32_t) __builtin_ia32_pmovmskb256 (v))
+#elif defined (__GNUC__) && defined (__SSE2__)
+# define LIT_UTF8_FIND_VECTOR_SIZE 16
+# define LIT_UTF8_FIND_VECTOR_MOVEMASK(v) ((uint32_t) __builtin_ia32_pmovmskb128 (v))
+#endif /* __GNUC__ && __SSE2__ */
+
+#ifdef LIT_UTF8_FIND_VECTOR_SIZE
+/**
+ * Vector of bytes, that can be loaded from an unaligned address
+ */
+typedef char lit_utf8_find_vector_t __attribute__ ((vector_size (LIT_UTF8_FIND_VECTOR_SIZE),
+                                                    aligned (1),
+                                                    may_alias));
+
+/**
+ * Get bit mask of the positions in the block, starting at the specified offset,
+ * where the first and the last bytes of a needle occur in the haystack
+ *
+ * @return bit mask, with i-th bit set if both the bytes match for the candidate position offset + i
+ */
+static uint32_t
+lit_utf8_find_candidates_mask (const lit_utf8_byte_t *haystack_p, /**< haystack */
+                               lit_utf8_size_t offset, /**< offset of the block's first candidate position */
+                               lit_utf8_size_t needle_size, /**< size of the needle */
+                               lit_utf8_find_vector_t first_byte_v, /**< needle's first byte, broadcasted */
+                               lit_utf8_find_vector_t last_byte_v) /**< needle's last byte, broadcasted */
+{
+  lit_utf8_find_vector_t block_first_v = *(const lit_utf8_find_vector_t *) (haystack_p + offset);
+  lit_utf8_find_vector_t block_last_v = *(const lit_utf8_find_vector_t *) (haystack_p + offset + needle_size - 1);
+
+  lit_utf8_find_vector_t eq_v = (lit_utf8_find_vector_t) ((block_first_v == first_byte_v)
+                                                          & (block_last_v == last_byte_v));
+
+  return LIT_UTF8_FIND_VECTOR_MOVEMASK (eq_v);
+} /* lit_utf8_find_candidates_mask */
+#endif /* LIT_UTF8_FIND_VECTOR_SIZE */
+
 /**
  * Compare two iterator positions
  *
@@ -997,6 +1043,183 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, /**<
   return (string1_pos >= string1_end_p && string2_pos < string2_end_p);
 } /* lit_compare_utf8_strings_relational */
 
+/**
+ * Check whether the needle occurs in the haystack at the specified offset
+ *
+ * @return true / false
+ */
+static bool
+lit_utf8_string_match_at (const lit_utf8_byte_t *haystack_p, /**< haystack */
+                          lit_utf8_size_t offset, /**< offset in the haystack */
+                          const lit_utf8_byte_t *needle_p, /**< needle */
+                          lit_utf8_size_t needle_size) /**< size of the needle */
+{
+  return (haystack_p[offset] == needle_p[0]
+          && haystack_p[offset + needle_size - 1] == needle_p[needle_size - 1]
+          && memcmp (haystack_p + offset, needle_p, needle_size) == 0);
+} /* lit_utf8_string_match_at */
+
+/**
+ * Find first occurrence of a cesu-8 string in another cesu-8 string, starting from the specified offset
+ *
+ * Candidate positions are filtered by the needle's first and last bytes (a block of positions at once,
+ * if vector instructions are available), and only the remaining ones are compared completely.
+ *
+ * Note:
+ *      as cesu-8 is self-synchronizing, the found offset is always a code unit boundary
+ *
+ * @return true - if occurrence was found (the offset is returned through ret_offset_p),
+ *         false - otherwise
+ */
+bool
+lit_utf8_string_find (const lit_utf8_byte_t *haystack_p, /**< string to search in */
+                      lit_utf8_size_t haystack_size, /**< size of the string to search in */
+                      const lit_utf8_byte_t *needle_p, /**< string to search for */
+                      lit_utf8_size_t needle_size, /**< size of the string to search for */
+                      lit_utf8_size_t start_offset, /**< first offset to check */
+                      lit_utf8_size_t *ret_offset_p) /**< out: offset of the occurrence */
+{
+  if (needle_size > haystack_size
+      || start_offset > haystack_size - needle_size)
+  {
+    return false;
+  }
+
+  if (needle_size == 0)
+  {
+    *ret_offset_p = start_offset;
+    return true;
+  }
+
+  /* candidate positions are [offset, end_offset) */
+  const lit_utf8_size_t end_offset = haystack_size - needle_size + 1;
+  lit_utf8_size_t offset = start_offset;
+
+#ifdef LIT_UTF8_FIND_VECTOR_SIZE
+  lit_utf8_find_vector_t first_byte_v, last_byte_v;
+
+  for (uint32_t i = 0; i < LIT_UTF8_FIND_VECTOR_SIZE; i++)
+  {
+    first_byte_v[i] = (char) needle_p[0];
+    last_byte_v[i] = (char) needle_p[needle_size - 1];
+  }
+
+  while (end_offset - offset >= LIT_UTF8_FIND_VECTOR_SIZE)
+  {
+    uint32_t mask = lit_utf8_find_candidates_mask (haystack_p, offset, needle_size, first_byte_v, last_byte_v);
+
+    while (mask != 0)
+    {
+      lit_utf8_size_t candidate_offset = offset + (lit_utf8_size_t) __builtin_ctz (mask);
+
+      if (memcmp (haystack_p + candidate_offset, needle_p, needle_size) == 0)
+      {
+        *ret_offset_p = candidate_offset;
+        return true;
+      }
+
+      mask &= mask - 1;
+    }
+
+    offset += LIT_UTF8_FIND_VECTOR_SIZE;
+  }
+#endif /* LIT_UTF8_FIND_VECTOR_SIZE */
+
+  for (; offset < end_offset; offset++)
+  {
+    if (lit_utf8_string_match_at (haystack_p, offset, needle_p, needle_size))
+    {
+      *ret_offset_p = offset;
+      return true;
+    }
+  }
+
+  return false;
+} /* lit_utf8_string_find */
+
+/**
+ * Find last occurrence of a cesu-8 string in another cesu-8 string, that starts at or before the specified offset
+ *
+ * See also:
+ *          lit_utf8_string_find
+ *
+ * @return true - if occurrence was found (the offset is returned through ret_offset_p),
+ *         false - otherwise
+ */
+bool
+lit_utf8_string_find_last (const lit_utf8_byte_t *haystack_p, /**< string to search in */
+                           lit_utf8_size_t haystack_size, /**< size of the string to search in */
+                           const lit_utf8_byte_t *needle_p, /**< string to search for */
+                           lit_utf8_size_t needle_size, /**< size of the string to search for */
+                           lit_utf8_size_t start_offset, /**< last offset to check */
+                           lit_utf8_size_t *ret_offset_p) /**< out: offset of the occurrence */
+{
+  if (needle_size > haystack_size)
+  {
+    return false;
+  }
+
+  if (start_offset > haystack_size - needle_size)
+  {
+    start_offset = haystack_size - needle_size;
+  }
+
+  if (needle_size == 0)
+  {
+    *ret_offset_p = start_offset;
+    return true;
+  }
+
+  /* candidate positions are [0, end_offset) */
+  lit_utf8_size_t end_offset = start_offset + 1;
+
+#ifdef LIT_UTF8_FIND_VECTOR_SIZE
+  lit_utf8_find_vector_t first_byte_v, last_byte_v;
+
+  for (uint32_t i = 0; i < LIT_UTF8_FIND_VECTOR_SIZE; i++)
+  {
+    first_byte_v[i] = (char) needle_p[0];
+    last_byte_v[i] = (char) needle_p[needle_size - 1];
+  }
+
+  while (end_offset >= LIT_UTF8_FIND_VECTOR_SIZE)
+  {
+    const lit_utf8_size_t offset = end_offset - LIT_UTF8_FIND_VECTOR_SIZE;
+
+    uint32_t mask = lit_utf8_find_candidates_mask (haystack_p, offset, needle_size, first_byte_v, last_byte_v);
+
+    while (mask != 0)
+    {
+      uint32_t bit = (uint32_t) (31 - __builtin_clz (mask));
+      lit_utf8_size_t candidate_offset = offset + bit;
+
+      if (memcmp (haystack_p + candidate_offset, needle_p, needle_size) == 0)
+      {
+        *ret_offset_p = candidate_offset;
+        return true;
+      }
+
+      mask &= ~(1u << bit);
+    }
+
+    end_offset = offset;
+  }
+#endif /* LIT_UTF8_FIND_VECTOR_SIZE */
+
+  while (end_offset != 0)
+  {
+    end_offset--;
+
+    if (lit_utf8_string_match_at (haystack_p, end_offset, needle_p, needle_size))
+    {
+      *ret_offset_p = end_offset;
+      return true;
+    }
+  }
+
+  return false;
+} /* lit_utf8_string_find_last */
+
 /**
  * Print code unit to standard output
  */
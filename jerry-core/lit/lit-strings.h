@@ -156,6 +156,64 @@ ecma_length_t lit_utf8_string_length (const lit_utf8_byte_t *, lit_utf8_size_t);
 lit_string_hash_t lit_utf8_string_calc_hash (const lit_utf8_byte_t *, lit_utf8_size_t);
 lit_string_hash_t lit_utf8_string_hash_combine (lit_string_hash_t, const lit_utf8_byte_t *, lit_utf8_size_t);
 
+/**
+ * Initial value of classification hash (FNV-1a offset basis)
+ */
+#define LIT_CLASSIFY_HASH_INIT (2166136261u)
+
+/**
+ * Multiplier of classification hash (FNV-1a prime)
+ */
+#define LIT_CLASSIFY_HASH_PRIME (16777619u)
+
+/**
+ * Calculate classification hash of a string at build time
+ *
+ * Classification hash is used for recognition of fixed string sets (keywords, magic strings)
+ * with switch statements, the case labels of which are hashes of the set's strings.
+ * So, the set's strings are guaranteed to have unique hashes, as the compiler rejects
+ * duplicate case values, and recognition of a string requires only one string comparison.
+ *
+ * Note:
+ *      the value is equal to the one calculated at run time by lit_utf8_string_classify_hash
+ *
+ * @return 32-bit hash value
+ */
+constexpr uint32_t
+lit_classify_hash_const (const char *str_p, /**< characters of the string */
+                         size_t size, /**< number of remaining characters */
+                         uint32_t hash) /**< hash of the preceding characters */
+{
+  return ((size == 0) ? hash
+                      : lit_classify_hash_const (str_p + 1,
+                                                 size - 1,
+                                                 (hash ^ (uint8_t) *str_p) * LIT_CLASSIFY_HASH_PRIME));
+} /* lit_classify_hash_const */
+
+/**
+ * Classification hash of a string literal, calculated at build time
+ */
+#define LIT_CLASSIFY_HASH_CONST(str) (lit_classify_hash_const (str, sizeof (str) - 1, LIT_CLASSIFY_HASH_INIT))
+
+/**
+ * Calculate classification hash of a string at run time (see also: lit_classify_hash_const)
+ *
+ * @return 32-bit hash value
+ */
+inline uint32_t __attr_always_inline___
+lit_utf8_string_classify_hash (const lit_utf8_byte_t *utf8_buf_p, /**< characters buffer */
+                               lit_utf8_size_t utf8_buf_size) /**< buffer size */
+{
+  uint32_t hash = LIT_CLASSIFY_HASH_INIT;
+
+  for (lit_utf8_size_t i = 0; i < utf8_buf_size; i++)
+  {
+    hash = (hash ^ utf8_buf_p[i]) * LIT_CLASSIFY_HASH_PRIME;
+  }
+
+  return hash;
+} /* lit_utf8_string_classify_hash */
+
 /* code unit access */
 ecma_char_t lit_utf8_string_code_unit_at (const lit_utf8_byte_t *, lit_utf8_size_t, ecma_length_t);
 lit_utf8_size_t lit_get_unicode_char_size_by_utf8_first_byte (lit_utf8_byte_t);
@@ -172,6 +230,14 @@ bool lit_compare_utf8_strings (const lit_utf8_byte_t *, lit_utf8_size_t,
 bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, lit_utf8_size_t,
                                           const lit_utf8_byte_t *string2_p, lit_utf8_size_t);
 
+/* substring search */
+bool lit_utf8_string_find (const lit_utf8_byte_t *, lit_utf8_size_t,
+                           const lit_utf8_byte_t *, lit_utf8_size_t,
+                           lit_utf8_size_t, lit_utf8_size_t *);
+bool lit_utf8_string_find_last (const lit_utf8_byte_t *, lit_utf8_size_t,
+                                const lit_utf8_byte_t *, lit_utf8_size_t,
+                                lit_utf8_size_t, lit_utf8_size_t *);
+
 /* read code point from buffer */
 lit_utf8_size_t lit_read_code_point_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t, lit_code_point_t *);
 
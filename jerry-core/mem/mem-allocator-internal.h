@@ -26,6 +26,9 @@
 
 extern void mem_run_try_to_give_memory_back_callbacks (mem_try_give_memory_back_severity_t);
 
+extern void mem_heap_get_image_regions (mem_image_regions_t *);
+extern void mem_pools_get_image_regions (mem_image_regions_t *);
+
 /**
  * @}
  */
@@ -102,6 +102,44 @@ mem_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decompress
   return mem_heap_decompress_pointer (compressed_pointer);
 } /* mem_decompress_pointer */
 
+/**
+ * Initialize list of heap image's memory regions
+ */
+void
+mem_image_regions_init (mem_image_regions_t *regions_p) /**< out: list of regions */
+{
+  regions_p->regions_num = 0;
+} /* mem_image_regions_init */
+
+/**
+ * Add memory region to list of heap image's memory regions
+ */
+void
+mem_image_regions_add (mem_image_regions_t *regions_p, /**< list of regions */
+                       void *region_p, /**< start of the region */
+                       size_t size) /**< size of the region */
+{
+  JERRY_ASSERT (regions_p->regions_num < MEM_IMAGE_REGIONS_MAX);
+
+  regions_p->regions[regions_p->regions_num].region_p = region_p;
+  regions_p->regions[regions_p->regions_num].size = size;
+  regions_p->regions_num++;
+} /* mem_image_regions_add */
+
+/**
+ * Get memory regions, containing state of memory allocators, that should be saved to a heap image
+ *
+ * Note:
+ *      the heap image is restored to the same addresses, so raw pointers to the heap,
+ *      stored in the regions, remain valid after restoration
+ */
+void
+mem_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_heap_get_image_regions (regions_p);
+  mem_pools_get_image_regions (regions_p);
+} /* mem_get_image_regions */
+
 /**
  * Register specified 'try to give memory back' callback routine
  */
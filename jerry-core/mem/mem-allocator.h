@@ -73,6 +73,29 @@ typedef enum
  */
 typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_severity_t);
 
+/**
+ * Maximum number of memory regions in a heap image
+ */
+#define MEM_IMAGE_REGIONS_MAX (32u)
+
+/**
+ * Memory region, that is part of engine's state saved to a heap image
+ */
+typedef struct
+{
+  void *region_p; /**< start of the region */
+  size_t size; /**< size of the region */
+} mem_image_region_t;
+
+/**
+ * List of memory regions, that make up engine's state saved to a heap image
+ */
+typedef struct
+{
+  mem_image_region_t regions[MEM_IMAGE_REGIONS_MAX]; /**< regions */
+  uint32_t regions_num; /**< number of regions in the list */
+} mem_image_regions_t;
+
 /**
  * Get value of pointer from specified non-null compressed pointer value
  */
@@ -118,6 +141,10 @@ extern void mem_finalize (bool);
 extern uintptr_t mem_compress_pointer (const void *);
 extern void *mem_decompress_pointer (uintptr_t);
 
+extern void mem_image_regions_init (mem_image_regions_t *);
+extern void mem_image_regions_add (mem_image_regions_t *, void *, size_t);
+extern void mem_get_image_regions (mem_image_regions_t *);
+
 extern void mem_register_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t);
 extern void mem_unregister_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t);
 
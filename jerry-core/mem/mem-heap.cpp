@@ -368,6 +368,29 @@ mem_heap_finalize (void)
   VALGRIND_NOACCESS_SPACE (&mem_heap, sizeof (mem_heap));
 } /* mem_heap_finalize */
 
+/**
+ * Add memory regions, containing heap's state, to list of heap image's regions
+ */
+void
+mem_heap_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_image_regions_add (regions_p, &mem_heap, sizeof (mem_heap));
+  mem_image_regions_add (regions_p, &mem_heap_allocated_chunks, sizeof (mem_heap_allocated_chunks));
+  mem_image_regions_add (regions_p, &mem_heap_limit, sizeof (mem_heap_limit));
+
+#ifdef MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY
+  mem_image_regions_add (regions_p, mem_heap_allocated_bytes, sizeof (mem_heap_allocated_bytes));
+#endif /* MEM_HEAP_ENABLE_ALLOCATED_BYTES_ARRAY */
+
+#ifndef JERRY_NDEBUG
+  mem_image_regions_add (regions_p, mem_heap_length_types, sizeof (mem_heap_length_types));
+#endif /* !JERRY_NDEBUG */
+
+#ifdef MEM_STATS
+  mem_image_regions_add (regions_p, &mem_heap_stats, sizeof (mem_heap_stats));
+#endif /* MEM_STATS */
+} /* mem_heap_get_image_regions */
+
 /**
  * Allocation of memory region.
  *
@@ -835,12 +858,12 @@ mem_heap_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decom
   return (void*) int_ptr;
 } /* mem_heap_decompress_pointer */
 
-#ifndef JERRY_NDEBUG
 /**
  * Check whether the pointer points to the heap
  *
  * Note:
- *      the routine should be used only for assertion checks
+ *      besides assertion checks, the routine is used to check that engine's state
+ *      doesn't reference external buffers before saving it to a heap image
  *
  * @return true - if pointer points to the heap,
  *         false - otherwise
@@ -852,7 +875,6 @@ mem_is_heap_pointer (const void *pointer) /**< pointer */
 
   return (uint8_pointer >= mem_heap.area && uint8_pointer <= ((uint8_t *) mem_heap.area + MEM_HEAP_AREA_SIZE));
 } /* mem_is_heap_pointer */
-#endif /* !JERRY_NDEBUG */
 
 /**
  * Print heap block
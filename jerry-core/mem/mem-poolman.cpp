@@ -180,6 +180,23 @@ mem_pools_init (void)
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
 
+/**
+ * Add memory regions, containing pool manager's state, to list of heap image's regions
+ */
+void
+mem_pools_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+#ifndef JERRY_NDEBUG
+  mem_image_regions_add (regions_p, &mem_free_chunks_number, sizeof (mem_free_chunks_number));
+#endif /* !JERRY_NDEBUG */
+
+  mem_image_regions_add (regions_p, &mem_free_chunk_p, sizeof (mem_free_chunk_p));
+
+#ifdef MEM_STATS
+  mem_image_regions_add (regions_p, &mem_pools_stats, sizeof (mem_pools_stats));
+#endif /* MEM_STATS */
+} /* mem_pools_get_image_regions */
+
 /**
  * Finalize pool manager
  */
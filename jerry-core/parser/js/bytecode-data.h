@@ -34,6 +34,16 @@
  */
 #define BLOCK_SIZE 64u
 
+/**
+ * Range of source text of a lazy function, or of a function's body, nested into a lazy function
+ * (see also: parser_parse_lazy_function)
+ */
+typedef struct
+{
+  uint32_t start_offset; /**< offset of the range's first character in the source buffer */
+  uint32_t end_offset; /**< offset of the character, following the range, in the source buffer */
+} bytecode_source_range_t;
+
 /**
  * Header of byte-code memory region, containing byte-code array and literal identifiers hash table
  */
@@ -44,6 +54,12 @@ typedef struct __attribute__ ((aligned (MEM_ALIGNMENT))) bytecode_data_header_t
   mem_cpointer_t lit_id_hash_cp; /**< pointer to literal identifiers hash table
                                   *   See also: lit_id_hash_table_init */
   mem_cpointer_t next_header_cp; /**< pointer to next instructions data header */
+  const lit_utf8_byte_t *source_p; /**< source buffer, to which ranges of lazy functions' source text
+                                    *   in the byte-code are relative (NULL - if there can be no lazy
+                                    *   functions in the byte-code, see also: parser_parse_lazy_function) */
+  const bytecode_source_range_t *source_ranges_p; /**< ranges of source text, referenced by lazy functions'
+                                                   *   'meta' instructions of the byte-code (NULL - if there
+                                                   *   are no such instructions in the byte-code) */
 } bytecode_data_header_t;
 
 #endif /* BYTECODE_DATA_H */
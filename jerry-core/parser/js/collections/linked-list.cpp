@@ -40,6 +40,11 @@ do { \
   JERRY_ASSERT (header); \
 } while (0);
 
+/**
+ * Minimum size of data space of a linked list's chunk
+ */
+#define LINKED_LIST_CHUNK_MIN_DATA_SIZE (32u)
+
 /**
  * Calculate size of a linked list's chunk
  *
@@ -50,12 +55,15 @@ linked_list_block_size (bool is_first_chunk) /**< is it first chunk (chunk, cont
 {
   if (is_first_chunk)
   {
-    return (jsp_mm_recommend_size (sizeof (linked_list_header) + sizeof (linked_list_chunk_header) + 1u)
+    return (jsp_mm_recommend_size (sizeof (linked_list_header)
+                                   + sizeof (linked_list_chunk_header)
+                                   + LINKED_LIST_CHUNK_MIN_DATA_SIZE)
             - sizeof (linked_list_header) - sizeof (linked_list_chunk_header));
   }
   else
   {
-    return (jsp_mm_recommend_size (sizeof (linked_list_chunk_header) + 1u) - sizeof (linked_list_chunk_header));
+    return (jsp_mm_recommend_size (sizeof (linked_list_chunk_header) + LINKED_LIST_CHUNK_MIN_DATA_SIZE)
+            - sizeof (linked_list_chunk_header));
   }
 } /* linked_list_block_size */
 
@@ -282,6 +290,14 @@ linked_list_remove_element (linked_list list, /**< linked list's identifier */
 
   JERRY_ASSERT (element_num < list_length);
 
+  if (element_num + 1 == list_length)
+  {
+    /* last element, that could be the last one in a full chunk, has no next element to shift */
+    header_p->list_length--;
+
+    return;
+  }
+
   uint8_t *element_iter_p = (uint8_t *) (list_chunk_iter_p + 1u);
 
   for (size_t i = 0; i < element_num; i++)
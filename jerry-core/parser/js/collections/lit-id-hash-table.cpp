@@ -50,6 +50,8 @@ lit_id_hash_table_init (uint8_t *table_buffer_p, /**< buffer to initialize hash
   table_p->current_bucket_pos = 0;
   table_p->raw_buckets = (lit_cpointer_t*) (table_buffer_p + header_size);
   table_p->buckets = (lit_cpointer_t **) (table_buffer_p + header_size + raw_buckets_size);
+  table_p->snapshot_blocks_p = NULL;
+  table_p->snapshot_lit_indexes_p = NULL;
 
   memset (table_p->buckets, 0, buckets_size);
 
@@ -118,14 +120,112 @@ lit_id_hash_table_lookup (lit_id_hash_table *table_p, /**< table's header */
   JERRY_ASSERT (table_p != NULL);
 
   size_t block_id = oc / BLOCK_SIZE;
+
+  if (table_p->snapshot_blocks_p != NULL)
+  {
+    uint32_t block_begin = table_p->snapshot_blocks_p[block_id];
+    JERRY_ASSERT (block_begin + uid < table_p->snapshot_blocks_p[block_id + 1u]);
+
+    return table_p->raw_buckets[table_p->snapshot_lit_indexes_p[block_begin + uid]];
+  }
+
   JERRY_ASSERT (table_p->buckets[block_id] != NULL);
 
   return table_p->buckets[block_id][uid];
 } /* lit_id_hash_table_lookup */
 
+/**
+ * Check whether the table's data is placed in the heap
+ *
+ * Note:
+ *      tables, loaded from snapshots without copying, reference the snapshot buffer
+ *
+ * @return true - if the table doesn't reference memory outside of the heap,
+ *         false - otherwise
+ */
+bool
+lit_id_hash_table_is_in_heap (lit_id_hash_table *table_p) /**< table's header */
+{
+  return (table_p->snapshot_blocks_p == NULL
+          || (mem_is_heap_pointer (table_p->snapshot_blocks_p)
+              && mem_is_heap_pointer (table_p->snapshot_lit_indexes_p)));
+} /* lit_id_hash_table_is_in_heap */
+
+/**
+ * Mark all literals, registered in the hash table, as used
+ *
+ * See also:
+ *          lit_mark_literal
+ */
+void
+lit_id_hash_table_mark_literals (lit_id_hash_table *table_p) /**< table's header */
+{
+  JERRY_ASSERT (table_p != NULL);
+
+  for (size_t i = 0; i < table_p->current_bucket_pos; i++)
+  {
+    lit_cpointer_t lit_cp = table_p->raw_buckets[i];
+
+    if (lit_cp.packed_value != MEM_CP_NULL)
+    {
+      lit_mark_literal (lit_cp);
+    }
+  }
+} /* lit_id_hash_table_mark_literals */
+
+/**
+ * Get distinct literals, registered in the hash table
+ *
+ * @return number of the literals
+ */
+uint32_t
+lit_id_hash_table_get_literals (lit_id_hash_table *table_p, /**< table's header */
+                                lit_cpointer_t *out_lit_cps_p, /**< out: buffer for identifiers of the literals */
+                                uint32_t buffer_size) /**< number of identifiers the buffer can hold */
+{
+  JERRY_ASSERT (table_p != NULL);
+
+  uint32_t literals_num = 0;
+
+  for (size_t i = 0; i < table_p->current_bucket_pos; i++)
+  {
+    lit_cpointer_t lit_cp = table_p->raw_buckets[i];
+
+    if (lit_cp.packed_value == MEM_CP_NULL)
+    {
+      continue;
+    }
+
+    uint32_t j;
+    for (j = 0; j < literals_num; j++)
+    {
+      if (out_lit_cps_p[j].packed_value == lit_cp.packed_value)
+      {
+        break;
+      }
+    }
+
+    if (j == literals_num)
+    {
+      JERRY_ASSERT (literals_num < buffer_size);
+
+      out_lit_cps_p[literals_num++] = lit_cp;
+    }
+  }
+
+  return literals_num;
+} /* lit_id_hash_table_get_literals */
+
 /**
  * Dump literal identifiers hash table to snapshot buffer
  *
+ * The dumped idx-to-literal map has the following layout, which allows using it in place
+ * from a snapshot buffer, aligned to MEM_ALIGNMENT (see also: lit_id_hash_table_load_from_snapshot):
+ *   uint32_t idx_num_total - total number of (byte-code block, idx) pairs;
+ *   uint32_t blocks[blocks_num + 1] - offset of each block's first pair in the array of literal indexes;
+ *   uint16_t lit_indexes[idx_num_total] - indexes of the pairs' literals in the snapshot's literal table;
+ *   padding up to MEM_ALIGNMENT.
+ *
  * @return number of bytes dumper - upon success,
  *         0 - upon failure
  */
@@ -155,13 +255,21 @@ lit_id_hash_table_dump_for_snapshot (uint8_t *buffer_p, /**< buffer to dump to *
 
   size_t blocks_num = JERRY_ALIGNUP (instrs_num, BLOCK_SIZE) / BLOCK_SIZE;
 
-  for (size_t block_index = 0, next_block_index;
-       block_index < blocks_num;
-      )
+  uint32_t block_offset = 0;
+
+  for (size_t block_index = 0; block_index < blocks_num; block_index++)
   {
-    uint32_t idx_num_in_block;
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, block_offset))
+    {
+      return 0;
+    }
 
-    next_block_index = block_index + 1u;
+    if (table_p->buckets[block_index] == NULL)
+    {
+      continue;
+    }
+
+    size_t next_block_index = block_index + 1u;
 
     while (next_block_index < blocks_num
            && table_p->buckets[next_block_index] == NULL)
@@ -171,54 +279,53 @@ lit_id_hash_table_dump_for_snapshot (uint8_t *buffer_p, /**< buffer to dump to *
 
     if (next_block_index != blocks_num)
     {
-      idx_num_in_block = (uint32_t) (table_p->buckets[next_block_index] - table_p->buckets[block_index]);
-    }
-    else if (table_p->buckets[block_index] != NULL)
-    {
-      idx_num_in_block = (uint32_t) (table_p->current_bucket_pos
-                                     - (size_t) (table_p->buckets[block_index] - table_p->buckets[0]));
+      block_offset = (uint32_t) (table_p->buckets[next_block_index] - table_p->raw_buckets);
     }
     else
     {
-      idx_num_in_block = 0;
+      block_offset = idx_num_total;
     }
+  }
 
-    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, idx_num_in_block))
-    {
-      return 0;
-    }
+  JERRY_ASSERT (block_offset == idx_num_total);
 
-    for (size_t block_idx_pair_index = 0;
-         block_idx_pair_index < idx_num_in_block;
-         block_idx_pair_index++)
-    {
-      lit_cpointer_t lit_cp = table_p->buckets[block_index][block_idx_pair_index];
+  if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, block_offset))
+  {
+    return 0;
+  }
 
-      uint32_t lit_index;
-      for (lit_index = 0; lit_index < literals_num; lit_index++)
-      {
-        if (lit_map_p[lit_index].literal_id.packed_value == lit_cp.packed_value)
-        {
-          break;
-        }
-      }
-      JERRY_ASSERT (lit_index < literals_num);
+  for (uint32_t idx_index = 0; idx_index < idx_num_total; idx_index++)
+  {
+    lit_cpointer_t lit_cp = table_p->raw_buckets[idx_index];
 
-      uint32_t offset = lit_map_p[lit_index].literal_offset;
-      if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, offset))
+    uint32_t lit_index;
+    for (lit_index = 0; lit_index < literals_num; lit_index++)
+    {
+      if (lit_map_p[lit_index].literal_id.packed_value == lit_cp.packed_value)
       {
-        return 0;
+        break;
       }
     }
+    JERRY_ASSERT (lit_index < literals_num);
 
-    while (++block_index < next_block_index)
+    /* number of literals is limited by width of compressed pointer */
+    uint16_t lit_index_in_snapshot = (uint16_t) lit_index;
+    JERRY_ASSERT (lit_index_in_snapshot == lit_index);
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, lit_index_in_snapshot))
     {
-      idx_num_in_block = 0;
+      return 0;
+    }
+  }
 
-      if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, idx_num_in_block))
-      {
-        return 0;
-      }
+  while (JERRY_ALIGNUP (*in_out_buffer_offset_p - begin_offset, MEM_ALIGNMENT)
+         != *in_out_buffer_offset_p - begin_offset)
+  {
+    uint8_t padding = 0;
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, padding))
+    {
+      return 0;
     }
   }
 
@@ -228,18 +335,37 @@ lit_id_hash_table_dump_for_snapshot (uint8_t *buffer_p, /**< buffer to dump to *
   return (uint32_t) bytes_written;
 } /* lit_id_hash_table_dump_for_snapshot */
 
+/**
+ * Get size of buffer, necessary to hold hash table, loaded from snapshot
+ *
+ * @return size of buffer
+ */
+size_t
+lit_id_hash_table_get_size_for_snapshot_table (uint32_t literals_num) /**< number of literals in snapshot */
+{
+  const size_t header_size = JERRY_ALIGNUP (sizeof (lit_id_hash_table), MEM_ALIGNMENT);
+  const size_t lit_cps_size = JERRY_ALIGNUP (sizeof (lit_cpointer_t) * literals_num, MEM_ALIGNMENT);
+
+  return header_size + lit_cps_size;
+} /* lit_id_hash_table_get_size_for_snapshot_table */
+
 /**
  * Load literal identifiers hash table from specified snapshot buffer
  *
- * @return true - upon successful load (i.e. data in snapshot is consistent),
- *         false - upon failure (in case, snapshot is incorrect)
+ * Note:
+ *      the idx-to-literal map is not copied - the table references it in place, so the map
+ *      should be available until the table is freed; the only data, initialized in the table's buffer,
+ *      is the array of compressed pointers to the snapshot's literals, indexed by the literals' indexes
+ *      in the snapshot's literal table.
+ *
+ * @return pointer to header of the table - upon successful load (i.e. data in snapshot is consistent),
+ *         NULL - upon failure (in case, snapshot is incorrect)
  */
-bool
+lit_id_hash_table *
 lit_id_hash_table_load_from_snapshot (size_t blocks_count, /**< number of byte-code blocks
                                                             *   in corresponding byte-code array */
-                                      uint32_t idx_num_total, /**< total number of (byte-code block, idx)
-                                                               *   pairs in snapshot */
-                                      const uint8_t *idx_to_lit_map_p, /**< idx-to-lit map in snapshot */
+                                      const uint8_t *idx_to_lit_map_p, /**< idx-to-lit map in snapshot
+                                                                        *   (should be aligned to uint32_t) */
                                       size_t idx_to_lit_map_size, /**< size of the map */
                                       const lit_mem_to_snapshot_id_map_entry_t *lit_map_p, /**< map of in-snapshot
                                                                                             *   literal offsets
@@ -250,74 +376,250 @@ lit_id_hash_table_load_from_snapshot (size_t blocks_count, /**< number of byte-c
                                       uint8_t *buffer_for_hash_table_p, /**< buffer to initialize hash table in */
                                       size_t buffer_for_hash_table_size) /**< size of the buffer */
 {
-  lit_id_hash_table *hash_table_p = lit_id_hash_table_init (buffer_for_hash_table_p,
-                                                            buffer_for_hash_table_size,
-                                                            idx_num_total,
-                                                            blocks_count);
+  JERRY_ASSERT (((uintptr_t) idx_to_lit_map_p) % sizeof (uint32_t) == 0);
+  JERRY_ASSERT (lit_id_hash_table_get_size_for_snapshot_table (literals_num) <= buffer_for_hash_table_size);
 
   size_t idx_to_lit_map_offset = 0;
-  uint32_t idx_num_counter = 0;
+
+  uint32_t idx_num_total;
+  if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p,
+                                       idx_to_lit_map_size,
+                                       &idx_to_lit_map_offset,
+                                       &idx_num_total)
+      || idx_num_total > idx_to_lit_map_size
+      || blocks_count > idx_to_lit_map_size)
+  {
+    return NULL;
+  }
+
+  const size_t blocks_size = sizeof (uint32_t) * (blocks_count + 1u);
+  const size_t lit_indexes_size = sizeof (uint16_t) * idx_num_total;
+
+  if (idx_to_lit_map_offset + blocks_size + lit_indexes_size > idx_to_lit_map_size)
+  {
+    return NULL;
+  }
+
+  const uint32_t *blocks_p = (const uint32_t *) (idx_to_lit_map_p + idx_to_lit_map_offset);
+  const uint16_t *lit_indexes_p = (const uint16_t *) (idx_to_lit_map_p + idx_to_lit_map_offset + blocks_size);
+
+  if (blocks_p[0] != 0
+      || blocks_p[blocks_count] != idx_num_total)
+  {
+    return NULL;
+  }
+
   for (size_t block_idx = 0; block_idx < blocks_count; block_idx++)
   {
-    uint32_t idx_num_in_block;
-    if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p,
-                                         idx_to_lit_map_size,
-                                         &idx_to_lit_map_offset,
-                                         &idx_num_in_block))
+    if (blocks_p[block_idx] > blocks_p[block_idx + 1u])
+    {
+      return NULL;
+    }
+  }
+
+  for (uint32_t idx_index = 0; idx_index < idx_num_total; idx_index++)
+  {
+    if (lit_indexes_p[idx_index] >= literals_num)
+    {
+      return NULL;
+    }
+  }
+
+  const size_t header_size = JERRY_ALIGNUP (sizeof (lit_id_hash_table), MEM_ALIGNMENT);
+
+  lit_id_hash_table *hash_table_p = (lit_id_hash_table *) buffer_for_hash_table_p;
+
+  hash_table_p->current_bucket_pos = literals_num;
+  hash_table_p->raw_buckets = (lit_cpointer_t *) (buffer_for_hash_table_p + header_size);
+  hash_table_p->buckets = NULL;
+  hash_table_p->snapshot_blocks_p = blocks_p;
+  hash_table_p->snapshot_lit_indexes_p = lit_indexes_p;
+
+  for (uint32_t lit_index = 0; lit_index < literals_num; lit_index++)
+  {
+    hash_table_p->raw_buckets[lit_index] = lit_map_p[lit_index].literal_id;
+  }
+
+  return hash_table_p;
+} /* lit_id_hash_table_load_from_snapshot */
+
+/**
+ * Encode idx-to-literal map, dumped to snapshot, in compact form
+ *
+ * In the compact form, numbers of the map's elements are stored in variable-length encoding,
+ * and in-snapshot literal indexes are stored as variable-length encoded differences
+ * between consecutive indexes (mapped to unsigned values: 0, -1, 1, -2, ...).
+ *
+ * See also:
+ *          lit_id_hash_table_dump_for_snapshot
+ *
+ * @return true, upon success (i.e. the map is valid and buffer size is sufficient),
+ *         false - otherwise.
+ */
+bool
+lit_id_hash_table_encode_snapshot_map_compact (const uint8_t *idx_to_lit_map_p, /**< idx-to-lit map in snapshot
+                                                                                 *   (not necessarily aligned) */
+                                               size_t idx_to_lit_map_size, /**< size of the map */
+                                               size_t blocks_count, /**< number of byte-code blocks
+                                                                     *   in corresponding byte-code array */
+                                               uint8_t *buffer_p, /**< buffer to encode to */
+                                               size_t buffer_size, /**< buffer size */
+                                               size_t *in_out_buffer_offset_p) /**< in-out: buffer write offset */
+{
+  size_t map_read_offset = 0;
+
+  uint32_t idx_num_total;
+  if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_read_offset, &idx_num_total)
+      || !jrt_write_varint_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, idx_num_total))
+  {
+    return false;
+  }
+
+  uint32_t block_begin;
+  if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_read_offset, &block_begin)
+      || block_begin != 0)
+  {
+    return false;
+  }
+
+  for (size_t block_index = 0; block_index < blocks_count; block_index++)
+  {
+    uint32_t block_end;
+
+    if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_read_offset, &block_end)
+        || block_end < block_begin
+        || !jrt_write_varint_to_buffer_by_offset (buffer_p,
+                                                  buffer_size,
+                                                  in_out_buffer_offset_p,
+                                                  block_end - block_begin))
+    {
+      return false;
+    }
+
+    block_begin = block_end;
+  }
+
+  if (block_begin != idx_num_total)
+  {
+    return false;
+  }
+
+  int32_t prev_lit_index = 0;
+
+  for (uint32_t idx_index = 0; idx_index < idx_num_total; idx_index++)
+  {
+    uint16_t lit_index;
+
+    if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_read_offset, &lit_index))
     {
       return false;
     }
 
-    hash_table_p->buckets[block_idx] = hash_table_p->raw_buckets + hash_table_p->current_bucket_pos;
+    int32_t diff = (int32_t) lit_index - prev_lit_index;
+    uint32_t diff_code = (diff >= 0) ? ((uint32_t) diff << 1u) : ((((uint32_t) -diff) << 1u) - 1u);
 
-    if (idx_num_counter + idx_num_in_block < idx_num_counter)
+    if (!jrt_write_varint_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, diff_code))
     {
       return false;
     }
-    idx_num_counter += idx_num_in_block;
 
-    if (idx_num_counter > idx_num_total)
+    prev_lit_index = lit_index;
+  }
+
+  return true;
+} /* lit_id_hash_table_encode_snapshot_map_compact */
+
+/**
+ * Decode idx-to-literal map from compact form (see also: lit_id_hash_table_encode_snapshot_map_compact)
+ *
+ * @return true, upon success (i.e. the encoded map is valid and it fits into the specified size),
+ *         false - otherwise.
+ */
+bool
+lit_id_hash_table_decode_snapshot_map_compact (const uint8_t *encoded_p, /**< encoded data */
+                                               size_t encoded_size, /**< size of encoded data */
+                                               size_t *in_out_encoded_offset_p, /**< in-out: encoded data
+                                                                                 *   read offset */
+                                               size_t blocks_count, /**< number of byte-code blocks
+                                                                     *   in corresponding byte-code array */
+                                               uint8_t *idx_to_lit_map_p, /**< out: idx-to-lit map */
+                                               size_t idx_to_lit_map_size) /**< size of the map */
+{
+  size_t map_write_offset = 0;
+
+  uint32_t idx_num_total;
+  if (!jrt_read_varint_from_buffer_by_offset (encoded_p, encoded_size, in_out_encoded_offset_p, &idx_num_total)
+      || !jrt_write_to_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_write_offset, idx_num_total))
+  {
+    return false;
+  }
+
+  uint32_t block_begin = 0;
+  if (!jrt_write_to_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_write_offset, block_begin))
+  {
+    return false;
+  }
+
+  for (size_t block_index = 0; block_index < blocks_count; block_index++)
+  {
+    uint32_t block_idx_num;
+
+    if (!jrt_read_varint_from_buffer_by_offset (encoded_p, encoded_size, in_out_encoded_offset_p, &block_idx_num)
+        || block_idx_num > idx_num_total - block_begin)
     {
       return false;
     }
 
-    for (uint32_t idx_in_block = 0; idx_in_block < idx_num_in_block; idx_in_block++)
+    block_begin += block_idx_num;
+
+    if (!jrt_write_to_buffer_by_offset (idx_to_lit_map_p, idx_to_lit_map_size, &map_write_offset, block_begin))
     {
-      uint32_t lit_offset_from_snapshot;
-      if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p,
-                                           idx_to_lit_map_size,
-                                           &idx_to_lit_map_offset,
-                                           &lit_offset_from_snapshot))
-      {
-        return false;
-      }
+      return false;
+    }
+  }
 
-      /**
-       * TODO: implement binary search here
-       */
-      lit_cpointer_t lit_cp = lit_cpointer_t::null_cp ();
-      uint32_t i;
-      for (i = 0; i < literals_num; i++)
-      {
-        if (lit_map_p[i].literal_offset == lit_offset_from_snapshot)
-        {
-          lit_cp.packed_value = lit_map_p[i].literal_id.packed_value;
-          break;
-        }
-      }
+  if (block_begin != idx_num_total)
+  {
+    return false;
+  }
 
-      if (i == literals_num)
-      {
-        return false;
-      }
+  int32_t lit_index = 0;
+
+  for (uint32_t idx_index = 0; idx_index < idx_num_total; idx_index++)
+  {
+    uint32_t diff_code;
+
+    if (!jrt_read_varint_from_buffer_by_offset (encoded_p, encoded_size, in_out_encoded_offset_p, &diff_code)
+        || diff_code > 2u * UINT16_MAX)
+    {
+      return false;
+    }
+
+    int32_t diff = ((diff_code & 1u) == 0) ? (int32_t) (diff_code >> 1u) : -(int32_t) ((diff_code + 1u) >> 1u);
+    lit_index += diff;
+
+    if (lit_index < 0
+        || lit_index > UINT16_MAX)
+    {
+      return false;
+    }
+
+    uint16_t lit_index_in_snapshot = (uint16_t) lit_index;
 
-      JERRY_ASSERT (hash_table_p->current_bucket_pos < idx_num_total);
-      hash_table_p->raw_buckets[hash_table_p->current_bucket_pos++] = lit_cp;
+    if (!jrt_write_to_buffer_by_offset (idx_to_lit_map_p,
+                                        idx_to_lit_map_size,
+                                        &map_write_offset,
+                                        lit_index_in_snapshot))
+    {
+      return false;
     }
   }
 
+  /* padding */
+  memset (idx_to_lit_map_p + map_write_offset, 0, idx_to_lit_map_size - map_write_offset);
+
   return true;
-} /* lit_id_hash_table_load_from_snapshot */
+} /* lit_id_hash_table_decode_snapshot_map_compact */
 
 
 /**
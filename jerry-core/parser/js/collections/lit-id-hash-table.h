@@ -26,6 +26,9 @@ typedef struct
   size_t current_bucket_pos;
   lit_cpointer_t *raw_buckets;
   lit_cpointer_t **buckets;
+  const uint32_t *snapshot_blocks_p; /**< per-block offsets of the in-snapshot idx-to-literal map
+                                      *   (NULL, if the table was not loaded from snapshot) */
+  const uint16_t *snapshot_lit_indexes_p; /**< in-snapshot indexes of literals in the snapshot's literal table */
 } lit_id_hash_table;
 
 lit_id_hash_table *lit_id_hash_table_init (uint8_t *, size_t, size_t, size_t);
@@ -33,8 +36,15 @@ size_t lit_id_hash_table_get_size_for_table (size_t, size_t);
 void lit_id_hash_table_free (lit_id_hash_table *);
 void lit_id_hash_table_insert (lit_id_hash_table *, vm_idx_t, vm_instr_counter_t, lit_cpointer_t);
 lit_cpointer_t lit_id_hash_table_lookup (lit_id_hash_table *, vm_idx_t, vm_instr_counter_t);
+void lit_id_hash_table_mark_literals (lit_id_hash_table *);
+bool lit_id_hash_table_is_in_heap (lit_id_hash_table *);
+uint32_t lit_id_hash_table_get_literals (lit_id_hash_table *, lit_cpointer_t *, uint32_t);
 uint32_t lit_id_hash_table_dump_for_snapshot (uint8_t *, size_t, size_t *, lit_id_hash_table *,
                                               const lit_mem_to_snapshot_id_map_entry_t *, uint32_t, vm_instr_counter_t);
-bool lit_id_hash_table_load_from_snapshot (size_t, uint32_t, const uint8_t *, size_t,
-                                           const lit_mem_to_snapshot_id_map_entry_t *, uint32_t, uint8_t *, size_t);
+size_t lit_id_hash_table_get_size_for_snapshot_table (uint32_t);
+lit_id_hash_table *lit_id_hash_table_load_from_snapshot (size_t, const uint8_t *, size_t,
+                                                         const lit_mem_to_snapshot_id_map_entry_t *, uint32_t,
+                                                         uint8_t *, size_t);
+bool lit_id_hash_table_encode_snapshot_map_compact (const uint8_t *, size_t, size_t, uint8_t *, size_t, size_t *);
+bool lit_id_hash_table_decode_snapshot_map_compact (const uint8_t *, size_t, size_t *, size_t, uint8_t *, size_t);
 #endif /* LIT_ID_HASH_TABLE */
@@ -23,21 +23,202 @@
  *
  * \addtogroup managedmem Managed memory allocation
  * @{
+ *
+ * Blocks, allocated by parser, are placed into memory arena, consisting of large chunks, taken from the heap.
+ *
+ * Each block is rounded up to one of power-of-two size classes. A freed block is put to free list of its
+ * size class, and is reused by following allocations of the same class. The arena's chunks are returned
+ * to the heap only upon jsp_mm_free_all, in one shot, so parsing doesn't leave holes in the heap.
+ *
+ * Blocks, larger than maximum size class, are allocated from the heap separately.
  */
 
 /**
  * Header of a managed block, allocated by parser
  */
-typedef struct __attribute__ ((alignment (MEM_ALIGNMENT)))
+typedef struct
 {
-  mem_cpointer_t prev_block_cp; /**< previous managed block */
-  mem_cpointer_t next_block_cp; /**< next managed block */
+  mem_cpointer_t prev_block_cp; /**< previous separately allocated block */
+  mem_cpointer_t next_block_cp; /**< next separately allocated block, or
+                                 *   next free block of the same size class */
+  uint8_t size_class; /**< size class of the block, or JSP_MM_SIZE_CLASS_SEPARATE */
+  uint16_t separate_block_size; /**< size of separately allocated block, in MEM_ALIGNMENT units */
 } jsp_mm_header_t;
 
 /**
- * List used for tracking memory blocks
+ * Header of the arena's chunk
+ */
+typedef struct
+{
+  mem_cpointer_t next_chunk_cp; /**< next chunk */
+  uint16_t chunk_size; /**< size of the chunk, in MEM_ALIGNMENT units */
+} jsp_mm_chunk_header_t;
+
+/**
+ * Size of managed block's header
+ */
+#define JSP_MM_HEADER_SIZE (JERRY_ALIGNUP (sizeof (jsp_mm_header_t), MEM_ALIGNMENT))
+
+/**
+ * Size of the arena's chunk header
+ */
+#define JSP_MM_CHUNK_HEADER_SIZE (JERRY_ALIGNUP (sizeof (jsp_mm_chunk_header_t), MEM_ALIGNMENT))
+
+/**
+ * Log2 of minimum block size (including header)
+ */
+#define JSP_MM_MIN_BLOCK_SIZE_LOG (4u)
+
+/**
+ * Minimum block size (including header)
+ */
+#define JSP_MM_MIN_BLOCK_SIZE (1u << JSP_MM_MIN_BLOCK_SIZE_LOG)
+
+/**
+ * Number of size classes
  */
-jsp_mm_header_t *jsp_mm_blocks_p = NULL;
+#define JSP_MM_SIZE_CLASSES_NUMBER (CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE_LOG - JSP_MM_MIN_BLOCK_SIZE_LOG + 1u)
+
+/**
+ * Size class of blocks, allocated separately from the arena
+ */
+#define JSP_MM_SIZE_CLASS_SEPARATE (JSP_MM_SIZE_CLASSES_NUMBER)
+
+JERRY_STATIC_ASSERT (JSP_MM_MIN_BLOCK_SIZE > JSP_MM_HEADER_SIZE);
+JERRY_STATIC_ASSERT ((CONFIG_MEM_HEAP_AREA_SIZE >> MEM_ALIGNMENT_LOG) <= UINT16_MAX);
+JERRY_STATIC_ASSERT ((1u << CONFIG_PARSER_ARENA_MAX_BLOCK_SIZE_LOG) + JSP_MM_CHUNK_HEADER_SIZE
+                     <= CONFIG_PARSER_ARENA_MAX_CHUNK_SIZE);
+
+/**
+ * List of the arena's chunks
+ */
+static jsp_mm_chunk_header_t *jsp_mm_chunks_p = NULL;
+
+/**
+ * Free space at end of the last chunk
+ */
+static uint8_t *jsp_mm_arena_free_begin_p = NULL;
+static uint8_t *jsp_mm_arena_free_end_p = NULL;
+
+/**
+ * Size of next chunk to allocate
+ */
+static size_t jsp_mm_next_chunk_size = CONFIG_PARSER_ARENA_MIN_CHUNK_SIZE;
+
+/**
+ * Free lists of size classes
+ */
+static mem_cpointer_t jsp_mm_free_lists_cp[JSP_MM_SIZE_CLASSES_NUMBER];
+
+/**
+ * List of separately allocated blocks
+ */
+static jsp_mm_header_t *jsp_mm_separate_blocks_p = NULL;
+
+#ifdef MEM_STATS
+/**
+ * Arena usage statistics
+ */
+static jsp_mm_stats_t jsp_mm_stats;
+
+static void jsp_mm_stats_update (int32_t, int32_t, int32_t, int32_t);
+#  define JSP_MM_STATS_UPDATE(arena_delta, allocated_delta, chunks_delta, separate_blocks_delta) \
+  jsp_mm_stats_update (arena_delta, allocated_delta, chunks_delta, separate_blocks_delta)
+#else /* !MEM_STATS */
+#  define JSP_MM_STATS_UPDATE(arena_delta, allocated_delta, chunks_delta, separate_blocks_delta)
+#endif /* !MEM_STATS */
+
+/**
+ * Get size of blocks of the specified size class
+ *
+ * @return block size, including header
+ */
+static size_t
+jsp_mm_get_size_class_block_size (uint8_t size_class) /**< size class */
+{
+  JERRY_ASSERT (size_class < JSP_MM_SIZE_CLASSES_NUMBER);
+
+  return ((size_t) JSP_MM_MIN_BLOCK_SIZE) << size_class;
+} /* jsp_mm_get_size_class_block_size */
+
+/**
+ * Get size class for a block of the specified size
+ *
+ * @return size class, or JSP_MM_SIZE_CLASS_SEPARATE - if the block is larger than maximum size class
+ */
+static uint8_t
+jsp_mm_get_size_class (size_t block_size) /**< block size, including header */
+{
+  uint8_t size_class = 0;
+
+  while (size_class < JSP_MM_SIZE_CLASSES_NUMBER
+         && jsp_mm_get_size_class_block_size (size_class) < block_size)
+  {
+    size_class++;
+  }
+
+  return size_class;
+} /* jsp_mm_get_size_class */
+
+/**
+ * Put a block to free list of its size class
+ */
+static void
+jsp_mm_put_to_free_list (jsp_mm_header_t *header_p, /**< block */
+                         uint8_t size_class) /**< block's size class */
+{
+  header_p->size_class = size_class;
+  header_p->next_block_cp = jsp_mm_free_lists_cp[size_class];
+  MEM_CP_SET_NON_NULL_POINTER (jsp_mm_free_lists_cp[size_class], header_p);
+} /* jsp_mm_put_to_free_list */
+
+/**
+ * Distribute the rest of free space of the last chunk among free lists
+ */
+static void
+jsp_mm_arena_distribute_free_space (void)
+{
+  while (jsp_mm_arena_free_end_p - jsp_mm_arena_free_begin_p >= (ptrdiff_t) JSP_MM_MIN_BLOCK_SIZE)
+  {
+    size_t free_size = (size_t) (jsp_mm_arena_free_end_p - jsp_mm_arena_free_begin_p);
+    uint8_t size_class = (uint8_t) (JSP_MM_SIZE_CLASSES_NUMBER - 1u);
+
+    while (jsp_mm_get_size_class_block_size (size_class) > free_size)
+    {
+      size_class--;
+    }
+
+    jsp_mm_put_to_free_list ((jsp_mm_header_t *) jsp_mm_arena_free_begin_p, size_class);
+    jsp_mm_arena_free_begin_p += jsp_mm_get_size_class_block_size (size_class);
+  }
+} /* jsp_mm_arena_distribute_free_space */
+
+/**
+ * Add a chunk to the arena
+ */
+static void
+jsp_mm_arena_add_chunk (size_t block_size) /**< size of block, that should fit into the chunk */
+{
+  jsp_mm_arena_distribute_free_space ();
+
+  size_t chunk_size = JERRY_MAX (jsp_mm_next_chunk_size, block_size + JSP_MM_CHUNK_HEADER_SIZE);
+
+  jsp_mm_chunk_header_t *chunk_p = (jsp_mm_chunk_header_t *) mem_heap_alloc_block (chunk_size,
+                                                                                   MEM_HEAP_ALLOC_SHORT_TERM);
+  MEM_CP_SET_POINTER (chunk_p->next_chunk_cp, jsp_mm_chunks_p);
+  chunk_p->chunk_size = (uint16_t) (chunk_size >> MEM_ALIGNMENT_LOG);
+  jsp_mm_chunks_p = chunk_p;
+
+  jsp_mm_arena_free_begin_p = (uint8_t *) chunk_p + JSP_MM_CHUNK_HEADER_SIZE;
+  jsp_mm_arena_free_end_p = (uint8_t *) chunk_p + chunk_size;
+
+  if (jsp_mm_next_chunk_size < CONFIG_PARSER_ARENA_MAX_CHUNK_SIZE)
+  {
+    jsp_mm_next_chunk_size *= 2;
+  }
+
+  JSP_MM_STATS_UPDATE ((int32_t) chunk_size, 0, 1, 0);
+} /* jsp_mm_arena_add_chunk */
 
 /**
  * Initialize managed memory allocator
@@ -45,7 +226,17 @@ jsp_mm_header_t *jsp_mm_blocks_p = NULL;
 void
 jsp_mm_init (void)
 {
-  JERRY_ASSERT (jsp_mm_blocks_p == NULL);
+  JERRY_ASSERT (jsp_mm_chunks_p == NULL);
+  JERRY_ASSERT (jsp_mm_separate_blocks_p == NULL);
+
+  jsp_mm_arena_free_begin_p = NULL;
+  jsp_mm_arena_free_end_p = NULL;
+  jsp_mm_next_chunk_size = CONFIG_PARSER_ARENA_MIN_CHUNK_SIZE;
+
+  for (uint8_t size_class = 0; size_class < JSP_MM_SIZE_CLASSES_NUMBER; size_class++)
+  {
+    jsp_mm_free_lists_cp[size_class] = MEM_CP_NULL;
+  }
 } /* jsp_mm_init */
 
 /**
@@ -54,7 +245,8 @@ jsp_mm_init (void)
 void
 jsp_mm_finalize (void)
 {
-  JERRY_ASSERT (jsp_mm_blocks_p == NULL);
+  JERRY_ASSERT (jsp_mm_chunks_p == NULL);
+  JERRY_ASSERT (jsp_mm_separate_blocks_p == NULL);
 } /* jsp_mm_finalize */
 
 /**
@@ -71,17 +263,29 @@ jsp_mm_finalize (void)
  *      allocation request.
  *
  *      The interface helps to choose appropriate space
- *      to allocate, considering amount of heap space,
+ *      to allocate, considering amount of space,
  *      that would be waste if allocation size
- *      would not be increased.
+ *      would not be increased (i.e. size of the block's
+ *      size class, so growing collections double their size).
  *
  * @return recommended allocation size
  */
 size_t
 jsp_mm_recommend_size (size_t minimum_size) /**< minimum required size */
 {
-  size_t block_and_header_size = mem_heap_recommend_allocation_size (minimum_size + sizeof (jsp_mm_header_t));
-  return block_and_header_size - sizeof (jsp_mm_header_t);
+  size_t block_size = minimum_size + JSP_MM_HEADER_SIZE;
+  uint8_t size_class = jsp_mm_get_size_class (block_size);
+
+  if (size_class == JSP_MM_SIZE_CLASS_SEPARATE)
+  {
+    block_size = mem_heap_recommend_allocation_size (block_size);
+  }
+  else
+  {
+    block_size = jsp_mm_get_size_class_block_size (size_class);
+  }
+
+  return block_size - JSP_MM_HEADER_SIZE;
 } /* jsp_mm_recommend_size */
 
 /**
@@ -92,71 +296,233 @@ jsp_mm_recommend_size (size_t minimum_size) /**< minimum required size */
 void*
 jsp_mm_alloc (size_t size) /**< size of block to allocate */
 {
-  void *ptr_p = mem_heap_alloc_block (size + sizeof (jsp_mm_header_t), MEM_HEAP_ALLOC_SHORT_TERM);
+  size_t block_size = size + JSP_MM_HEADER_SIZE;
+  uint8_t size_class = jsp_mm_get_size_class (block_size);
 
-  jsp_mm_header_t *tmem_header_p = (jsp_mm_header_t*) ptr_p;
+  jsp_mm_header_t *header_p;
 
-  tmem_header_p->prev_block_cp = MEM_CP_NULL;
-  MEM_CP_SET_POINTER (tmem_header_p->next_block_cp, jsp_mm_blocks_p);
+  if (size_class == JSP_MM_SIZE_CLASS_SEPARATE)
+  {
+    block_size = JERRY_ALIGNUP (block_size, MEM_ALIGNMENT);
 
-  if (jsp_mm_blocks_p != NULL)
+    header_p = (jsp_mm_header_t *) mem_heap_alloc_block (block_size, MEM_HEAP_ALLOC_SHORT_TERM);
+
+    header_p->separate_block_size = (uint16_t) (block_size >> MEM_ALIGNMENT_LOG);
+    header_p->prev_block_cp = MEM_CP_NULL;
+    MEM_CP_SET_POINTER (header_p->next_block_cp, jsp_mm_separate_blocks_p);
+
+    if (jsp_mm_separate_blocks_p != NULL)
+    {
+      MEM_CP_SET_NON_NULL_POINTER (jsp_mm_separate_blocks_p->prev_block_cp, header_p);
+    }
+
+    jsp_mm_separate_blocks_p = header_p;
+
+    JSP_MM_STATS_UPDATE ((int32_t) block_size, (int32_t) block_size, 0, 1);
+  }
+  else
   {
-    MEM_CP_SET_POINTER (jsp_mm_blocks_p->prev_block_cp, tmem_header_p);
+    block_size = jsp_mm_get_size_class_block_size (size_class);
+
+    header_p = MEM_CP_GET_POINTER (jsp_mm_header_t, jsp_mm_free_lists_cp[size_class]);
+
+    if (header_p != NULL)
+    {
+      jsp_mm_free_lists_cp[size_class] = header_p->next_block_cp;
+    }
+    else
+    {
+      if (jsp_mm_arena_free_end_p - jsp_mm_arena_free_begin_p < (ptrdiff_t) block_size)
+      {
+        jsp_mm_arena_add_chunk (block_size);
+      }
+
+      header_p = (jsp_mm_header_t *) jsp_mm_arena_free_begin_p;
+      jsp_mm_arena_free_begin_p += block_size;
+    }
+
+    JSP_MM_STATS_UPDATE (0, (int32_t) block_size, 0, 0);
   }
 
-  jsp_mm_blocks_p = tmem_header_p;
+  header_p->size_class = size_class;
 
-  return (void *) (tmem_header_p + 1);
+  return (uint8_t *) header_p + JSP_MM_HEADER_SIZE;
 } /* jsp_mm_alloc */
 
 /**
  * Free a managed memory block
+ *
+ * Note:
+ *      blocks of the arena are only put to free lists, to be reused by following allocations,
+ *      or, in case the block is the last one allocated from the last chunk, returned to the chunk's free space
  */
 void
 jsp_mm_free (void *ptr) /**< pointer to data space of allocated block */
 {
-  jsp_mm_header_t *tmem_header_p = ((jsp_mm_header_t *) ptr) - 1;
+  jsp_mm_header_t *header_p = (jsp_mm_header_t *) ((uint8_t *) ptr - JSP_MM_HEADER_SIZE);
 
-  jsp_mm_header_t *prev_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                      tmem_header_p->prev_block_cp);
-  jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                      tmem_header_p->next_block_cp);
-
-  if (prev_block_p != NULL)
+  if (header_p->size_class == JSP_MM_SIZE_CLASS_SEPARATE)
   {
-    prev_block_p->next_block_cp = tmem_header_p->next_block_cp;
+    jsp_mm_header_t *prev_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t, header_p->prev_block_cp);
+    jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t, header_p->next_block_cp);
+
+    if (prev_block_p != NULL)
+    {
+      prev_block_p->next_block_cp = header_p->next_block_cp;
+    }
+    else
+    {
+      JERRY_ASSERT (jsp_mm_separate_blocks_p == header_p);
+      jsp_mm_separate_blocks_p = next_block_p;
+    }
+
+    if (next_block_p != NULL)
+    {
+      next_block_p->prev_block_cp = header_p->prev_block_cp;
+    }
+
+    size_t block_size = ((size_t) header_p->separate_block_size) << MEM_ALIGNMENT_LOG;
+    JERRY_ASSERT (block_size != 0);
+
+    mem_heap_free_block (header_p);
+
+    JSP_MM_STATS_UPDATE (-(int32_t) block_size, -(int32_t) block_size, 0, -1);
   }
   else
   {
-    JERRY_ASSERT (jsp_mm_blocks_p == tmem_header_p);
-    jsp_mm_blocks_p = next_block_p;
-  }
+    JERRY_ASSERT (header_p->size_class < JSP_MM_SIZE_CLASSES_NUMBER);
 
-  if (next_block_p != NULL)
-  {
-    next_block_p->prev_block_cp = tmem_header_p->prev_block_cp;
-  }
+    size_t block_size = jsp_mm_get_size_class_block_size (header_p->size_class);
 
-  mem_heap_free_block (tmem_header_p);
+    if ((uint8_t *) header_p + block_size == jsp_mm_arena_free_begin_p)
+    {
+      jsp_mm_arena_free_begin_p = (uint8_t *) header_p;
+    }
+    else
+    {
+      jsp_mm_put_to_free_list (header_p, header_p->size_class);
+    }
+
+    JSP_MM_STATS_UPDATE (0, -(int32_t) block_size, 0, 0);
+  }
 } /* jsp_mm_free */
 
 /**
- * Free all currently allocated managed memory blocks
+ * Free all currently allocated managed memory blocks, returning the arena's chunks to the heap
  */
 void
 jsp_mm_free_all (void)
 {
-  while (jsp_mm_blocks_p != NULL)
+  while (jsp_mm_separate_blocks_p != NULL)
+  {
+    jsp_mm_free ((uint8_t *) jsp_mm_separate_blocks_p + JSP_MM_HEADER_SIZE);
+  }
+
+#ifdef MEM_STATS
+  /* all blocks, remaining in the arena, are freed together with the arena's chunks */
+  jsp_mm_stats.allocated_size = 0;
+#endif /* MEM_STATS */
+
+  while (jsp_mm_chunks_p != NULL)
   {
-    jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                        jsp_mm_blocks_p->next_block_cp);
+    jsp_mm_chunk_header_t *next_chunk_p = MEM_CP_GET_POINTER (jsp_mm_chunk_header_t,
+                                                              jsp_mm_chunks_p->next_chunk_cp);
 
-    mem_heap_free_block (jsp_mm_blocks_p);
+    size_t chunk_size = ((size_t) jsp_mm_chunks_p->chunk_size) << MEM_ALIGNMENT_LOG;
+    JERRY_ASSERT (chunk_size != 0);
 
-    jsp_mm_blocks_p = next_block_p;
+    mem_heap_free_block (jsp_mm_chunks_p);
+
+    JSP_MM_STATS_UPDATE (-(int32_t) chunk_size, 0, -1, 0);
+
+    jsp_mm_chunks_p = next_chunk_p;
   }
+
+  jsp_mm_init ();
 } /* jsp_mm_free_all */
 
+#ifdef MEM_STATS
+/**
+ * Update arena usage statistics
+ */
+static void
+jsp_mm_stats_update (int32_t arena_delta, /**< change of number of bytes, taken from the heap */
+                     int32_t allocated_delta, /**< change of number of bytes in allocated blocks */
+                     int32_t chunks_delta, /**< change of number of chunks */
+                     int32_t separate_blocks_delta) /**< change of number of separately allocated blocks */
+{
+  if (chunks_delta > 0)
+  {
+    /* free space of the arena, that could not be reused, so a new chunk is required */
+    jsp_mm_stats.peak_waste_size = JERRY_MAX (jsp_mm_stats.peak_waste_size, jsp_mm_stats.waste_size);
+    jsp_mm_stats.global_peak_waste_size = JERRY_MAX (jsp_mm_stats.global_peak_waste_size, jsp_mm_stats.waste_size);
+  }
+
+  jsp_mm_stats.arena_size = (size_t) ((int32_t) jsp_mm_stats.arena_size + arena_delta);
+  jsp_mm_stats.allocated_size = (size_t) ((int32_t) jsp_mm_stats.allocated_size + allocated_delta);
+  jsp_mm_stats.chunks = (size_t) ((int32_t) jsp_mm_stats.chunks + chunks_delta);
+  jsp_mm_stats.separate_blocks = (size_t) ((int32_t) jsp_mm_stats.separate_blocks + separate_blocks_delta);
+
+  JERRY_ASSERT (jsp_mm_stats.allocated_size <= jsp_mm_stats.arena_size);
+  jsp_mm_stats.waste_size = jsp_mm_stats.arena_size - jsp_mm_stats.allocated_size;
+
+  jsp_mm_stats.peak_arena_size = JERRY_MAX (jsp_mm_stats.peak_arena_size, jsp_mm_stats.arena_size);
+  jsp_mm_stats.global_peak_arena_size = JERRY_MAX (jsp_mm_stats.global_peak_arena_size, jsp_mm_stats.arena_size);
+  jsp_mm_stats.peak_allocated_size = JERRY_MAX (jsp_mm_stats.peak_allocated_size, jsp_mm_stats.allocated_size);
+  jsp_mm_stats.global_peak_allocated_size = JERRY_MAX (jsp_mm_stats.global_peak_allocated_size,
+                                                       jsp_mm_stats.allocated_size);
+  jsp_mm_stats.peak_chunks = JERRY_MAX (jsp_mm_stats.peak_chunks, jsp_mm_stats.chunks);
+  jsp_mm_stats.peak_separate_blocks = JERRY_MAX (jsp_mm_stats.peak_separate_blocks, jsp_mm_stats.separate_blocks);
+} /* jsp_mm_stats_update */
+
+/**
+ * Get arena usage statistics
+ */
+void
+jsp_mm_get_stats (jsp_mm_stats_t *out_stats_p) /**< out: statistics */
+{
+  *out_stats_p = jsp_mm_stats;
+} /* jsp_mm_get_stats */
+
+/**
+ * Reset peak values in arena usage statistics
+ */
+void
+jsp_mm_stats_reset_peak (void)
+{
+  jsp_mm_stats.peak_arena_size = jsp_mm_stats.arena_size;
+  jsp_mm_stats.peak_allocated_size = jsp_mm_stats.allocated_size;
+  jsp_mm_stats.peak_waste_size = jsp_mm_stats.waste_size;
+  jsp_mm_stats.peak_chunks = jsp_mm_stats.chunks;
+  jsp_mm_stats.peak_separate_blocks = jsp_mm_stats.separate_blocks;
+} /* jsp_mm_stats_reset_peak */
+
+/**
+ * Print arena usage statistics
+ */
+void
+jsp_mm_stats_print (void)
+{
+  printf ("Parser arena stats:\n");
+  printf ("  Peak size: %zu\n"
+          "  Peak allocated bytes: %zu\n"
+          "  Peak waste bytes: %zu\n"
+          "  Peak chunks: %zu\n"
+          "  Peak separately allocated blocks: %zu\n"
+          "  Global peak size: %zu\n"
+          "  Global peak allocated bytes: %zu\n"
+          "  Global peak waste bytes: %zu\n\n",
+          jsp_mm_stats.peak_arena_size,
+          jsp_mm_stats.peak_allocated_size,
+          jsp_mm_stats.peak_waste_size,
+          jsp_mm_stats.peak_chunks,
+          jsp_mm_stats.peak_separate_blocks,
+          jsp_mm_stats.global_peak_arena_size,
+          jsp_mm_stats.global_peak_allocated_size,
+          jsp_mm_stats.global_peak_waste_size);
+} /* jsp_mm_stats_print */
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
@@ -25,6 +25,34 @@
  * @{
  */
 
+#ifdef MEM_STATS
+/**
+ * Parser's memory arena usage statistics
+ */
+typedef struct
+{
+  size_t arena_size; /**< bytes, currently taken from the heap (arena's chunks and separately allocated blocks) */
+  size_t peak_arena_size; /**< peak bytes, taken from the heap */
+  size_t global_peak_arena_size; /**< non-resettable peak bytes, taken from the heap */
+
+  size_t allocated_size; /**< bytes in currently allocated blocks, including headers */
+  size_t peak_allocated_size; /**< peak bytes in allocated blocks */
+  size_t global_peak_allocated_size; /**< non-resettable peak bytes in allocated blocks */
+
+  size_t waste_size; /**< bytes, taken from the heap, but not used by allocated blocks
+                      *   (free blocks of the arena and unused rest of chunks) */
+  size_t peak_waste_size; /**< peak waste bytes at moments, when a new chunk was required
+                           *   (i.e. free space of the arena, that could not be reused) */
+  size_t global_peak_waste_size; /**< non-resettable peak waste bytes at moments, when a new chunk was required */
+
+  size_t chunks; /**< current number of the arena's chunks */
+  size_t peak_chunks; /**< peak number of the arena's chunks */
+
+  size_t separate_blocks; /**< current number of blocks, allocated separately from the heap */
+  size_t peak_separate_blocks; /**< peak number of separately allocated blocks */
+} jsp_mm_stats_t;
+#endif /* MEM_STATS */
+
 extern void jsp_mm_init (void);
 extern void jsp_mm_finalize (void);
 extern size_t jsp_mm_recommend_size (size_t);
@@ -32,6 +60,12 @@ extern void *jsp_mm_alloc (size_t);
 extern void jsp_mm_free (void *);
 extern void jsp_mm_free_all (void);
 
+#ifdef MEM_STATS
+extern void jsp_mm_get_stats (jsp_mm_stats_t *);
+extern void jsp_mm_stats_reset_peak (void);
+extern void jsp_mm_stats_print (void);
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
@@ -40,6 +40,20 @@ static bool is_token_parse_in_progress = false;
 
 static lit_utf8_iterator_t src_iter;
 
+/*
+ * State of source reading in stream mode (see also: lexer_init_stream)
+ *
+ * In the mode, buffer_size is the size of the source's part, that was already read
+ * and ends on a character boundary.
+ */
+static jerry_source_read_callback_t stream_read_callback_p = NULL;
+static void *stream_read_callback_data_p = NULL;
+static jerry_api_char_t *stream_buffer_p = NULL;
+static size_t stream_buffer_capacity = 0;
+static size_t stream_read_size = 0;
+static size_t stream_line_end_offset = 0;
+static bool is_stream_finished = true;
+
 #define LA(I)       (get_char (I))
 #define TOK_START() (src_iter.buf_p + token_start_pos.offset)
 #define TOK_SIZE() ((lit_utf8_size_t) (src_iter.buf_pos.offset - token_start_pos.offset))
@@ -540,77 +554,86 @@ static token
 lexer_parse_reserved_word (const lit_utf8_byte_t *str_p, /**< characters buffer */
                            lit_utf8_size_t str_size) /**< string's length */
 {
-  typedef struct
-  {
-    const char *keyword_p;
-    keyword keyword_id;
-  } kw_descr_t;
-
-  const kw_descr_t keywords[] =
-  {
-#define KW_DESCR(literal, keyword_id) { literal, keyword_id }
-    KW_DESCR ("break", KW_BREAK),
-    KW_DESCR ("case", KW_CASE),
-    KW_DESCR ("catch", KW_CATCH),
-    KW_DESCR ("class", KW_CLASS),
-    KW_DESCR ("const", KW_CONST),
-    KW_DESCR ("continue", KW_CONTINUE),
-    KW_DESCR ("debugger", KW_DEBUGGER),
-    KW_DESCR ("default", KW_DEFAULT),
-    KW_DESCR ("delete", KW_DELETE),
-    KW_DESCR ("do", KW_DO),
-    KW_DESCR ("else", KW_ELSE),
-    KW_DESCR ("enum", KW_ENUM),
-    KW_DESCR ("export", KW_EXPORT),
-    KW_DESCR ("extends", KW_EXTENDS),
-    KW_DESCR ("finally", KW_FINALLY),
-    KW_DESCR ("for", KW_FOR),
-    KW_DESCR ("function", KW_FUNCTION),
-    KW_DESCR ("if", KW_IF),
-    KW_DESCR ("in", KW_IN),
-    KW_DESCR ("instanceof", KW_INSTANCEOF),
-    KW_DESCR ("interface", KW_INTERFACE),
-    KW_DESCR ("import", KW_IMPORT),
-    KW_DESCR ("implements", KW_IMPLEMENTS),
-    KW_DESCR ("let", KW_LET),
-    KW_DESCR ("new", KW_NEW),
-    KW_DESCR ("package", KW_PACKAGE),
-    KW_DESCR ("private", KW_PRIVATE),
-    KW_DESCR ("protected", KW_PROTECTED),
-    KW_DESCR ("public", KW_PUBLIC),
-    KW_DESCR ("return", KW_RETURN),
-    KW_DESCR ("static", KW_STATIC),
-    KW_DESCR ("super", KW_SUPER),
-    KW_DESCR ("switch", KW_SWITCH),
-    KW_DESCR ("this", KW_THIS),
-    KW_DESCR ("throw", KW_THROW),
-    KW_DESCR ("try", KW_TRY),
-    KW_DESCR ("typeof", KW_TYPEOF),
-    KW_DESCR ("var", KW_VAR),
-    KW_DESCR ("void", KW_VOID),
-    KW_DESCR ("while", KW_WHILE),
-    KW_DESCR ("with", KW_WITH),
-    KW_DESCR ("yield", KW_YIELD)
-#undef KW_DESCR
-  };
-
-  keyword kw = KW_NONE;
-
-  for (uint32_t i = 0; i < sizeof (keywords) / sizeof (kw_descr_t); i++)
-  {
-    if (lit_compare_utf8_strings (str_p,
-                                  str_size,
-                                  (lit_utf8_byte_t *) keywords[i].keyword_p,
-                                  (lit_utf8_size_t) strlen (keywords[i].keyword_p)))
-    {
-      kw = keywords[i].keyword_id;
-      break;
+  const char *reserved_word_p = NULL;
+  token_type type = TOK_EMPTY;
+  uint16_t uid = 0;
+
+  /* the only reserved word that can be equal to the string is selected by classification hash */
+  switch (lit_utf8_string_classify_hash (str_p, str_size))
+  {
+#define RW_DESCR(literal, token_type, token_uid) \
+    case LIT_CLASSIFY_HASH_CONST (literal): \
+    { \
+      reserved_word_p = literal; \
+      type = token_type; \
+      uid = token_uid; \
+      break; \
+    }
+    RW_DESCR ("break", TOK_KEYWORD, KW_BREAK)
+    RW_DESCR ("case", TOK_KEYWORD, KW_CASE)
+    RW_DESCR ("catch", TOK_KEYWORD, KW_CATCH)
+    RW_DESCR ("class", TOK_KEYWORD, KW_CLASS)
+    RW_DESCR ("const", TOK_KEYWORD, KW_CONST)
+    RW_DESCR ("continue", TOK_KEYWORD, KW_CONTINUE)
+    RW_DESCR ("debugger", TOK_KEYWORD, KW_DEBUGGER)
+    RW_DESCR ("default", TOK_KEYWORD, KW_DEFAULT)
+    RW_DESCR ("delete", TOK_KEYWORD, KW_DELETE)
+    RW_DESCR ("do", TOK_KEYWORD, KW_DO)
+    RW_DESCR ("else", TOK_KEYWORD, KW_ELSE)
+    RW_DESCR ("enum", TOK_KEYWORD, KW_ENUM)
+    RW_DESCR ("export", TOK_KEYWORD, KW_EXPORT)
+    RW_DESCR ("extends", TOK_KEYWORD, KW_EXTENDS)
+    RW_DESCR ("finally", TOK_KEYWORD, KW_FINALLY)
+    RW_DESCR ("for", TOK_KEYWORD, KW_FOR)
+    RW_DESCR ("function", TOK_KEYWORD, KW_FUNCTION)
+    RW_DESCR ("if", TOK_KEYWORD, KW_IF)
+    RW_DESCR ("in", TOK_KEYWORD, KW_IN)
+    RW_DESCR ("instanceof", TOK_KEYWORD, KW_INSTANCEOF)
+    RW_DESCR ("interface", TOK_KEYWORD, KW_INTERFACE)
+    RW_DESCR ("import", TOK_KEYWORD, KW_IMPORT)
+    RW_DESCR ("implements", TOK_KEYWORD, KW_IMPLEMENTS)
+    RW_DESCR ("let", TOK_KEYWORD, KW_LET)
+    RW_DESCR ("new", TOK_KEYWORD, KW_NEW)
+    RW_DESCR ("package", TOK_KEYWORD, KW_PACKAGE)
+    RW_DESCR ("private", TOK_KEYWORD, KW_PRIVATE)
+    RW_DESCR ("protected", TOK_KEYWORD, KW_PROTECTED)
+    RW_DESCR ("public", TOK_KEYWORD, KW_PUBLIC)
+    RW_DESCR ("return", TOK_KEYWORD, KW_RETURN)
+    RW_DESCR ("static", TOK_KEYWORD, KW_STATIC)
+    RW_DESCR ("super", TOK_KEYWORD, KW_SUPER)
+    RW_DESCR ("switch", TOK_KEYWORD, KW_SWITCH)
+    RW_DESCR ("this", TOK_KEYWORD, KW_THIS)
+    RW_DESCR ("throw", TOK_KEYWORD, KW_THROW)
+    RW_DESCR ("try", TOK_KEYWORD, KW_TRY)
+    RW_DESCR ("typeof", TOK_KEYWORD, KW_TYPEOF)
+    RW_DESCR ("var", TOK_KEYWORD, KW_VAR)
+    RW_DESCR ("void", TOK_KEYWORD, KW_VOID)
+    RW_DESCR ("while", TOK_KEYWORD, KW_WHILE)
+    RW_DESCR ("with", TOK_KEYWORD, KW_WITH)
+    RW_DESCR ("yield", TOK_KEYWORD, KW_YIELD)
+    RW_DESCR ("false", TOK_BOOL, false)
+    RW_DESCR ("true", TOK_BOOL, true)
+    RW_DESCR ("null", TOK_NULL, 0)
+#undef RW_DESCR
+
+    default:
+    {
+      return empty_token;
     }
   }
 
-  if (!strict_mode)
+  if (!lit_compare_utf8_strings (str_p,
+                                 str_size,
+                                 (const lit_utf8_byte_t *) reserved_word_p,
+                                 (lit_utf8_size_t) strlen (reserved_word_p)))
   {
-    switch (kw)
+    return empty_token;
+  }
+
+  if (type == TOK_KEYWORD
+      && !strict_mode)
+  {
+    switch ((keyword) uid)
     {
       case KW_INTERFACE:
       case KW_IMPLEMENTS:
@@ -632,46 +655,145 @@ lexer_parse_reserved_word (const lit_utf8_byte_t *str_p, /**< characters buffer
     }
   }
 
-  if (kw != KW_NONE)
+  return create_token (type, uid);
+} /* lexer_parse_reserved_word */
+
+static token
+convert_seen_num_to_token (ecma_number_t num)
+{
+  literal_t lit = lit_find_literal_by_num (num);
+  if (lit != NULL)
+  {
+    return create_token_from_lit (TOK_NUMBER, lit);
+  }
+
+  return create_token_from_lit (TOK_NUMBER, lit_create_literal_from_num (num));
+}
+
+/**
+ * Read next chunk of source in stream mode, extending the available part of the source
+ */
+static void
+lexer_stream_read_chunk (void)
+{
+  JERRY_ASSERT (!is_stream_finished);
+
+  if (stream_read_size == stream_buffer_capacity)
+  {
+    PARSE_ERROR (JSP_EARLY_ERROR_SYNTAX, "Source is larger than the source buffer", current_locus ());
+  }
+
+  size_t chunk_size = stream_read_callback_p (stream_buffer_p + stream_read_size,
+                                              stream_buffer_capacity - stream_read_size,
+                                              stream_read_callback_data_p);
+  JERRY_ASSERT (chunk_size <= stream_buffer_capacity - stream_read_size);
+
+  stream_read_size += chunk_size;
+
+  size_t available_size = stream_read_size;
+
+  if (chunk_size == 0)
   {
-    return create_token (TOK_KEYWORD, kw);
+    is_stream_finished = true;
   }
   else
   {
-    if (lit_compare_utf8_string_and_magic_string (str_p, str_size, LIT_MAGIC_STRING_FALSE))
-    {
-      return create_token (TOK_BOOL, false);
-    }
-    else if (lit_compare_utf8_string_and_magic_string (str_p, str_size, LIT_MAGIC_STRING_TRUE))
+    /* exclude incomplete trailing character, the rest of which is in the next chunk */
+    size_t char_start = available_size;
+    while (char_start > buffer_size
+           && (stream_buffer_p[char_start - 1] & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER)
     {
-      return create_token (TOK_BOOL, true);
+      char_start--;
     }
-    else if (lit_compare_utf8_string_and_magic_string (str_p, str_size, LIT_MAGIC_STRING_NULL))
-    {
-      return create_token (TOK_NULL, 0);
-    }
-    else
+
+    if (char_start > buffer_size)
     {
-      return empty_token;
+      const lit_utf8_byte_t lead_byte = stream_buffer_p[char_start - 1];
+      size_t char_size;
+
+      if ((lead_byte & LIT_UTF8_1_BYTE_MASK) == LIT_UTF8_1_BYTE_MARKER)
+      {
+        char_size = 1;
+      }
+      else if ((lead_byte & LIT_UTF8_2_BYTE_MASK) == LIT_UTF8_2_BYTE_MARKER)
+      {
+        char_size = 2;
+      }
+      else if ((lead_byte & LIT_UTF8_3_BYTE_MASK) == LIT_UTF8_3_BYTE_MARKER)
+      {
+        char_size = 3;
+      }
+      else
+      {
+        char_size = 4;
+      }
+
+      if (char_start - 1 + char_size > available_size)
+      {
+        available_size = char_start - 1;
+      }
     }
   }
-} /* lexer_parse_reserved_word */
 
-static token
-convert_seen_num_to_token (ecma_number_t num)
+  if (!lit_is_utf8_string_valid (stream_buffer_p + buffer_size, (lit_utf8_size_t) (available_size - buffer_size)))
+  {
+    PARSE_ERROR (JSP_EARLY_ERROR_SYNTAX, "Invalid source encoding", current_locus ());
+  }
+
+  buffer_size = available_size;
+  src_iter.buf_size = (lit_utf8_size_t) available_size;
+} /* lexer_stream_read_chunk */
+
+/**
+ * In stream mode, read the source, until the available part of the source contains
+ * a line terminator after current position, or the whole source is read
+ *
+ * Note:
+ *      tokens, except for multiline comments and strings with line continuations, don't span
+ *      several lines, so the line-by-line reading guarantees that current token is available
+ *      completely (the two kinds of tokens are read through consume_char, which also checks
+ *      the condition upon each character)
+ */
+static void
+lexer_stream_ensure_current_line (void)
 {
-  literal_t lit = lit_find_literal_by_num (num);
-  if (lit != NULL)
+  size_t pos = src_iter.buf_pos.offset;
+
+  if (is_stream_finished
+      || (pos <= stream_line_end_offset && stream_line_end_offset < buffer_size))
   {
-    return create_token_from_lit (TOK_NUMBER, lit);
+    return;
   }
 
-  return create_token_from_lit (TOK_NUMBER, lit_create_literal_from_num (num));
-}
+  size_t search_pos = pos;
+
+  while (true)
+  {
+    for (; search_pos < buffer_size; search_pos++)
+    {
+      if (stream_buffer_p[search_pos] == LIT_CHAR_LF
+          || stream_buffer_p[search_pos] == LIT_CHAR_CR)
+      {
+        stream_line_end_offset = search_pos;
+
+        return;
+      }
+    }
+
+    if (is_stream_finished)
+    {
+      return;
+    }
+
+    lexer_stream_read_chunk ();
+  }
+} /* lexer_stream_ensure_current_line */
 
 static void
 new_token (void)
 {
+  lexer_stream_ensure_current_line ();
+
   token_start_pos = lit_utf8_iterator_get_pos (&src_iter);
   JERRY_ASSERT (!token_start_pos.is_non_bmp_middle);
   is_token_parse_in_progress = true;
@@ -684,8 +806,174 @@ consume_char (void)
   {
     lit_utf8_iterator_incr (&src_iter);
   }
+
+  lexer_stream_ensure_current_line ();
 }
 
+/**
+ * Classes of ASCII characters, that can be skipped by lexer_skip_ascii_chars
+ */
+typedef enum
+{
+  LEXER_ASCII_CLASS_IDENTIFIER_PART = (1u << 0), /**< IdentifierPart characters, except for backslash */
+  LEXER_ASCII_CLASS_WHITE_SPACE = (1u << 1), /**< WhiteSpace characters */
+  LEXER_ASCII_CLASS_COMMENT_PLAIN = (1u << 2), /**< characters of a comment body, except for line terminators,
+                                                *   asterisk and zero character */
+  LEXER_ASCII_CLASS_STRING_PLAIN = (1u << 3) /**< characters of a string literal, except for line terminators,
+                                              *   quotes, backslash and zero character */
+} lexer_ascii_class_t;
+
+/**
+ * Get set of classes of an ASCII character
+ *
+ * @return combination of lexer_ascii_class_t flags
+ */
+static constexpr uint8_t
+lexer_get_ascii_char_classes (uint8_t c) /**< ASCII character */
+{
+  return (uint8_t) ((((c >= LIT_CHAR_ASCII_LOWERCASE_LETTERS_BEGIN && c <= LIT_CHAR_ASCII_LOWERCASE_LETTERS_END)
+                      || (c >= LIT_CHAR_ASCII_UPPERCASE_LETTERS_BEGIN && c <= LIT_CHAR_ASCII_UPPERCASE_LETTERS_END)
+                      || (c >= LIT_CHAR_ASCII_DIGITS_BEGIN && c <= LIT_CHAR_ASCII_DIGITS_END)
+                      || c == LIT_CHAR_DOLLAR_SIGN
+                      || c == LIT_CHAR_UNDERSCORE) ? LEXER_ASCII_CLASS_IDENTIFIER_PART : 0)
+                    | ((c == LIT_CHAR_SP
+                        || c == LIT_CHAR_TAB
+                        || c == LIT_CHAR_VTAB
+                        || c == LIT_CHAR_FF) ? LEXER_ASCII_CLASS_WHITE_SPACE : 0)
+                    | ((c != LIT_CHAR_NULL
+                        && c != LIT_CHAR_LF
+                        && c != LIT_CHAR_CR
+                        && c != LIT_CHAR_ASTERISK) ? LEXER_ASCII_CLASS_COMMENT_PLAIN : 0)
+                    | ((c != LIT_CHAR_NULL
+                        && c != LIT_CHAR_LF
+                        && c != LIT_CHAR_CR
+                        && c != LIT_CHAR_SINGLE_QUOTE
+                        && c != LIT_CHAR_DOUBLE_QUOTE
+                        && c != LIT_CHAR_BACKSLASH) ? LEXER_ASCII_CLASS_STRING_PLAIN : 0));
+} /* lexer_get_ascii_char_classes */
+
+#define LEXER_ASCII_CLASSES_ROW(c) \
+  lexer_get_ascii_char_classes ((c) + 0), lexer_get_ascii_char_classes ((c) + 1), \
+  lexer_get_ascii_char_classes ((c) + 2), lexer_get_ascii_char_classes ((c) + 3), \
+  lexer_get_ascii_char_classes ((c) + 4), lexer_get_ascii_char_classes ((c) + 5), \
+  lexer_get_ascii_char_classes ((c) + 6), lexer_get_ascii_char_classes ((c) + 7)
+
+/**
+ * Classes of ASCII characters, indexed by character code (computed at build time)
+ */
+static const uint8_t lexer_ascii_char_classes[LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1] =
+{
+  LEXER_ASCII_CLASSES_ROW (0x00), LEXER_ASCII_CLASSES_ROW (0x08), LEXER_ASCII_CLASSES_ROW (0x10),
+  LEXER_ASCII_CLASSES_ROW (0x18), LEXER_ASCII_CLASSES_ROW (0x20), LEXER_ASCII_CLASSES_ROW (0x28),
+  LEXER_ASCII_CLASSES_ROW (0x30), LEXER_ASCII_CLASSES_ROW (0x38), LEXER_ASCII_CLASSES_ROW (0x40),
+  LEXER_ASCII_CLASSES_ROW (0x48), LEXER_ASCII_CLASSES_ROW (0x50), LEXER_ASCII_CLASSES_ROW (0x58),
+  LEXER_ASCII_CLASSES_ROW (0x60), LEXER_ASCII_CLASSES_ROW (0x68), LEXER_ASCII_CLASSES_ROW (0x70),
+  LEXER_ASCII_CLASSES_ROW (0x78)
+};
+
+#undef LEXER_ASCII_CLASSES_ROW
+
+/**
+ * Word, with each byte equal to 0x01 (for checking 8 characters at a time)
+ */
+#define LEXER_WORD_ONES (0x0101010101010101ull)
+
+/**
+ * Word, with each byte equal to 0x80 (for checking 8 characters at a time)
+ */
+#define LEXER_WORD_HIGH_BITS (0x8080808080808080ull)
+
+/**
+ * Check whether any of the word's bytes is equal to the specified byte
+ *
+ * @return true / false
+ */
+static bool __attr_always_inline___
+lexer_word_has_byte (uint64_t word, /**< 8 characters */
+                     uint8_t byte) /**< byte to search for */
+{
+  const uint64_t diff = word ^ (LEXER_WORD_ONES * byte);
+
+  return ((diff - LEXER_WORD_ONES) & ~diff & LEXER_WORD_HIGH_BITS) != 0;
+} /* lexer_word_has_byte */
+
+/**
+ * Skip a run of ASCII characters of the specified class, starting from current position of the source
+ *
+ * The run is scanned directly in the source buffer (8 characters at a time for comment bodies
+ * and string literals), stopping at first character of other class or at first non-ASCII character,
+ * which is then processed through the source iterator.
+ *
+ * Note:
+ *      none of the classes contains line terminators, so the run doesn't leave current line,
+ *      that, in stream mode, is guaranteed to be read completely
+ *
+ * @return pointer to the first character after the run
+ */
+static const lit_utf8_byte_t *
+lexer_skip_ascii_chars (lexer_ascii_class_t char_class) /**< class of characters to skip */
+{
+  const lit_utf8_byte_t *buf_p = src_iter.buf_p;
+  lit_utf8_size_t pos = src_iter.buf_pos.offset;
+
+  if (src_iter.buf_pos.is_non_bmp_middle)
+  {
+    return buf_p + pos;
+  }
+
+  const lit_utf8_size_t end_pos = src_iter.buf_size;
+
+  if (char_class == LEXER_ASCII_CLASS_COMMENT_PLAIN
+      || char_class == LEXER_ASCII_CLASS_STRING_PLAIN)
+  {
+    while (end_pos - pos >= sizeof (uint64_t))
+    {
+      uint64_t word;
+      memcpy (&word, buf_p + pos, sizeof (uint64_t));
+
+      if ((word & LEXER_WORD_HIGH_BITS) != 0
+          || lexer_word_has_byte (word, LIT_CHAR_NULL)
+          || lexer_word_has_byte (word, LIT_CHAR_LF)
+          || lexer_word_has_byte (word, LIT_CHAR_CR))
+      {
+        break;
+      }
+
+      if (char_class == LEXER_ASCII_CLASS_COMMENT_PLAIN)
+      {
+        if (lexer_word_has_byte (word, LIT_CHAR_ASTERISK))
+        {
+          break;
+        }
+      }
+      else if (lexer_word_has_byte (word, LIT_CHAR_SINGLE_QUOTE)
+               || lexer_word_has_byte (word, LIT_CHAR_DOUBLE_QUOTE)
+               || lexer_word_has_byte (word, LIT_CHAR_BACKSLASH))
+      {
+        break;
+      }
+
+      pos += (lit_utf8_size_t) sizeof (uint64_t);
+    }
+  }
+
+  while (pos < end_pos
+         && buf_p[pos] <= LIT_UTF8_1_BYTE_CODE_POINT_MAX
+         && (lexer_ascii_char_classes[buf_p[pos]] & char_class) != 0)
+  {
+    pos++;
+  }
+
+  if (pos != src_iter.buf_pos.offset)
+  {
+    src_iter.buf_pos.offset = pos & ((1u << LIT_ITERATOR_OFFSET_WIDTH) - 1u);
+
+    lexer_stream_ensure_current_line ();
+  }
+
+  return buf_p + pos;
+} /* lexer_skip_ascii_chars */
+
 #define RETURN_PUNC_EX(TOK, NUM) \
   do \
   { \
@@ -755,6 +1043,21 @@ lexer_parse_identifier_or_keyword (void)
 
   while (true)
   {
+    /* fast path for ASCII characters, the iterator is used for non-ASCII characters and escape sequences */
+    const lit_utf8_byte_t *run_begin_p = src_iter.buf_p + src_iter.buf_pos.offset;
+    const lit_utf8_byte_t *run_end_p = lexer_skip_ascii_chars (LEXER_ASCII_CLASS_IDENTIFIER_PART);
+
+    for (const lit_utf8_byte_t *char_p = run_begin_p;
+         is_all_chars_were_lowercase_ascii && char_p < run_end_p;
+         char_p++)
+    {
+      if (!(*char_p >= LIT_CHAR_ASCII_LOWERCASE_LETTERS_BEGIN
+            && *char_p <= LIT_CHAR_ASCII_LOWERCASE_LETTERS_END))
+      {
+        is_all_chars_were_lowercase_ascii = false;
+      }
+    }
+
     c = LA (0);
 
     if (c == LIT_CHAR_BACKSLASH)
@@ -1075,6 +1378,8 @@ lexer_parse_string (void)
 
   do
   {
+    lexer_skip_ascii_chars (LEXER_ASCII_CLASS_STRING_PLAIN);
+
     c = LA (0);
     consume_char ();
 
@@ -1224,8 +1529,15 @@ lexer_parse_comment (void)
   consume_char ();
   consume_char ();
 
-  while (!lit_utf8_iterator_is_eos (&src_iter))
+  while (true)
   {
+    lexer_skip_ascii_chars (LEXER_ASCII_CLASS_COMMENT_PLAIN);
+
+    if (lit_utf8_iterator_is_eos (&src_iter))
+    {
+      break;
+    }
+
     c = LA (0);
 
     if (!multiline)
@@ -1279,6 +1591,8 @@ lexer_parse_comment (void)
 static token
 lexer_parse_token (bool maybe_regexp) /**< read '/' as regexp? */
 {
+  lexer_skip_ascii_chars (LEXER_ASCII_CLASS_WHITE_SPACE);
+
   ecma_char_t c = LA (0);
 
   if (lit_char_is_white_space (c))
@@ -1587,6 +1901,20 @@ lexer_seek (lit_utf8_iterator_pos_t locus)
   prev_non_lf_token = empty_token;
 }
 
+/**
+ * Get pointer to the source buffer's character, corresponding to the locus
+ *
+ * @return pointer to the character in the source buffer
+ */
+const lit_utf8_byte_t *
+lexer_locus_to_source_ptr (lit_utf8_iterator_pos_t locus) /**< iterator position in the source script */
+{
+  JERRY_ASSERT (!locus.is_non_bmp_middle);
+  JERRY_ASSERT ((lit_utf8_size_t) locus.offset <= buffer_size);
+
+  return (const lit_utf8_byte_t *) buffer_start + locus.offset;
+} /* lexer_locus_to_source_ptr */
+
 /**
  * Convert locus to line and column
  */
@@ -1901,6 +2229,11 @@ lexer_init (const jerry_api_char_t *source, /**< script source */
   buffer_start = source;
   is_token_parse_in_progress = false;
 
+  stream_read_callback_p = NULL;
+  stream_read_callback_data_p = NULL;
+  stream_buffer_p = NULL;
+  is_stream_finished = true;
+
   lexer_set_strict_mode (false);
 
 #ifndef JERRY_NDEBUG
@@ -1910,3 +2243,31 @@ lexer_init (const jerry_api_char_t *source, /**< script source */
   allow_dump_lines = false;
 #endif /* JERRY_NDEBUG */
 } /* lexer_init */
+
+/**
+ * Initialize lexer to start parsing of a new source, that is read by chunks during parse
+ *
+ * Note:
+ *      the source is read to the specified buffer, and the buffer's contents should be kept
+ *      until the parse finishes, as the parser can return to previously scanned parts of the source
+ */
+void
+lexer_init_stream (jerry_source_read_callback_t read_callback_p, /**< callback for reading source chunks */
+                   void *read_callback_data_p, /**< data for the callback */
+                   jerry_api_char_t *buffer_p, /**< buffer to read the source to */
+                   size_t buffer_capacity, /**< size of the buffer */
+                   bool is_print_source_code) /**< flag indicating whether to dump
+                                               *   processed source code */
+{
+  lexer_init (buffer_p, 0, is_print_source_code);
+
+  stream_read_callback_p = read_callback_p;
+  stream_read_callback_data_p = read_callback_data_p;
+  stream_buffer_p = buffer_p;
+  stream_buffer_capacity = buffer_capacity;
+  stream_read_size = 0;
+  stream_line_end_offset = 0;
+  is_stream_finished = false;
+
+  lexer_stream_ensure_current_line ();
+} /* lexer_init_stream */
@@ -170,6 +170,7 @@ typedef struct
 #define TOKEN_EMPTY_INITIALIZER {LIT_ITERATOR_POS_ZERO, TOK_EMPTY, 0}
 
 void lexer_init (const jerry_api_char_t *, size_t, bool);
+void lexer_init_stream (jerry_source_read_callback_t, void *, jerry_api_char_t *, size_t, bool);
 
 token lexer_next_token (bool);
 void lexer_save_token (token);
@@ -177,6 +178,7 @@ token lexer_prev_token (void);
 
 void lexer_seek (locus);
 void lexer_locus_to_line_and_column (locus, size_t *, size_t *);
+const lit_utf8_byte_t *lexer_locus_to_source_ptr (locus);
 void lexer_dump_line (size_t);
 const char *lexer_keyword_to_string (keyword);
 const char *lexer_token_type_to_string (token_type);
@@ -18,6 +18,7 @@
 #include "serializer.h"
 #include "stack.h"
 #include "jsp-early-error.h"
+#include "jsp-mm.h"
 
 /**
  * Register allocator's counter
@@ -144,6 +145,30 @@ enum
 };
 STATIC_STACK (jsp_reg_id_stack, vm_idx_t)
 
+/**
+ * Maximum number of source text ranges, referenced by lazy functions' 'meta' instructions of a byte-code,
+ * as index of a range is stored in two arguments of an instruction
+ */
+#define JSP_SOURCE_RANGES_MAX_COUNT (1u << (2 * JERRY_BITSINBYTE))
+
+/**
+ * Source text ranges, referenced by lazy functions' 'meta' instructions of the byte-code being dumped
+ *
+ * See also:
+ *          dump_lazy_function_for_rewrite, dump_lazy_function_nested_body
+ */
+static bytecode_source_range_t *jsp_source_ranges_p;
+
+/**
+ * Number of ranges in jsp_source_ranges_p array
+ */
+static uint32_t jsp_source_ranges_count;
+
+/**
+ * Capacity of jsp_source_ranges_p array
+ */
+static uint32_t jsp_source_ranges_capacity;
+
 /**
  * Allocate next register for intermediate value
  *
@@ -2439,6 +2464,141 @@ rewrite_scope_code_flags (vm_instr_counter_t scope_code_flags_oc, /**< position
   serializer_rewrite_op_meta (scope_code_flags_oc, opm);
 } /* rewrite_scope_code_flags */
 
+/**
+ * Add range of source text to the table of source ranges of the byte-code being dumped
+ *
+ * @return index of the range in the table
+ */
+static vm_instr_counter_t
+jsp_dmp_add_source_range (lit_utf8_size_t start_offset, /**< offset of the range's first character */
+                          lit_utf8_size_t end_offset) /**< offset of the character, following the range */
+{
+  JERRY_ASSERT (jsp_source_ranges_count < JSP_SOURCE_RANGES_MAX_COUNT);
+
+  if (jsp_source_ranges_count == jsp_source_ranges_capacity)
+  {
+    size_t new_capacity = JERRY_MAX (jsp_source_ranges_capacity * 2u, 1u);
+    new_capacity = jsp_mm_recommend_size (new_capacity * sizeof (bytecode_source_range_t))
+                   / sizeof (bytecode_source_range_t);
+    new_capacity = JERRY_MIN (new_capacity, JSP_SOURCE_RANGES_MAX_COUNT);
+
+    bytecode_source_range_t *new_ranges_p;
+    new_ranges_p = (bytecode_source_range_t *) jsp_mm_alloc (new_capacity * sizeof (bytecode_source_range_t));
+
+    if (jsp_source_ranges_p != NULL)
+    {
+      memcpy (new_ranges_p, jsp_source_ranges_p, jsp_source_ranges_count * sizeof (bytecode_source_range_t));
+      jsp_mm_free (jsp_source_ranges_p);
+    }
+
+    jsp_source_ranges_p = new_ranges_p;
+    jsp_source_ranges_capacity = (uint32_t) new_capacity;
+  }
+
+  jsp_source_ranges_p[jsp_source_ranges_count].start_offset = start_offset;
+  jsp_source_ranges_p[jsp_source_ranges_count].end_offset = end_offset;
+
+  return (vm_instr_counter_t) jsp_source_ranges_count++;
+} /* jsp_dmp_add_source_range */
+
+/**
+ * Get table of source ranges of the byte-code being dumped
+ *
+ * @return pointer to the table's first range (NULL - if the table is empty)
+ */
+const bytecode_source_range_t *
+dumper_get_source_ranges (uint32_t *out_ranges_count_p) /**< out: number of ranges in the table */
+{
+  *out_ranges_count_p = jsp_source_ranges_count;
+
+  return jsp_source_ranges_p;
+} /* dumper_get_source_ranges */
+
+/**
+ * Check whether one more lazy function can be dumped (see also: dump_lazy_function_for_rewrite)
+ *
+ * @return true - if table of source ranges of the byte-code being dumped is not full,
+ *         false - otherwise
+ */
+bool
+dumper_can_dump_lazy_function (void)
+{
+  return (jsp_source_ranges_count < JSP_SOURCE_RANGES_MAX_COUNT);
+} /* dumper_can_dump_lazy_function */
+
+/**
+ * Dump template of 'meta' instruction for range of source text of a function literal,
+ * which code is not compiled yet (see also: parser_parse_lazy_function).
+ *
+ * Note:
+ *      the range is added to the byte-code's table of source ranges, and is written later
+ *      (see also: rewrite_lazy_function).
+ *
+ * @return position of dumped instruction
+ */
+vm_instr_counter_t
+dump_lazy_function_for_rewrite (void)
+{
+  vm_instr_counter_t oc = serializer_get_current_instr_counter ();
+
+  vm_idx_t id1, id2;
+  split_instr_counter (jsp_dmp_add_source_range (0, 0), &id1, &id2);
+
+  dump_triple_address (VM_OP_META,
+                       jsp_operand_t::make_idx_const_operand (OPCODE_META_TYPE_LAZY_FUNCTION),
+                       jsp_operand_t::make_idx_const_operand (id1),
+                       jsp_operand_t::make_idx_const_operand (id2));
+
+  return oc;
+} /* dump_lazy_function_for_rewrite */
+
+/**
+ * Write range of a lazy function's source text, referenced by specified 'meta' instruction,
+ * dumped earlier (see also: dump_lazy_function_for_rewrite).
+ */
+void
+rewrite_lazy_function (vm_instr_counter_t lazy_function_oc, /**< position of the 'meta' instruction */
+                       lit_utf8_size_t start_offset, /**< offset of the function literal */
+                       lit_utf8_size_t end_offset) /**< offset of the function literal's end */
+{
+  op_meta opm = serializer_get_op_meta (lazy_function_oc);
+  JERRY_ASSERT (opm.op.op_idx == VM_OP_META);
+  JERRY_ASSERT (opm.op.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION);
+
+  vm_instr_counter_t range_idx = vm_calc_instr_counter_from_idx_idx (opm.op.data.meta.data_1,
+                                                                     opm.op.data.meta.data_2);
+  JERRY_ASSERT (range_idx < jsp_source_ranges_count);
+
+  jsp_source_ranges_p[range_idx].start_offset = start_offset;
+  jsp_source_ranges_p[range_idx].end_offset = end_offset;
+} /* rewrite_lazy_function */
+
+/**
+ * Dump 'meta' instruction for range of body of a function literal, nested into a lazy function
+ * (see also: parser_parse_lazy_function).
+ *
+ * Note:
+ *      the instruction is not dumped, if table of source ranges of the byte-code is full,
+ *      so the body would be parsed again upon compilation of the lazy function's code
+ */
+void
+dump_lazy_function_nested_body (lit_utf8_size_t start_offset, /**< offset of the body's opening brace */
+                                lit_utf8_size_t end_offset) /**< offset of the body's end */
+{
+  if (!dumper_can_dump_lazy_function ())
+  {
+    return;
+  }
+
+  vm_idx_t id1, id2;
+  split_instr_counter (jsp_dmp_add_source_range (start_offset, end_offset), &id1, &id2);
+
+  dump_triple_address (VM_OP_META,
+                       jsp_operand_t::make_idx_const_operand (OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY),
+                       jsp_operand_t::make_idx_const_operand (id1),
+                       jsp_operand_t::make_idx_const_operand (id2));
+} /* dump_lazy_function_nested_body */
+
 void
 dump_ret (void)
 {
@@ -2537,6 +2697,10 @@ dumper_init (void)
   STACK_INIT (finallies);
   STACK_INIT (tries);
   STACK_INIT (jsp_reg_id_stack);
+
+  jsp_source_ranges_p = NULL;
+  jsp_source_ranges_count = 0;
+  jsp_source_ranges_capacity = 0;
 }
 
 void
@@ -2556,4 +2720,10 @@ dumper_free (void)
   STACK_FREE (finallies);
   STACK_FREE (tries);
   STACK_FREE (jsp_reg_id_stack);
+
+  if (jsp_source_ranges_p != NULL)
+  {
+    jsp_mm_free (jsp_source_ranges_p);
+    jsp_source_ranges_p = NULL;
+  }
 }
@@ -482,6 +482,11 @@ void dump_variable_declaration (lit_cpointer_t);
 
 vm_instr_counter_t dump_scope_code_flags_for_rewrite (void);
 void rewrite_scope_code_flags (vm_instr_counter_t, opcode_scope_code_flags_t);
+bool dumper_can_dump_lazy_function (void);
+const bytecode_source_range_t *dumper_get_source_ranges (uint32_t *);
+vm_instr_counter_t dump_lazy_function_for_rewrite (void);
+void rewrite_lazy_function (vm_instr_counter_t, lit_utf8_size_t, lit_utf8_size_t);
+void dump_lazy_function_nested_body (lit_utf8_size_t, lit_utf8_size_t);
 
 vm_instr_counter_t dump_reg_var_decl_for_rewrite (void);
 void rewrite_reg_var_decl (vm_instr_counter_t);
@@ -50,6 +50,38 @@ static token tok;
 static bool inside_eval = false;
 static bool inside_function = false;
 static bool parser_show_instrs = false;
+static bool parser_lazy_functions = false;
+static bool inside_lazy_function_compilation = false;
+
+/**
+ * Source buffer, to which ranges of lazy functions' source text are relative
+ * (NULL - if bodies of functions can't be skipped in the source, that is being parsed,
+ *  as the source's buffer is not kept after parse)
+ */
+static const lit_utf8_byte_t *lazy_source_p = NULL;
+
+/**
+ * Offset of the lexer's buffer in the lazy_source_p buffer
+ */
+static lit_utf8_size_t lazy_source_offset = 0;
+
+/**
+ * Byte-code of the lazy function, which code is being compiled, with ranges of bodies of the nested functions
+ * (NULL - if no lazy function is being compiled)
+ */
+static const bytecode_data_header_t *lazy_nested_bodies_bytecode_p = NULL;
+
+/**
+ * Position of first range of nested function's body, which was not yet skipped,
+ * in the lazy_nested_bodies_bytecode_p byte-code
+ */
+static vm_instr_counter_t lazy_nested_bodies_pos = 0;
+
+/**
+ * Scope of the lazy function, which body is being pre-scanned
+ * (NULL - if no lazy function's body is being pre-scanned, see also: jsp_try_skip_lazy_function_body)
+ */
+static scopes_tree lazy_validated_function_scope = NULL;
 
 enum
 {
@@ -64,6 +96,7 @@ static jsp_operand_t parse_expression (bool, jsp_eval_ret_store_t);
 static void parse_statement (jsp_label_t *outermost_stmt_label_p);
 static jsp_operand_t parse_assignment_expression (bool);
 static void parse_source_element_list (bool, bool);
+static void check_directive_prologue_for_use_strict (void);
 static jsp_operand_t parse_argument_list (varg_list_type, jsp_operand_t, jsp_operand_t *);
 
 static bool
@@ -228,6 +261,245 @@ jsp_skip_braces (token_type brace_type) /**< type of the opening brace */
   current_token_must_be (closing_bracket_type);
 } /* jsp_skip_braces */
 
+/**
+ * Get range of source text, referenced by a lazy function's 'meta' instruction
+ * (see also: dump_lazy_function_for_rewrite, dump_lazy_function_nested_body)
+ */
+static void
+jsp_get_lazy_function_range (const bytecode_data_header_t *bytecode_header_p, /**< byte-code */
+                             vm_instr_counter_t instr_pos, /**< position of the 'meta' instruction */
+                             lit_utf8_size_t *out_start_offset_p, /**< out: start offset of the range
+                                                                   *        in the lazy_source_p buffer */
+                             lit_utf8_size_t *out_end_offset_p) /**< out: end offset of the range */
+{
+  vm_instr_t instr = vm_get_instr (bytecode_header_p->instrs_p, instr_pos);
+  JERRY_ASSERT (instr.op_idx == VM_OP_META);
+  JERRY_ASSERT (bytecode_header_p->source_ranges_p != NULL);
+
+  const bytecode_source_range_t *range_p = (bytecode_header_p->source_ranges_p
+                                            + vm_calc_instr_counter_from_idx_idx (instr.data.meta.data_1,
+                                                                                  instr.data.meta.data_2));
+
+  *out_start_offset_p = range_p->start_offset;
+  *out_end_offset_p = range_p->end_offset;
+} /* jsp_get_lazy_function_range */
+
+/**
+ * Check whether the specified instruction of lazy_nested_bodies_bytecode_p byte-code
+ * holds range of a nested function's body
+ *
+ * @return true / false
+ */
+static bool
+jsp_is_lazy_function_nested_body (vm_instr_counter_t instr_pos) /**< instruction position */
+{
+  if (instr_pos >= lazy_nested_bodies_bytecode_p->instrs_count)
+  {
+    return false;
+  }
+
+  vm_instr_t instr = vm_get_instr (lazy_nested_bodies_bytecode_p->instrs_p, instr_pos);
+
+  return (instr.op_idx == VM_OP_META
+          && instr.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY);
+} /* jsp_is_lazy_function_nested_body */
+
+/**
+ * Find a function's body among bodies, nested into the lazy function, which code is being compiled,
+ * and so already pre-scanned, and dump ranges of the bodies, nested into the found one
+ *
+ * @return true - if the body was found,
+ *         false - otherwise (the body should be pre-scanned).
+ */
+static bool
+jsp_find_lazy_function_nested_body (lit_utf8_size_t body_start_offset, /**< offset of the body's opening brace
+                                                                        *   in the lexer's buffer */
+                                    lit_utf8_size_t *out_body_end_offset_p) /**< out: offset of the body's end
+                                                                             *        in the lexer's buffer */
+{
+  if (lazy_nested_bodies_bytecode_p == NULL)
+  {
+    return false;
+  }
+
+  body_start_offset += lazy_source_offset;
+
+  for (vm_instr_counter_t instr_pos = lazy_nested_bodies_pos;
+       jsp_is_lazy_function_nested_body (instr_pos);
+       instr_pos++)
+  {
+    lit_utf8_size_t start_offset, end_offset;
+    jsp_get_lazy_function_range (lazy_nested_bodies_bytecode_p, instr_pos, &start_offset, &end_offset);
+
+    if (start_offset != body_start_offset)
+    {
+      continue;
+    }
+
+    /* the ranges are recorded upon end of pre-scan of each body, so bodies, nested into the found one, precede it */
+    for (vm_instr_counter_t nested_instr_pos = lazy_nested_bodies_pos;
+         nested_instr_pos < instr_pos;
+         nested_instr_pos++)
+    {
+      lit_utf8_size_t nested_start_offset, nested_end_offset;
+      jsp_get_lazy_function_range (lazy_nested_bodies_bytecode_p,
+                                   nested_instr_pos,
+                                   &nested_start_offset,
+                                   &nested_end_offset);
+
+      if (nested_start_offset > start_offset && nested_end_offset < end_offset)
+      {
+        dump_lazy_function_nested_body (nested_start_offset, nested_end_offset);
+      }
+    }
+
+    lazy_nested_bodies_pos = (vm_instr_counter_t) (instr_pos + 1u);
+
+    *out_body_end_offset_p = end_offset - lazy_source_offset;
+    return true;
+  }
+
+  return false;
+} /* jsp_find_lazy_function_nested_body */
+
+/**
+ * Parse body of a lazy function, checking it for early errors
+ *
+ * Note:
+ *      The body's code is dumped to the scope, that is current upon call of the routine, and is not used
+ *      after the check. Opening brace of the body should be set as current token when the routine is called,
+ *      and upon return the body's closing brace is the current token.
+ */
+static void
+jsp_parse_lazy_function_body_for_validation (void)
+{
+  current_token_must_be (TOK_OPEN_BRACE);
+
+  jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
+
+  inside_function = true;
+
+  skip_newlines ();
+  parse_source_element_list (false, false);
+  next_token_must_be (TOK_CLOSE_BRACE);
+
+  jsp_label_restore_set (masked_label_set_p);
+} /* jsp_parse_lazy_function_body_for_validation */
+
+/**
+ * Try to pre-scan body of a function literal instead of parsing it, so that the function's code
+ * would be compiled upon first call of the function (see also: parser_parse_lazy_function).
+ *
+ * The pre-scan parses the body into a temporary scope, that is freed right after the parse,
+ * so all early errors of the body are reported during parse of the script, while byte-code of the body
+ * is not kept. Functions, nested into the body, are parsed during the pre-scan as well, and ranges
+ * of their bodies are recorded, so the bodies are not pre-scanned again upon compilation of the function's code.
+ *
+ * Note:
+ *      Opening brace of the function's body should be set as current token when the routine is called.
+ *      If the body was skipped, upon return the body's closing brace is the current token,
+ *      and scope code flags and 'meta' instructions with ranges of the function's source text
+ *      and of the nested functions' bodies are dumped instead of the body's code.
+ *      Otherwise, the lexer's state is not changed.
+ *
+ * @return true - if the function's body was skipped,
+ *         false - otherwise (the function's body should be parsed).
+ */
+static bool
+jsp_try_skip_lazy_function_body (locus function_start_loc) /**< location of the function literal's
+                                                            *   'function' keyword */
+{
+  current_token_must_be (TOK_OPEN_BRACE);
+
+  if (!parser_lazy_functions
+      || lazy_source_p == NULL
+      || (inside_lazy_function_compilation && !inside_function)
+      || !dumper_can_dump_lazy_function ())
+  {
+    /*
+     * Function, which code is being compiled, is parsed, while nested functions can be lazy.
+     *
+     * Functions of eval code, of Function constructor's code, and of scripts, which source is not kept
+     * after parse (see also: parser_parse_script), are parsed.
+     */
+    return false;
+  }
+
+  const locus body_start_loc = tok.loc;
+
+  if (lazy_validated_function_scope != NULL)
+  {
+    /*
+     * The function is nested into a lazy function's body, that is being pre-scanned, so the function's body
+     * is parsed into the temporary scope, and range of the body is recorded in the lazy function's scope
+     */
+    jsp_parse_lazy_function_body_for_validation ();
+
+    serializer_set_scope (lazy_validated_function_scope);
+    dump_lazy_function_nested_body (lazy_source_offset + (lit_utf8_size_t) body_start_loc.offset,
+                                    lazy_source_offset + (lit_utf8_size_t) tok.loc.offset + 1u);
+    serializer_set_scope (STACK_TOP (scopes));
+
+    return true;
+  }
+
+  vm_instr_counter_t scope_code_flags_oc = dump_scope_code_flags_for_rewrite ();
+  vm_instr_counter_t lazy_function_oc = dump_lazy_function_for_rewrite ();
+
+  lit_utf8_size_t body_end_offset;
+
+  if (jsp_find_lazy_function_nested_body ((lit_utf8_size_t) body_start_loc.offset, &body_end_offset))
+  {
+    /* the body was already checked during pre-scan of the outer lazy function's body */
+    skip_newlines ();
+    check_directive_prologue_for_use_strict ();
+
+    locus body_end_loc = body_start_loc;
+    body_end_loc.offset = (body_end_offset - 1u) & LIT_ITERATOR_OFFSET_MASK;
+
+    lexer_seek (body_end_loc);
+    skip_newlines ();
+    current_token_must_be (TOK_CLOSE_BRACE);
+  }
+  else
+  {
+    lazy_validated_function_scope = STACK_TOP (scopes);
+
+    STACK_PUSH (scopes, scopes_tree_init (NULL, SCOPE_TYPE_FUNCTION));
+    serializer_set_scope (STACK_TOP (scopes));
+    scopes_tree_set_strict_mode (STACK_TOP (scopes), scopes_tree_strict_mode (lazy_validated_function_scope));
+
+    jsp_parse_lazy_function_body_for_validation ();
+
+    /* Use Strict directive in the body's prologue is detected during the parse */
+    const bool is_strict = scopes_tree_strict_mode (STACK_TOP (scopes));
+
+    scopes_tree_free (STACK_TOP (scopes));
+    STACK_DROP (scopes, 1);
+    serializer_set_scope (STACK_TOP (scopes));
+
+    JERRY_ASSERT (STACK_TOP (scopes) == lazy_validated_function_scope);
+    lazy_validated_function_scope = NULL;
+
+    scopes_tree_set_strict_mode (STACK_TOP (scopes), is_strict);
+    lexer_set_strict_mode (is_strict);
+  }
+
+  opcode_scope_code_flags_t scope_flags = OPCODE_SCOPE_CODE_FLAGS__EMPTY;
+
+  if (scopes_tree_strict_mode (STACK_TOP (scopes)))
+  {
+    scope_flags = OPCODE_SCOPE_CODE_FLAGS_STRICT;
+  }
+
+  rewrite_scope_code_flags (scope_code_flags_oc, scope_flags);
+  rewrite_lazy_function (lazy_function_oc,
+                         lazy_source_offset + (lit_utf8_size_t) function_start_loc.offset,
+                         lazy_source_offset + (lit_utf8_size_t) tok.loc.offset + 1u);
+
+  return true;
+} /* jsp_try_skip_lazy_function_body */
+
 /**
  * Find next token of specified type before the specified location
  *
@@ -680,6 +952,8 @@ parse_function_declaration (void)
 
   assert_keyword (KW_FUNCTION);
 
+  const locus function_start_loc = tok.loc;
+
   jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
 
   scopes_tree_set_contains_functions (STACK_TOP (scopes));
@@ -701,14 +975,19 @@ parse_function_declaration (void)
   dump_function_end_for_rewrite ();
 
   token_after_newlines_must_be (TOK_OPEN_BRACE);
-  skip_newlines ();
 
   bool was_in_function = inside_function;
-  inside_function = true;
 
-  parse_source_element_list (false, true);
+  if (!jsp_try_skip_lazy_function_body (function_start_loc))
+  {
+    skip_newlines ();
 
-  next_token_must_be (TOK_CLOSE_BRACE);
+    inside_function = true;
+
+    parse_source_element_list (false, true);
+
+    next_token_must_be (TOK_CLOSE_BRACE);
+  }
 
   dump_ret ();
   rewrite_function_end ();
@@ -736,6 +1015,8 @@ parse_function_expression (void)
   STACK_DECLARE_USAGE (scopes);
   assert_keyword (KW_FUNCTION);
 
+  const locus function_start_loc = tok.loc;
+
   jsp_operand_t res;
 
   jsp_early_error_start_checking_of_vargs ();
@@ -767,19 +1048,23 @@ parse_function_expression (void)
   dump_function_end_for_rewrite ();
 
   token_after_newlines_must_be (TOK_OPEN_BRACE);
-  skip_newlines ();
 
   bool was_in_function = inside_function;
-  inside_function = true;
 
-  jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
+  if (!jsp_try_skip_lazy_function_body (function_start_loc))
+  {
+    skip_newlines ();
 
-  parse_source_element_list (false, true);
+    inside_function = true;
 
-  jsp_label_restore_set (masked_label_set_p);
+    jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
 
+    parse_source_element_list (false, true);
 
-  next_token_must_be (TOK_CLOSE_BRACE);
+    jsp_label_restore_set (masked_label_set_p);
+
+    next_token_must_be (TOK_CLOSE_BRACE);
+  }
 
   dump_ret ();
   rewrite_function_end ();
@@ -2964,7 +3249,18 @@ parse_source_element (void)
 {
   if (is_keyword (KW_FUNCTION))
   {
-    parse_function_declaration ();
+    if (inside_lazy_function_compilation && !inside_function)
+    {
+      /*
+       * Source of a lazy function is text of its function literal, that is parsed in place
+       * as function expression (see also: parser_parse_lazy_function)
+       */
+      parse_function_expression ();
+    }
+    else
+    {
+      parse_function_declaration ();
+    }
   }
   else
   {
@@ -3132,9 +3428,9 @@ parse_source_element_list (bool is_global, /**< flag, indicating that we parsing
 
       /* remove declarations of variables with names equal to an argument's name */
       vm_instr_counter_t var_decl_pos = 0;
-      while (var_decl_pos < linked_list_get_length (fe_scope_tree->var_decls))
+      while (var_decl_pos < scopes_tree_var_decls_num (fe_scope_tree))
       {
-        op_meta *om_p = (op_meta *) linked_list_element (fe_scope_tree->var_decls, var_decl_pos);
+        op_meta var_decl_opm = scopes_tree_var_decl (fe_scope_tree, var_decl_pos);
         bool is_removed = false;
 
         for (vm_instr_counter_t arg_index = instr_pos;
@@ -3145,11 +3441,11 @@ parse_source_element_list (bool is_global, /**< flag, indicating that we parsing
           JERRY_ASSERT (meta_opm.op.op_idx == VM_OP_META);
 
           JERRY_ASSERT (meta_opm.op.data.meta.data_1 == VM_IDX_REWRITE_LITERAL_UID);
-          JERRY_ASSERT (om_p->op.data.var_decl.variable_name == VM_IDX_REWRITE_LITERAL_UID);
+          JERRY_ASSERT (var_decl_opm.op.data.var_decl.variable_name == VM_IDX_REWRITE_LITERAL_UID);
 
-          if (meta_opm.lit_id[1].packed_value == om_p->lit_id[0].packed_value)
+          if (meta_opm.lit_id[1].packed_value == var_decl_opm.lit_id[0].packed_value)
           {
-            linked_list_remove_element (fe_scope_tree->var_decls, var_decl_pos);
+            scopes_tree_remove_var_decl (fe_scope_tree, var_decl_pos);
 
             is_removed = true;
             break;
@@ -3158,13 +3454,13 @@ parse_source_element_list (bool is_global, /**< flag, indicating that we parsing
 
         if (!is_removed)
         {
-          if (!dumper_try_replace_identifier_name_with_reg (fe_scope_tree, om_p))
+          if (!dumper_try_replace_identifier_name_with_reg (fe_scope_tree, &var_decl_opm))
           {
             var_decl_pos++;
           }
           else
           {
-            linked_list_remove_element (fe_scope_tree->var_decls, var_decl_pos);
+            scopes_tree_remove_var_decl (fe_scope_tree, var_decl_pos);
           }
         }
       }
@@ -3173,7 +3469,7 @@ parse_source_element_list (bool is_global, /**< flag, indicating that we parsing
       {
         scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_ARGUMENTS_ON_REGISTERS);
 
-        JERRY_ASSERT (linked_list_get_length (fe_scope_tree->var_decls) == 0);
+        JERRY_ASSERT (scopes_tree_var_decls_num (fe_scope_tree) == 0);
         scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NO_LEX_ENV);
 
         /* at this point all arguments can be moved to registers */
@@ -3272,6 +3568,17 @@ parse_source_element_list (bool is_global, /**< flag, indicating that we parsing
   dumper_finish_scope ();
 } /* parse_source_element_list */
 
+/**
+ * Source, read by chunks during parse
+ */
+typedef struct
+{
+  jerry_source_read_callback_t read_callback_p; /**< callback for reading source chunks */
+  void *read_callback_data_p; /**< data for the callback */
+  jerry_api_char_t *buffer_p; /**< buffer to read the source to */
+  size_t buffer_size; /**< size of the buffer */
+} jsp_source_stream_t;
+
 /**
  * Parse program
  *
@@ -3285,9 +3592,14 @@ parse_source_element_list (bool is_global, /**< flag, indicating that we parsing
 static jsp_status_t
 parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer */
                       size_t source_size, /**< source code size in bytes */
+                      const jsp_source_stream_t *source_stream_p, /**< source, read by chunks during parse
+                                                                   *   (NULL - if the source is in the buffer,
+                                                                   *    specified with source_p and source_size) */
                       bool in_eval, /**< flag indicating if we are parsing body of eval code */
                       bool is_strict, /**< flag, indicating whether current code
                                        *   inherited strict mode from code of an outer scope */
+                      bool is_lazy_function_compilation, /**< flag, indicating whether code of a lazy function
+                                                          *   is compiled (see also: parser_parse_lazy_function) */
                       const bytecode_data_header_t **out_bytecode_data_p, /**< out: generated byte-code array
                                                                            *  (in case there were no syntax errors) */
                       bool *out_contains_functions_p) /**< out: optional (can be NULL, if the output is not needed)
@@ -3297,6 +3609,9 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
   JERRY_ASSERT (out_bytecode_data_p != NULL);
 
   inside_eval = in_eval;
+  inside_function = false;
+  inside_lazy_function_compilation = is_lazy_function_compilation;
+  lazy_validated_function_scope = NULL;
 
   scope_type_t scope_type = (in_eval ? SCOPE_TYPE_EVAL : SCOPE_TYPE_GLOBAL);
 
@@ -3328,7 +3643,18 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
      *      Operations that could raise an early error can be performed only during execution of the block.
      */
 
-    lexer_init (source_p, source_size, parser_show_instrs);
+    if (source_stream_p != NULL)
+    {
+      lexer_init_stream (source_stream_p->read_callback_p,
+                         source_stream_p->read_callback_data_p,
+                         source_stream_p->buffer_p,
+                         source_stream_p->buffer_size,
+                         parser_show_instrs);
+    }
+    else
+    {
+      lexer_init (source_p, source_size, parser_show_instrs);
+    }
     lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
 
     skip_newlines ();
@@ -3367,7 +3693,13 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
 
     jsp_early_error_free ();
 
-    *out_bytecode_data_p = serializer_merge_scopes_into_bytecode ();
+    uint32_t source_ranges_count;
+    const bytecode_source_range_t *source_ranges_p = dumper_get_source_ranges (&source_ranges_count);
+
+    /* the source buffer is referenced by the byte-code only if there are lazy functions in the byte-code */
+    *out_bytecode_data_p = serializer_merge_scopes_into_bytecode ((source_ranges_count != 0) ? lazy_source_p : NULL,
+                                                                  source_ranges_p,
+                                                                  source_ranges_count);
 
     dumper_free ();
 
@@ -3383,6 +3715,9 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
     STACK_DROP (scopes, 1);
     STACK_FREE (scopes);
 
+    /* byte-code is merged into separate heap blocks, so the parser's arena can be released */
+    jsp_mm_free_all ();
+
     status = JSP_STATUS_OK;
   }
   else
@@ -3427,12 +3762,77 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
 jsp_status_t
 parser_parse_script (const jerry_api_char_t *source, /**< source script */
                      size_t source_size, /**< source script size it bytes */
-                     const bytecode_data_header_t **out_bytecode_data_p) /**< out: generated byte-code array
+                     bool is_source_kept, /**< flag, indicating whether the source buffer is kept unchanged
+                                           *   while the generated byte-code is alive, so that functions'
+                                           *   code can be compiled from the buffer upon first call
+                                           *   (see also: parser_set_lazy_functions) */
+                     const bytecode_data_header_t **out_bytecode_data_p, /**< out: generated byte-code array
                                                                           *  (in case there were no syntax errors) */
+                     bool *out_contains_functions_p) /**< out: optional (can be NULL, if the output is not needed)
+                                                      *        flag, indicating whether the compiled byte-code
+                                                      *        contains a function declaration / expression */
 {
-  return parser_parse_program (source, source_size, false, false, out_bytecode_data_p, NULL);
+  lazy_source_p = is_source_kept ? source : NULL;
+  lazy_source_offset = 0;
+
+  jsp_status_t status = parser_parse_program (source,
+                                              source_size,
+                                              NULL,
+                                              false,
+                                              false,
+                                              false,
+                                              out_bytecode_data_p,
+                                              out_contains_functions_p);
+
+  lazy_source_p = NULL;
+
+  return status;
 } /* parser_parse_script */
 
+/**
+ * Parse source script, that is read by chunks during parse
+ *
+ * Note:
+ *      the source is read to the specified buffer, which should be large enough to hold the whole source
+ *
+ * @return true - if parse finished successfully (no SyntaxError were raised);
+ *         false - otherwise.
+ */
+jsp_status_t
+parser_parse_script_stream (jerry_source_read_callback_t read_callback_p, /**< callback for reading source chunks */
+                            void *read_callback_data_p, /**< data for the callback */
+                            jerry_api_char_t *buffer_p, /**< buffer to read the source to */
+                            size_t buffer_size, /**< size of the buffer */
+                            bool is_source_kept, /**< flag, indicating whether the buffer is kept unchanged
+                                                  *   while the generated byte-code is alive
+                                                  *   (see also: parser_parse_script) */
+                            const bytecode_data_header_t **out_bytecode_data_p) /**< out: generated byte-code array
+                                                                                 *  (in case there were
+                                                                                 *   no syntax errors) */
+{
+  jsp_source_stream_t source_stream;
+  source_stream.read_callback_p = read_callback_p;
+  source_stream.read_callback_data_p = read_callback_data_p;
+  source_stream.buffer_p = buffer_p;
+  source_stream.buffer_size = buffer_size;
+
+  lazy_source_p = is_source_kept ? buffer_p : NULL;
+  lazy_source_offset = 0;
+
+  jsp_status_t status = parser_parse_program (buffer_p,
+                                              0,
+                                              &source_stream,
+                                              false,
+                                              false,
+                                              false,
+                                              out_bytecode_data_p,
+                                              NULL);
+
+  lazy_source_p = NULL;
+
+  return status;
+} /* parser_parse_script_stream */
+
 /**
  * Parse string passed to eval() call
  *
@@ -3453,12 +3853,65 @@ parser_parse_eval (const jerry_api_char_t *source, /**< string passed to eval()
 
   return parser_parse_program (source,
                                source_size,
+                               NULL,
                                true,
                                is_strict,
+                               false,
                                out_bytecode_data_p,
                                out_contains_functions_p);
 } /* parser_parse_eval */
 
+/**
+ * Compile code of a function, which body was skipped during parse in lazy functions mode
+ * (see also: parser_set_lazy_functions)
+ *
+ * Note:
+ *      the function literal's source text is parsed in place in the source buffer of the byte-code,
+ *      containing the function literal, and the function's code is placed in the generated byte-code
+ *      as code of function expression.
+ *      Function literals, nested in the function, are not compiled, and their bodies, pre-scanned
+ *      during parse of the byte-code, are not pre-scanned again.
+ *
+ * @return true - if parse finished successfully (no SyntaxError were raised);
+ *         false - otherwise.
+ */
+jsp_status_t
+parser_parse_lazy_function (const bytecode_data_header_t *bytecode_header_p, /**< byte-code, containing
+                                                                              *   the lazy function */
+                            vm_instr_counter_t lazy_instr_pos, /**< position of the lazy function's
+                                                                *   'meta' instruction in the byte-code */
+                            bool is_strict, /**< flag, indicating whether the function
+                                             *   is declared in strict mode code */
+                            const bytecode_data_header_t **out_bytecode_data_p) /**< out: generated byte-code array
+                                                                                 *  (in case there were
+                                                                                 *   no syntax errors) */
+{
+  JERRY_ASSERT (bytecode_header_p->source_p != NULL);
+
+  lit_utf8_size_t start_offset, end_offset;
+  jsp_get_lazy_function_range (bytecode_header_p, lazy_instr_pos, &start_offset, &end_offset);
+
+  lazy_source_p = bytecode_header_p->source_p;
+  lazy_source_offset = start_offset;
+  lazy_nested_bodies_bytecode_p = bytecode_header_p;
+  lazy_nested_bodies_pos = (vm_instr_counter_t) (lazy_instr_pos + 1u);
+
+  jsp_status_t status = parser_parse_program (lazy_source_p + start_offset,
+                                              end_offset - start_offset,
+                                              NULL,
+                                              false,
+                                              is_strict,
+                                              true,
+                                              out_bytecode_data_p,
+                                              NULL);
+
+  lazy_source_p = NULL;
+  lazy_source_offset = 0;
+  lazy_nested_bodies_bytecode_p = NULL;
+
+  return status;
+} /* parser_parse_lazy_function */
+
 /**
  * Tell parser whether to dump bytecode
  */
@@ -3467,3 +3920,13 @@ parser_set_show_instrs (bool show_instrs) /**< flag indicating whether to dump b
 {
   parser_show_instrs = show_instrs;
 } /* parser_set_show_instrs */
+
+/**
+ * Tell parser whether to skip bodies of function literals, leaving the functions' code
+ * to be compiled upon first call of the functions (see also: parser_parse_lazy_function)
+ */
+void
+parser_set_lazy_functions (bool lazy_functions) /**< flag indicating whether lazy functions mode is enabled */
+{
+  parser_lazy_functions = lazy_functions;
+} /* parser_set_lazy_functions */
@@ -29,7 +29,12 @@ typedef enum
 } jsp_status_t;
 
 void parser_set_show_instrs (bool);
-jsp_status_t parser_parse_script (const jerry_api_char_t *, size_t, const bytecode_data_header_t **);
+void parser_set_lazy_functions (bool);
+jsp_status_t parser_parse_script (const jerry_api_char_t *, size_t, bool, const bytecode_data_header_t **, bool *);
+jsp_status_t parser_parse_script_stream (jerry_source_read_callback_t, void *, jerry_api_char_t *, size_t, bool,
+                                         const bytecode_data_header_t **);
 jsp_status_t parser_parse_eval (const jerry_api_char_t *, size_t, bool, const bytecode_data_header_t **, bool *);
+jsp_status_t parser_parse_lazy_function (const bytecode_data_header_t *, vm_instr_counter_t, bool,
+                                         const bytecode_data_header_t **);
 
 #endif /* PARSER_H */
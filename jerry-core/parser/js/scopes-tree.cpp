@@ -19,6 +19,47 @@
 
 #define HASH_SIZE 128
 
+/*
+ * Instructions of a scope are stored in chunks, each holding the same number of instructions
+ * (except for the last chunk, that grows up to the number), so an instruction takes the same space
+ * as in the final byte-code, and adding an instruction never copies more than one chunk.
+ *
+ * Literals, bound to the instructions' arguments, are stored separately for each chunk,
+ * and only for arguments, that are actually bound to a literal.
+ *
+ * Variable declarations are stored as array of the declared variables' names.
+ */
+
+/**
+ * Minimum number of instructions in a full chunk of scope's instructions
+ *
+ * Actual number is the number of instructions, fitting into recommended allocation size for the minimum number.
+ */
+#define SCOPES_TREE_CHUNK_MIN_INSTRS_NUMBER (60u)
+
+/**
+ * Literal, bound to an argument of an instruction in a chunk of scope's instructions
+ */
+typedef struct
+{
+  lit_cpointer_t lit_id; /**< literal */
+  uint8_t instr_pos; /**< position of the instruction in the chunk */
+  uint8_t arg_index; /**< index of the instruction's argument */
+} scopes_tree_lit_entry_t;
+
+/**
+ * Chunk of scope's instructions
+ */
+typedef struct
+{
+  mem_cpointer_t instrs_cp; /**< instructions */
+  mem_cpointer_t lit_entries_cp; /**< literals, bound to the instructions' arguments,
+                                  *   ordered by position of the instructions */
+  uint8_t instrs_capacity; /**< number of instructions, the chunk can hold */
+  uint8_t lit_entries_count; /**< number of the literals */
+  uint8_t lit_entries_capacity; /**< number of literals, the chunk can hold */
+} scopes_tree_chunk_t;
+
 static hash_table lit_id_to_uid = null_hash;
 static vm_instr_counter_t global_oc;
 static vm_idx_t next_uid;
@@ -43,6 +84,207 @@ set_uid (op_meta *op, size_t i, vm_idx_t uid)
   op->op.data.raw_args[i] = uid;
 }
 
+/**
+ * Reallocate an array from parser's memory arena, so that it could hold at least the specified number of elements
+ *
+ * Capacity of the array is at least doubled, and is extended to fill the recommended allocation size.
+ *
+ * @return pointer to the new array
+ */
+static void *
+scopes_tree_grow_array (void *array_p, /**< array (or NULL, if it is not allocated yet) */
+                        size_t element_size, /**< size of an element */
+                        size_t capacity, /**< current capacity of the array */
+                        size_t required_capacity, /**< required capacity */
+                        size_t max_capacity, /**< maximum capacity */
+                        size_t *out_new_capacity_p) /**< out: new capacity */
+{
+  JERRY_ASSERT (capacity < required_capacity && required_capacity <= max_capacity);
+
+  size_t new_capacity = JERRY_MAX (required_capacity, capacity * 2u);
+  new_capacity = jsp_mm_recommend_size (new_capacity * element_size) / element_size;
+  new_capacity = JERRY_MIN (new_capacity, max_capacity);
+
+  void *new_array_p = jsp_mm_alloc (new_capacity * element_size);
+
+  if (array_p != NULL)
+  {
+    memcpy (new_array_p, array_p, capacity * element_size);
+    jsp_mm_free (array_p);
+  }
+
+  *out_new_capacity_p = new_capacity;
+  return new_array_p;
+} /* scopes_tree_grow_array */
+
+/**
+ * Get number of instructions in a full chunk of scope's instructions
+ *
+ * @return number of instructions
+ */
+static vm_instr_counter_t
+scopes_tree_get_chunk_capacity (void)
+{
+  return (vm_instr_counter_t) (jsp_mm_recommend_size (SCOPES_TREE_CHUNK_MIN_INSTRS_NUMBER * sizeof (vm_instr_t))
+                               / sizeof (vm_instr_t));
+} /* scopes_tree_get_chunk_capacity */
+
+/**
+ * Get chunk, holding specified instruction of a scope
+ *
+ * @return pointer to the chunk
+ */
+static scopes_tree_chunk_t *
+scopes_tree_get_chunk (scopes_tree tree, /**< scope */
+                       vm_instr_counter_t oc, /**< position of the instruction */
+                       uint8_t *out_instr_pos_p) /**< out: position of the instruction in the chunk */
+{
+  const vm_instr_counter_t chunk_capacity = scopes_tree_get_chunk_capacity ();
+  const size_t chunk_index = oc / chunk_capacity;
+  JERRY_ASSERT (chunk_index < tree->instrs_chunks_capacity);
+
+  *out_instr_pos_p = (uint8_t) (oc % chunk_capacity);
+
+  return MEM_CP_GET_NON_NULL_POINTER (scopes_tree_chunk_t, tree->instrs_chunks_cp) + chunk_index;
+} /* scopes_tree_get_chunk */
+
+/**
+ * Get instruction, together with literals, bound to its arguments, from a chunk
+ *
+ * @return instruction descriptor
+ */
+static op_meta
+scopes_tree_chunk_get_instr (const scopes_tree_chunk_t *chunk_p, /**< chunk */
+                             uint8_t instr_pos) /**< position of the instruction in the chunk */
+{
+  JERRY_ASSERT (instr_pos < chunk_p->instrs_capacity);
+
+  op_meta om;
+  om.op = MEM_CP_GET_NON_NULL_POINTER (vm_instr_t, chunk_p->instrs_cp)[instr_pos];
+  om.lit_id[0] = lit_cpointer_t::null_cp ();
+  om.lit_id[1] = lit_cpointer_t::null_cp ();
+  om.lit_id[2] = lit_cpointer_t::null_cp ();
+
+  const scopes_tree_lit_entry_t *entries_p = MEM_CP_GET_POINTER (scopes_tree_lit_entry_t,
+                                                                 chunk_p->lit_entries_cp);
+
+  for (uint8_t i = 0; i < chunk_p->lit_entries_count && entries_p[i].instr_pos <= instr_pos; i++)
+  {
+    if (entries_p[i].instr_pos == instr_pos)
+    {
+      om.lit_id[entries_p[i].arg_index] = entries_p[i].lit_id;
+    }
+  }
+
+  return om;
+} /* scopes_tree_chunk_get_instr */
+
+/**
+ * Put instruction, together with literals, bound to its arguments, to a chunk,
+ * replacing instruction at the position (if any)
+ */
+static void
+scopes_tree_chunk_set_instr (scopes_tree_chunk_t *chunk_p, /**< chunk */
+                             uint8_t instr_pos, /**< position of the instruction in the chunk */
+                             const op_meta *om_p) /**< instruction descriptor */
+{
+  JERRY_ASSERT (instr_pos < chunk_p->instrs_capacity);
+
+  MEM_CP_GET_NON_NULL_POINTER (vm_instr_t, chunk_p->instrs_cp)[instr_pos] = om_p->op;
+
+  size_t new_lits_num = 0;
+  for (uint8_t arg_index = 0; arg_index < 3; arg_index++)
+  {
+    if (om_p->lit_id[arg_index].packed_value != MEM_CP_NULL)
+    {
+      new_lits_num++;
+    }
+  }
+
+  scopes_tree_lit_entry_t *entries_p = MEM_CP_GET_POINTER (scopes_tree_lit_entry_t, chunk_p->lit_entries_cp);
+  const size_t entries_count = chunk_p->lit_entries_count;
+
+  /* literals of the instruction, that is replaced, are [begin, end) */
+  size_t begin = 0;
+  while (begin < entries_count && entries_p[begin].instr_pos < instr_pos)
+  {
+    begin++;
+  }
+
+  size_t end = begin;
+  while (end < entries_count && entries_p[end].instr_pos == instr_pos)
+  {
+    end++;
+  }
+
+  const size_t new_entries_count = entries_count - (end - begin) + new_lits_num;
+
+  if (new_entries_count > chunk_p->lit_entries_capacity)
+  {
+    size_t new_capacity;
+    entries_p = (scopes_tree_lit_entry_t *) scopes_tree_grow_array (entries_p,
+                                                                    sizeof (scopes_tree_lit_entry_t),
+                                                                    chunk_p->lit_entries_capacity,
+                                                                    new_entries_count,
+                                                                    UINT8_MAX,
+                                                                    &new_capacity);
+    MEM_CP_SET_NON_NULL_POINTER (chunk_p->lit_entries_cp, entries_p);
+    chunk_p->lit_entries_capacity = (uint8_t) new_capacity;
+  }
+
+  if (end - begin != new_lits_num)
+  {
+    memmove (entries_p + begin + new_lits_num,
+             entries_p + end,
+             (entries_count - end) * sizeof (scopes_tree_lit_entry_t));
+  }
+
+  for (uint8_t arg_index = 0; arg_index < 3; arg_index++)
+  {
+    if (om_p->lit_id[arg_index].packed_value != MEM_CP_NULL)
+    {
+      entries_p[begin].lit_id = om_p->lit_id[arg_index];
+      entries_p[begin].instr_pos = instr_pos;
+      entries_p[begin].arg_index = arg_index;
+      begin++;
+    }
+  }
+
+  chunk_p->lit_entries_count = (uint8_t) new_entries_count;
+} /* scopes_tree_chunk_set_instr */
+
+/**
+ * Remove instructions at end of a scope
+ */
+static void
+scopes_tree_truncate (scopes_tree tree, /**< scope */
+                      vm_instr_counter_t instrs_num) /**< number of instructions to keep */
+{
+  JERRY_ASSERT (instrs_num <= tree->instrs_count);
+
+  vm_instr_counter_t oc = instrs_num;
+  while (oc < tree->instrs_count)
+  {
+    uint8_t instr_pos;
+    scopes_tree_chunk_t *chunk_p = scopes_tree_get_chunk (tree, oc, &instr_pos);
+
+    const scopes_tree_lit_entry_t *entries_p = MEM_CP_GET_POINTER (scopes_tree_lit_entry_t,
+                                                                   chunk_p->lit_entries_cp);
+
+    uint8_t entries_count = 0;
+    while (entries_count < chunk_p->lit_entries_count
+           && entries_p[entries_count].instr_pos < instr_pos)
+    {
+      entries_count++;
+    }
+    chunk_p->lit_entries_count = entries_count;
+
+    oc = (vm_instr_counter_t) (oc - instr_pos + scopes_tree_get_chunk_capacity ());
+  }
+
+  tree->instrs_count = instrs_num;
+} /* scopes_tree_truncate */
+
 vm_instr_counter_t
 scopes_tree_instrs_num (scopes_tree t)
 {
@@ -59,14 +301,56 @@ vm_instr_counter_t
 scopes_tree_var_decls_num (scopes_tree t) /**< scope */
 {
   assert_tree (t);
-  return linked_list_get_length (t->var_decls);
+  return t->var_decls_count;
 } /* scopes_tree_var_decls_num */
 
 void
 scopes_tree_add_op_meta (scopes_tree tree, op_meta op)
 {
   assert_tree (tree);
-  linked_list_set_element (tree->instrs, tree->instrs_count++, &op);
+  JERRY_ASSERT (tree->instrs_count < MAX_OPCODES);
+
+  const vm_instr_counter_t chunk_capacity = scopes_tree_get_chunk_capacity ();
+  const size_t chunk_index = tree->instrs_count / chunk_capacity;
+
+  scopes_tree_chunk_t *chunks_p = MEM_CP_GET_POINTER (scopes_tree_chunk_t, tree->instrs_chunks_cp);
+
+  if (chunk_index == tree->instrs_chunks_capacity)
+  {
+    size_t new_capacity;
+    chunks_p = (scopes_tree_chunk_t *) scopes_tree_grow_array (chunks_p,
+                                                               sizeof (scopes_tree_chunk_t),
+                                                               tree->instrs_chunks_capacity,
+                                                               chunk_index + 1u,
+                                                               UINT16_MAX,
+                                                               &new_capacity);
+    memset (chunks_p + tree->instrs_chunks_capacity,
+            0,
+            (new_capacity - tree->instrs_chunks_capacity) * sizeof (scopes_tree_chunk_t));
+
+    MEM_CP_SET_NON_NULL_POINTER (tree->instrs_chunks_cp, chunks_p);
+    tree->instrs_chunks_capacity = (uint16_t) new_capacity;
+  }
+
+  scopes_tree_chunk_t *chunk_p = chunks_p + chunk_index;
+  const uint8_t instr_pos = (uint8_t) (tree->instrs_count % chunk_capacity);
+
+  if (instr_pos == chunk_p->instrs_capacity)
+  {
+    size_t new_capacity;
+    vm_instr_t *instrs_p = (vm_instr_t *) scopes_tree_grow_array (MEM_CP_GET_POINTER (vm_instr_t,
+                                                                                      chunk_p->instrs_cp),
+                                                                  sizeof (vm_instr_t),
+                                                                  chunk_p->instrs_capacity,
+                                                                  instr_pos + 1u,
+                                                                  chunk_capacity,
+                                                                  &new_capacity);
+    MEM_CP_SET_NON_NULL_POINTER (chunk_p->instrs_cp, instrs_p);
+    chunk_p->instrs_capacity = (uint8_t) new_capacity;
+  }
+
+  scopes_tree_chunk_set_instr (chunk_p, instr_pos, &op);
+  tree->instrs_count++;
 }
 
 /**
@@ -77,7 +361,26 @@ scopes_tree_add_var_decl (scopes_tree tree, /**< scope, to which variable declar
                           op_meta op) /**< variable declaration instruction */
 {
   assert_tree (tree);
-  linked_list_set_element (tree->var_decls, linked_list_get_length (tree->var_decls), &op);
+  JERRY_ASSERT (op.op.op_idx == VM_OP_VAR_DECL);
+  JERRY_ASSERT (op.op.data.var_decl.variable_name == VM_IDX_REWRITE_LITERAL_UID);
+  JERRY_ASSERT (op.lit_id[0].packed_value != MEM_CP_NULL);
+
+  lit_cpointer_t *var_decls_p = MEM_CP_GET_POINTER (lit_cpointer_t, tree->var_decls_cp);
+
+  if (tree->var_decls_count == tree->var_decls_capacity)
+  {
+    size_t new_capacity;
+    var_decls_p = (lit_cpointer_t *) scopes_tree_grow_array (var_decls_p,
+                                                             sizeof (lit_cpointer_t),
+                                                             tree->var_decls_capacity,
+                                                             tree->var_decls_count + 1u,
+                                                             MAX_OPCODES,
+                                                             &new_capacity);
+    MEM_CP_SET_NON_NULL_POINTER (tree->var_decls_cp, var_decls_p);
+    tree->var_decls_capacity = (vm_instr_counter_t) new_capacity;
+  }
+
+  var_decls_p[tree->var_decls_count++] = op.lit_id[0];
 } /* scopes_tree_add_var_decl */
 
 void
@@ -85,7 +388,11 @@ scopes_tree_set_op_meta (scopes_tree tree, vm_instr_counter_t oc, op_meta op)
 {
   assert_tree (tree);
   JERRY_ASSERT (oc < tree->instrs_count);
-  linked_list_set_element (tree->instrs, oc, &op);
+
+  uint8_t instr_pos;
+  scopes_tree_chunk_t *chunk_p = scopes_tree_get_chunk (tree, oc, &instr_pos);
+
+  scopes_tree_chunk_set_instr (chunk_p, instr_pos, &op);
 }
 
 void
@@ -93,7 +400,7 @@ scopes_tree_set_instrs_num (scopes_tree tree, vm_instr_counter_t oc)
 {
   assert_tree (tree);
   JERRY_ASSERT (oc < tree->instrs_count);
-  tree->instrs_count = oc;
+  scopes_tree_truncate (tree, oc);
 }
 
 op_meta
@@ -101,7 +408,11 @@ scopes_tree_op_meta (scopes_tree tree, vm_instr_counter_t oc)
 {
   assert_tree (tree);
   JERRY_ASSERT (oc < tree->instrs_count);
-  return *(op_meta *) linked_list_element (tree->instrs, oc);
+
+  uint8_t instr_pos;
+  const scopes_tree_chunk_t *chunk_p = scopes_tree_get_chunk (tree, oc, &instr_pos);
+
+  return scopes_tree_chunk_get_instr (chunk_p, instr_pos);
 }
 
 /**
@@ -114,10 +425,36 @@ scopes_tree_var_decl (scopes_tree tree, /**< scope, from which variable declarat
                       vm_instr_counter_t oc) /**< number of variable declaration in the scope */
 {
   assert_tree (tree);
-  JERRY_ASSERT (oc < linked_list_get_length (tree->var_decls));
-  return *(op_meta *) linked_list_element (tree->var_decls, oc);
+  JERRY_ASSERT (oc < tree->var_decls_count);
+
+  op_meta om;
+  om.op.op_idx = VM_OP_VAR_DECL;
+  om.op.data.raw_args[0] = VM_IDX_REWRITE_LITERAL_UID;
+  om.op.data.raw_args[1] = VM_IDX_EMPTY;
+  om.op.data.raw_args[2] = VM_IDX_EMPTY;
+  om.lit_id[0] = MEM_CP_GET_NON_NULL_POINTER (lit_cpointer_t, tree->var_decls_cp)[oc];
+  om.lit_id[1] = lit_cpointer_t::null_cp ();
+  om.lit_id[2] = lit_cpointer_t::null_cp ();
+
+  return om;
 } /* scopes_tree_var_decl */
 
+/**
+ * Remove specified variable declaration from a scope
+ */
+void
+scopes_tree_remove_var_decl (scopes_tree tree, /**< scope */
+                             vm_instr_counter_t oc) /**< number of variable declaration in the scope */
+{
+  assert_tree (tree);
+  JERRY_ASSERT (oc < tree->var_decls_count);
+
+  lit_cpointer_t *var_decls_p = MEM_CP_GET_NON_NULL_POINTER (lit_cpointer_t, tree->var_decls_cp);
+  memmove (var_decls_p + oc, var_decls_p + oc + 1, (size_t) (tree->var_decls_count - oc - 1) * sizeof (lit_cpointer_t));
+
+  tree->var_decls_count--;
+} /* scopes_tree_remove_var_decl */
+
 /**
  * Remove specified instruction from scopes tree node's instructions list
  */
@@ -128,15 +465,19 @@ scopes_tree_remove_op_meta (scopes_tree tree, /**< scopes tree node */
   assert_tree (tree);
   JERRY_ASSERT (oc < tree->instrs_count);
 
-  linked_list_remove_element (tree->instrs, oc);
-  tree->instrs_count--;
+  for (vm_instr_counter_t instr_pos = oc; instr_pos + 1u < tree->instrs_count; instr_pos++)
+  {
+    scopes_tree_set_op_meta (tree, instr_pos, scopes_tree_op_meta (tree, (vm_instr_counter_t) (instr_pos + 1u)));
+  }
+
+  scopes_tree_truncate (tree, (vm_instr_counter_t) (tree->instrs_count - 1u));
 } /* scopes_tree_remove_op_meta */
 
 vm_instr_counter_t
 scopes_tree_count_instructions (scopes_tree t)
 {
   assert_tree (t);
-  vm_instr_counter_t res = (vm_instr_counter_t) (t->instrs_count + linked_list_get_length (t->var_decls));
+  vm_instr_counter_t res = (vm_instr_counter_t) (t->instrs_count + t->var_decls_count);
   for (uint8_t i = 0; i < t->t.children_num; i++)
   {
     res = (vm_instr_counter_t) (
@@ -157,16 +498,13 @@ scopes_tree_variable_declaration_exists (scopes_tree tree, /**< scope */
 {
   assert_tree (tree);
 
+  const lit_cpointer_t *var_decls_p = MEM_CP_GET_POINTER (lit_cpointer_t, tree->var_decls_cp);
+
   for (vm_instr_counter_t oc = 0u;
-       oc < linked_list_get_length (tree->var_decls);
+       oc < tree->var_decls_count;
        oc++)
   {
-    const op_meta* var_decl_om_p = (op_meta *) linked_list_element (tree->var_decls, oc);
-
-    JERRY_ASSERT (var_decl_om_p->op.op_idx == VM_OP_VAR_DECL);
-    JERRY_ASSERT (var_decl_om_p->op.data.var_decl.variable_name == VM_IDX_REWRITE_LITERAL_UID);
-
-    if (var_decl_om_p->lit_id[0].packed_value == lit_id.packed_value)
+    if (var_decls_p[oc].packed_value == lit_id.packed_value)
     {
       return true;
     }
@@ -291,29 +629,15 @@ insert_uids_to_lit_id_map (op_meta *om, uint16_t mask)
 }
 
 /**
- * Get instruction from instruction list
- *
- * @return instruction at specified position
- */
-static op_meta *
-extract_op_meta (linked_list instr_list, /**< instruction list */
-                 vm_instr_counter_t instr_pos) /**< position inside the list */
-{
-  return (op_meta *) linked_list_element (instr_list, instr_pos);
-} /* extract_op_meta */
-
-/**
- * Add instruction to an instruction list
+ * Generate byte-code instruction from intermediate instruction descriptor
  *
  * @return generated instruction
  */
 static vm_instr_t
-generate_instr (linked_list instr_list, /**< instruction list */
-                vm_instr_counter_t instr_pos, /**< position where to generate an instruction */
+generate_instr (op_meta *om_p, /**< instruction descriptor */
                 lit_id_hash_table *lit_ids) /**< hash table binding operand identifiers and literals */
 {
   start_new_block_if_necessary ();
-  op_meta *om_p = extract_op_meta (instr_list, instr_pos);
   /* Now we should change uids of instructions.
      Since different instructions has different literals/tmps in different places,
      we should change only them.
@@ -440,6 +764,9 @@ generate_instr (linked_list instr_list, /**< instruction list */
         case OPCODE_META_TYPE_END_TRY_CATCH_FINALLY:
         case OPCODE_META_TYPE_CALL_SITE_INFO:
         case OPCODE_META_TYPE_SCOPE_CODE_FLAGS:
+        case OPCODE_META_TYPE_LAZY_FUNCTION:
+        case OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED:
+        case OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY:
         {
           change_uid (om_p, lit_ids, 0x000);
           break;
@@ -580,6 +907,9 @@ count_new_literals_in_instr (op_meta *om_p) /**< instruction */
         case OPCODE_META_TYPE_END_TRY_CATCH_FINALLY:
         case OPCODE_META_TYPE_CALL_SITE_INFO:
         case OPCODE_META_TYPE_SCOPE_CODE_FLAGS:
+        case OPCODE_META_TYPE_LAZY_FUNCTION:
+        case OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED:
+        case OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY:
         {
           insert_uids_to_lit_id_map (om_p, 0x000);
           break;
@@ -619,24 +949,24 @@ scopes_tree_count_literals_in_blocks (scopes_tree tree) /**< scope */
   bool header = true;
   for (instr_pos = 0; instr_pos < tree->instrs_count; instr_pos++)
   {
-    op_meta *om_p = extract_op_meta (tree->instrs, instr_pos);
-    if (om_p->op.op_idx != VM_OP_META && !header)
+    op_meta om = scopes_tree_op_meta (tree, instr_pos);
+    if (om.op.op_idx != VM_OP_META && !header)
     {
       break;
     }
-    if (om_p->op.op_idx == VM_OP_REG_VAR_DECL)
+    if (om.op.op_idx == VM_OP_REG_VAR_DECL)
     {
       header = false;
     }
-    result += count_new_literals_in_instr (om_p);
+    result += count_new_literals_in_instr (&om);
   }
 
   for (vm_instr_counter_t var_decl_pos = 0;
-       var_decl_pos < linked_list_get_length (tree->var_decls);
+       var_decl_pos < tree->var_decls_count;
        var_decl_pos++)
   {
-    op_meta *om_p = extract_op_meta (tree->var_decls, var_decl_pos);
-    result += count_new_literals_in_instr (om_p);
+    op_meta om = scopes_tree_var_decl (tree, var_decl_pos);
+    result += count_new_literals_in_instr (&om);
   }
 
   for (uint8_t child_id = 0; child_id < tree->t.children_num; child_id++)
@@ -646,8 +976,8 @@ scopes_tree_count_literals_in_blocks (scopes_tree tree) /**< scope */
 
   for (; instr_pos < tree->instrs_count; instr_pos++)
   {
-    op_meta *om_p = extract_op_meta (tree->instrs, instr_pos);
-    result += count_new_literals_in_instr (om_p);
+    op_meta om = scopes_tree_op_meta (tree, instr_pos);
+    result += count_new_literals_in_instr (&om);
   }
 
   return result;
@@ -680,25 +1010,26 @@ merge_subscopes (scopes_tree tree, /**< scopes tree to merge */
   bool header = true;
   for (instr_pos = 0; instr_pos < tree->instrs_count; instr_pos++)
   {
-    op_meta *om_p = extract_op_meta (tree->instrs, instr_pos);
-    if (om_p->op.op_idx != VM_OP_VAR_DECL
-        && om_p->op.op_idx != VM_OP_META && !header)
+    op_meta om = scopes_tree_op_meta (tree, instr_pos);
+    if (om.op.op_idx != VM_OP_VAR_DECL
+        && om.op.op_idx != VM_OP_META && !header)
     {
       break;
     }
-    if (om_p->op.op_idx == VM_OP_REG_VAR_DECL)
+    if (om.op.op_idx == VM_OP_REG_VAR_DECL)
     {
       header = false;
     }
-    data_p[global_oc] = generate_instr (tree->instrs, instr_pos, lit_ids_p);
+    data_p[global_oc] = generate_instr (&om, lit_ids_p);
     global_oc++;
   }
 
   for (vm_instr_counter_t var_decl_pos = 0;
-       var_decl_pos < linked_list_get_length (tree->var_decls);
+       var_decl_pos < tree->var_decls_count;
        var_decl_pos++)
   {
-    data_p[global_oc] = generate_instr (tree->var_decls, var_decl_pos, lit_ids_p);
+    op_meta om = scopes_tree_var_decl (tree, var_decl_pos);
+    data_p[global_oc] = generate_instr (&om, lit_ids_p);
     global_oc++;
   }
 
@@ -710,7 +1041,8 @@ merge_subscopes (scopes_tree tree, /**< scopes tree to merge */
 
   for (; instr_pos < tree->instrs_count; instr_pos++)
   {
-    data_p[global_oc] = generate_instr (tree->instrs, instr_pos, lit_ids_p);
+    op_meta om = scopes_tree_op_meta (tree, instr_pos);
+    data_p[global_oc] = generate_instr (&om, lit_ids_p);
     global_oc++;
   }
 } /* merge_subscopes */
@@ -854,7 +1186,12 @@ scopes_tree_init (scopes_tree parent, /**< parent scope */
     JERRY_ASSERT (*(scopes_tree *) added == tree);
     parent->t.children_num++;
   }
+  tree->instrs_chunks_cp = MEM_CP_NULL;
+  tree->instrs_chunks_capacity = 0;
   tree->instrs_count = 0;
+  tree->var_decls_cp = MEM_CP_NULL;
+  tree->var_decls_capacity = 0;
+  tree->var_decls_count = 0;
   tree->type = type;
   tree->strict_mode = false;
   tree->ref_arguments = false;
@@ -863,8 +1200,6 @@ scopes_tree_init (scopes_tree parent, /**< parent scope */
   tree->contains_try = false;
   tree->contains_delete = false;
   tree->contains_functions = false;
-  tree->instrs = linked_list_init (sizeof (op_meta));
-  tree->var_decls = linked_list_init (sizeof (op_meta));
   return tree;
 } /* scopes_tree_init */
 
@@ -880,7 +1215,26 @@ scopes_tree_free (scopes_tree tree)
     }
     linked_list_free (tree->t.children);
   }
-  linked_list_free (tree->instrs);
-  linked_list_free (tree->var_decls);
+
+  scopes_tree_chunk_t *chunks_p = MEM_CP_GET_POINTER (scopes_tree_chunk_t, tree->instrs_chunks_cp);
+  for (uint16_t i = 0; i < tree->instrs_chunks_capacity; i++)
+  {
+    if (chunks_p[i].instrs_cp != MEM_CP_NULL)
+    {
+      jsp_mm_free (MEM_CP_GET_NON_NULL_POINTER (vm_instr_t, chunks_p[i].instrs_cp));
+    }
+    if (chunks_p[i].lit_entries_cp != MEM_CP_NULL)
+    {
+      jsp_mm_free (MEM_CP_GET_NON_NULL_POINTER (scopes_tree_lit_entry_t, chunks_p[i].lit_entries_cp));
+    }
+  }
+  if (chunks_p != NULL)
+  {
+    jsp_mm_free (chunks_p);
+  }
+  if (tree->var_decls_cp != MEM_CP_NULL)
+  {
+    jsp_mm_free (MEM_CP_GET_NON_NULL_POINTER (lit_cpointer_t, tree->var_decls_cp));
+  }
   jsp_mm_free (tree);
 }
@@ -60,9 +60,12 @@ typedef enum
 typedef struct
 {
   tree_header t; /**< header */
-  linked_list instrs; /**< instructions */
+  mem_cpointer_t instrs_chunks_cp; /**< array of chunks, holding the scope's instructions */
+  uint16_t instrs_chunks_capacity; /**< number of elements in the array of chunks */
   vm_instr_counter_t instrs_count; /**< count of instructions */
-  linked_list var_decls; /**< instructions for variable declarations */
+  mem_cpointer_t var_decls_cp; /**< array of literals, declared by the scope's var_decl instructions */
+  vm_instr_counter_t var_decls_capacity; /**< number of elements in the array of variable declarations */
+  vm_instr_counter_t var_decls_count; /**< count of variable declarations */
   scope_type_t type : 2; /**< scope type */
   bool strict_mode: 1; /**< flag, indicating that scope's code should be executed in strict mode */
   bool ref_arguments: 1; /**< flag, indicating that "arguments" variable is used inside the scope
@@ -90,6 +93,7 @@ void scopes_tree_set_op_meta (scopes_tree, vm_instr_counter_t, op_meta);
 void scopes_tree_set_instrs_num (scopes_tree, vm_instr_counter_t);
 op_meta scopes_tree_op_meta (scopes_tree, vm_instr_counter_t);
 op_meta scopes_tree_var_decl (scopes_tree, vm_instr_counter_t);
+void scopes_tree_remove_var_decl (scopes_tree, vm_instr_counter_t);
 void scopes_tree_remove_op_meta (scopes_tree tree, vm_instr_counter_t oc);
 size_t scopes_tree_count_literals_in_blocks (scopes_tree);
 vm_instr_counter_t scopes_tree_count_instructions (scopes_tree);
@@ -109,24 +109,23 @@ serializer_dump_subscope (scopes_tree tree) /**< scope to dump */
   bool header = true;
   for (instr_pos = 0; instr_pos < tree->instrs_count; instr_pos++)
   {
-    op_meta *om_p = (op_meta *) linked_list_element (tree->instrs, instr_pos);
-    if (om_p->op.op_idx != VM_OP_VAR_DECL
-        && om_p->op.op_idx != VM_OP_META && !header)
+    op_meta om = scopes_tree_op_meta (tree, instr_pos);
+    if (om.op.op_idx != VM_OP_VAR_DECL
+        && om.op.op_idx != VM_OP_META && !header)
     {
       break;
     }
-    if (om_p->op.op_idx == VM_OP_REG_VAR_DECL)
+    if (om.op.op_idx == VM_OP_REG_VAR_DECL)
     {
       header = false;
     }
-    scopes_tree_add_op_meta (current_scope, *om_p);
+    scopes_tree_add_op_meta (current_scope, om);
   }
   for (vm_instr_counter_t var_decl_pos = 0;
-       var_decl_pos < linked_list_get_length (tree->var_decls);
+       var_decl_pos < scopes_tree_var_decls_num (tree);
        var_decl_pos++)
   {
-    op_meta *om_p = (op_meta *) linked_list_element (tree->var_decls, var_decl_pos);
-    scopes_tree_add_op_meta (current_scope, *om_p);
+    scopes_tree_add_op_meta (current_scope, scopes_tree_var_decl (tree, var_decl_pos));
   }
   for (uint8_t child_id = 0; child_id < tree->t.children_num; child_id++)
   {
@@ -134,8 +133,7 @@ serializer_dump_subscope (scopes_tree tree) /**< scope to dump */
   }
   for (; instr_pos < tree->instrs_count; instr_pos++)
   {
-    op_meta *om_p = (op_meta *) linked_list_element (tree->instrs, instr_pos);
-    scopes_tree_add_op_meta (current_scope, *om_p);
+    scopes_tree_add_op_meta (current_scope, scopes_tree_op_meta (tree, instr_pos));
   }
 } /* serializer_dump_subscope */
 
@@ -146,8 +144,18 @@ serializer_dump_subscope (scopes_tree tree) /**< scope to dump */
  * @return pointer to generated bytecode
  */
 const bytecode_data_header_t *
-serializer_merge_scopes_into_bytecode (void)
+serializer_merge_scopes_into_bytecode (const lit_utf8_byte_t *source_p, /**< source buffer, to which ranges of
+                                                                           *   lazy functions' source text are
+                                                                           *   relative (NULL - if there are
+                                                                           *   no lazy functions in the scopes) */
+                                       const bytecode_source_range_t *source_ranges_p, /**< table of source ranges,
+                                                                                        *   referenced by lazy
+                                                                                        *   functions' 'meta'
+                                                                                        *   instructions */
+                                       uint32_t source_ranges_count) /**< number of ranges in the table */
 {
+  JERRY_ASSERT ((source_p != NULL) == (source_ranges_count != 0));
+
   const size_t buckets_count = scopes_tree_count_literals_in_blocks (current_scope);
   const vm_instr_counter_t instrs_count = scopes_tree_count_instructions (current_scope);
   const size_t blocks_count = JERRY_ALIGNUP (instrs_count, BLOCK_SIZE) / BLOCK_SIZE;
@@ -156,8 +164,9 @@ serializer_merge_scopes_into_bytecode (void)
   const size_t hash_table_size = lit_id_hash_table_get_size_for_table (buckets_count, blocks_count);
   const size_t header_and_hash_table_size = JERRY_ALIGNUP (sizeof (bytecode_data_header_t) + hash_table_size,
                                                            MEM_ALIGNMENT);
+  const size_t source_ranges_size = source_ranges_count * sizeof (bytecode_source_range_t);
 
-  uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (bytecode_size + header_and_hash_table_size,
+  uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (bytecode_size + header_and_hash_table_size + source_ranges_size,
                                                        MEM_HEAP_ALLOC_LONG_TERM);
 
   lit_id_hash_table *lit_id_hash = lit_id_hash_table_init (buffer_p + sizeof (bytecode_data_header_t),
@@ -174,6 +183,20 @@ serializer_merge_scopes_into_bytecode (void)
   header_p->instrs_p = bytecode_p;
   header_p->instrs_count = instrs_count;
   MEM_CP_SET_POINTER (header_p->next_header_cp, first_bytecode_header_p);
+  header_p->source_p = source_p;
+
+  if (source_ranges_count != 0)
+  {
+    bytecode_source_range_t *ranges_p;
+    ranges_p = (bytecode_source_range_t *) (buffer_p + header_and_hash_table_size + bytecode_size);
+
+    memcpy (ranges_p, source_ranges_p, source_ranges_size);
+    header_p->source_ranges_p = ranges_p;
+  }
+  else
+  {
+    header_p->source_ranges_p = NULL;
+  }
 
   first_bytecode_header_p = header_p;
 
@@ -208,7 +231,7 @@ void
 serializer_dump_var_decl (op_meta op) /**< variable declaration instruction */
 {
   JERRY_ASSERT (scopes_tree_instrs_num (current_scope)
-                + linked_list_get_length (current_scope->var_decls) < MAX_OPCODES);
+                + scopes_tree_var_decls_num (current_scope) < MAX_OPCODES);
 
   scopes_tree_add_var_decl (current_scope, op);
 } /* serializer_dump_var_decl */
@@ -276,6 +299,65 @@ serializer_init ()
   lit_init ();
 }
 
+/**
+ * Add memory regions, containing serializer's state, to list of heap image's regions
+ */
+void
+serializer_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  mem_image_regions_add (regions_p, &first_bytecode_header_p, sizeof (first_bytecode_header_p));
+
+  lit_get_image_regions (regions_p);
+} /* serializer_get_image_regions */
+
+/**
+ * Check whether all byte-code data is placed in the heap
+ *
+ * Note:
+ *      byte-code, loaded from snapshots without copying, references the snapshot buffer,
+ *      and byte-code, parsed in lazy functions mode, references the script's source buffer,
+ *      and so, can't be saved to a heap image
+ *
+ * @return true - if the byte-code doesn't reference memory outside of the heap,
+ *         false - otherwise
+ */
+bool
+serializer_is_bytecode_in_heap (void)
+{
+  for (bytecode_data_header_t *header_p = first_bytecode_header_p;
+       header_p != NULL;
+       header_p = MEM_CP_GET_POINTER (bytecode_data_header_t, header_p->next_header_cp))
+  {
+    if (!mem_is_heap_pointer (header_p->instrs_p)
+        || header_p->source_p != NULL)
+    {
+      return false;
+    }
+
+    lit_id_hash_table *lit_id_hash = MEM_CP_GET_POINTER (lit_id_hash_table, header_p->lit_id_hash_cp);
+
+    if (lit_id_hash != null_hash
+        && !lit_id_hash_table_is_in_heap (lit_id_hash))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* serializer_is_bytecode_in_heap */
+
+/**
+ * Initialize serializer after its state was restored from a heap image
+ */
+void
+serializer_init_from_image (void)
+{
+  current_scope = NULL;
+  print_instrs = false;
+
+  lit_init_from_image ();
+} /* serializer_init_from_image */
+
 void serializer_set_show_instrs (bool show_instrs)
 {
   print_instrs = show_instrs;
@@ -312,6 +394,33 @@ serializer_remove_bytecode_data (const bytecode_data_header_t *bytecode_data_p)
   }
 } /* serializer_remove_instructions */
 
+/**
+ * Free literals that are used neither by any of the byte-code arrays, nor by ecma-strings
+ *
+ * Note:
+ *      should not be called during parse, as literals of currently parsed code
+ *      are not yet registered in any byte-code array
+ *
+ * @return number of freed literals
+ */
+uint32_t
+serializer_free_unused_literals (void)
+{
+  for (bytecode_data_header_t *header_p = first_bytecode_header_p;
+       header_p != NULL;
+       header_p = MEM_CP_GET_POINTER (bytecode_data_header_t, header_p->next_header_cp))
+  {
+    lit_id_hash_table *lit_id_hash = MEM_CP_GET_POINTER (lit_id_hash_table, header_p->lit_id_hash_cp);
+
+    if (lit_id_hash != null_hash)
+    {
+      lit_id_hash_table_mark_literals (lit_id_hash);
+    }
+  }
+
+  return lit_free_unmarked_literals ();
+} /* serializer_free_unused_literals */
+
 void
 serializer_free (void)
 {
@@ -348,8 +457,6 @@ serializer_dump_bytecode_with_idx_map (uint8_t *buffer_p, /**< buffer to dump to
                                        uint32_t *out_idx_to_lit_map_size_p) /**< out: side of dumped
                                                                              *        idx to literals map */
 {
-  JERRY_ASSERT (bytecode_data_p->next_header_cp == MEM_CP_NULL);
-
   vm_instr_counter_t instrs_num = bytecode_data_p->instrs_count;
 
   const size_t instrs_array_size = sizeof (vm_instr_t) * instrs_num;
@@ -387,8 +494,8 @@ serializer_dump_bytecode_with_idx_map (uint8_t *buffer_p, /**< buffer to dump to
  * Register bytecode and idx map from snapshot
  *
  * NOTE:
- *      If is_copy flag is set, bytecode is copied from snapshot, else bytecode is referenced directly
- *      from snapshot
+ *      If is_copy flag is set, bytecode and idx to literals map are copied from snapshot, else they are
+ *      referenced directly from snapshot, so the snapshot buffer could be a read-only mapping of a file
  *
  * @return pointer to byte-code header, upon success,
  *         NULL - upon failure (i.e., in case snapshot format is not valid)
@@ -415,30 +522,42 @@ serializer_load_bytecode_with_idx_map (const uint8_t *bytecode_and_idx_map_p, /*
   size_t instructions_number = bytecode_size / sizeof (vm_instr_t);
   size_t blocks_count = JERRY_ALIGNUP (instructions_number, BLOCK_SIZE) / BLOCK_SIZE;
 
-  uint32_t idx_num_total;
-  size_t idx_to_lit_map_offset = 0;
-  if (!jrt_read_from_buffer_by_offset (idx_to_lit_map_p,
-                                       idx_to_lit_map_size,
-                                       &idx_to_lit_map_offset,
-                                       &idx_num_total))
+  if ((vm_instr_counter_t) instructions_number != instructions_number)
   {
     return NULL;
   }
 
+  /*
+   * The idx-to-literal map is referenced in place, unless copy is requested
+   * or the snapshot buffer is not aligned enough for the map to be read directly
+   */
+  const bool is_idx_map_copy = (is_copy || ((uintptr_t) idx_to_lit_map_p) % sizeof (uint32_t) != 0);
+
   const size_t bytecode_alloc_size = JERRY_ALIGNUP (bytecode_size, MEM_ALIGNMENT);
-  const size_t hash_table_size = lit_id_hash_table_get_size_for_table (idx_num_total, blocks_count);
+  const size_t idx_to_lit_map_alloc_size = JERRY_ALIGNUP (idx_to_lit_map_size, MEM_ALIGNMENT);
+  const size_t hash_table_size = lit_id_hash_table_get_size_for_snapshot_table (literals_num);
   const size_t header_and_hash_table_size = JERRY_ALIGNUP (sizeof (bytecode_data_header_t) + hash_table_size,
                                                            MEM_ALIGNMENT);
-  const size_t alloc_size = header_and_hash_table_size + (is_copy ? bytecode_alloc_size : 0);
+  const size_t alloc_size = (header_and_hash_table_size
+                             + (is_idx_map_copy ? idx_to_lit_map_alloc_size : 0)
+                             + (is_copy ? bytecode_alloc_size : 0));
 
   uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (alloc_size, MEM_HEAP_ALLOC_LONG_TERM);
   bytecode_data_header_t *header_p = (bytecode_data_header_t *) buffer_p;
 
+  if (is_idx_map_copy)
+  {
+    uint8_t *idx_to_lit_map_copy_p = buffer_p + header_and_hash_table_size;
+    memcpy (idx_to_lit_map_copy_p, idx_to_lit_map_p, idx_to_lit_map_size);
+
+    idx_to_lit_map_p = idx_to_lit_map_copy_p;
+  }
+
   vm_instr_t *instrs_p;
   vm_instr_t *snapshot_instrs_p = (vm_instr_t *) bytecode_and_idx_map_p;
   if (is_copy)
   {
-    instrs_p = (vm_instr_t *) (buffer_p + header_and_hash_table_size);
+    instrs_p = (vm_instr_t *) (buffer_p + header_and_hash_table_size + idx_to_lit_map_alloc_size);
     memcpy (instrs_p, snapshot_instrs_p, bytecode_size);
   }
   else
@@ -447,20 +566,22 @@ serializer_load_bytecode_with_idx_map (const uint8_t *bytecode_and_idx_map_p, /*
   }
 
   uint8_t *lit_id_hash_table_buffer_p = buffer_p + sizeof (bytecode_data_header_t);
-  if (lit_id_hash_table_load_from_snapshot (blocks_count,
-                                            idx_num_total,
-                                            idx_to_lit_map_p + idx_to_lit_map_offset,
-                                            idx_to_lit_map_size - idx_to_lit_map_offset,
-                                            lit_map_p,
-                                            literals_num,
-                                            lit_id_hash_table_buffer_p,
-                                            hash_table_size)
-      && (vm_instr_counter_t) instructions_number == instructions_number)
-  {
-    MEM_CP_SET_NON_NULL_POINTER (header_p->lit_id_hash_cp, lit_id_hash_table_buffer_p);
+  lit_id_hash_table *lit_id_hash_p = lit_id_hash_table_load_from_snapshot (blocks_count,
+                                                                           idx_to_lit_map_p,
+                                                                           idx_to_lit_map_size,
+                                                                           lit_map_p,
+                                                                           literals_num,
+                                                                           lit_id_hash_table_buffer_p,
+                                                                           hash_table_size);
+
+  if (lit_id_hash_p != NULL)
+  {
+    MEM_CP_SET_NON_NULL_POINTER (header_p->lit_id_hash_cp, lit_id_hash_p);
     header_p->instrs_p = instrs_p;
     header_p->instrs_count = (vm_instr_counter_t) instructions_number;
     MEM_CP_SET_POINTER (header_p->next_header_cp, first_bytecode_header_p);
+    header_p->source_p = NULL;
+    header_p->source_ranges_p = NULL;
 
     first_bytecode_header_p = header_p;
 
@@ -473,4 +594,175 @@ serializer_load_bytecode_with_idx_map (const uint8_t *bytecode_and_idx_map_p, /*
   }
 } /* serializer_load_bytecode_with_idx_map */
 
+/**
+ * Get literals, referenced by byte-code
+ *
+ * @return number of the literals
+ */
+uint32_t
+serializer_get_bytecode_literals (const bytecode_data_header_t *bytecode_data_p, /**< byte-code data */
+                                  lit_cpointer_t *out_lit_cps_p, /**< out: buffer for identifiers of the literals */
+                                  uint32_t buffer_size) /**< number of identifiers the buffer can hold */
+{
+  lit_id_hash_table *lit_id_hash_p = MEM_CP_GET_POINTER (lit_id_hash_table, bytecode_data_p->lit_id_hash_cp);
+
+  if (lit_id_hash_p == null_hash)
+  {
+    return 0;
+  }
+
+  return lit_id_hash_table_get_literals (lit_id_hash_p, out_lit_cps_p, buffer_size);
+} /* serializer_get_bytecode_literals */
+
+/**
+ * Numbers of arguments of instructions, indexed by opcode
+ */
+static const uint8_t serializer_instr_args_num[] =
+{
+#define VM_OP_0(opcode_name, opcode_name_uppercase) \
+  0,
+#define VM_OP_1(opcode_name, opcode_name_uppercase, arg1, arg1_type) \
+  1,
+#define VM_OP_2(opcode_name, opcode_name_uppercase, arg1, arg1_type, arg2, arg2_type) \
+  2,
+#define VM_OP_3(opcode_name, opcode_name_uppercase, arg1, arg1_type, arg2, arg2_type, arg3, arg3_type) \
+  3,
+
+#include "vm-opcodes.inc.h"
+};
+
+JERRY_STATIC_ASSERT (sizeof (serializer_instr_args_num) == VM_OP__COUNT);
+
+/**
+ * Encode byte-code and idx-to-literal map, dumped to snapshot, in compact form
+ *
+ * In the compact form, each instruction is stored as its opcode, followed only by the arguments,
+ * that are used by the opcode (see also: lit_id_hash_table_encode_snapshot_map_compact).
+ *
+ * @return true, upon success (i.e. the byte-code is valid and buffer size is sufficient),
+ *         false - otherwise.
+ */
+bool
+serializer_encode_bytecode_with_idx_map_compact (const uint8_t *bytecode_and_idx_map_p, /**< instructions array
+                                                                                         *   and idx to literals
+                                                                                         *   map from snapshot */
+                                                 uint32_t bytecode_size, /**< size of instructions array */
+                                                 uint32_t idx_to_lit_map_size, /**< size of the idx to literals map */
+                                                 uint8_t *buffer_p, /**< buffer to encode to */
+                                                 size_t buffer_size, /**< buffer size */
+                                                 size_t *in_out_buffer_offset_p) /**< in-out: buffer write offset */
+{
+  if (bytecode_size % sizeof (vm_instr_t) != 0)
+  {
+    return false;
+  }
+
+  size_t instructions_number = bytecode_size / sizeof (vm_instr_t);
+
+  for (size_t instr_index = 0; instr_index < instructions_number; instr_index++)
+  {
+    vm_instr_t instr;
+    memcpy (&instr, bytecode_and_idx_map_p + instr_index * sizeof (vm_instr_t), sizeof (vm_instr_t));
+
+    if (instr.op_idx >= VM_OP__COUNT
+        || !jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, instr.op_idx))
+    {
+      return false;
+    }
+
+    for (uint8_t arg_index = 0; arg_index < serializer_instr_args_num[instr.op_idx]; arg_index++)
+    {
+      if (!jrt_write_to_buffer_by_offset (buffer_p,
+                                          buffer_size,
+                                          in_out_buffer_offset_p,
+                                          instr.data.raw_args[arg_index]))
+      {
+        return false;
+      }
+    }
+  }
+
+  size_t blocks_count = JERRY_ALIGNUP (instructions_number, BLOCK_SIZE) / BLOCK_SIZE;
+
+  return lit_id_hash_table_encode_snapshot_map_compact (bytecode_and_idx_map_p + bytecode_size,
+                                                        idx_to_lit_map_size,
+                                                        blocks_count,
+                                                        buffer_p,
+                                                        buffer_size,
+                                                        in_out_buffer_offset_p);
+} /* serializer_encode_bytecode_with_idx_map_compact */
+
+/**
+ * Decode byte-code and idx-to-literal map from compact form
+ * (see also: serializer_encode_bytecode_with_idx_map_compact)
+ *
+ * Note:
+ *      arguments, not used by instructions' opcodes, are set to VM_IDX_EMPTY
+ *
+ * @return true, upon success (i.e. the encoded data is valid and corresponds to the specified sizes),
+ *         false - otherwise.
+ */
+bool
+serializer_decode_bytecode_with_idx_map_compact (const uint8_t *encoded_p, /**< encoded data */
+                                                 size_t encoded_size, /**< size of encoded data */
+                                                 uint32_t bytecode_size, /**< size of instructions array */
+                                                 uint32_t idx_to_lit_map_size, /**< size of the idx to literals map */
+                                                 uint8_t *out_bytecode_and_idx_map_p) /**< out: instructions array
+                                                                                       *   and idx to literals
+                                                                                       *   map (buffer of
+                                                                                       *   bytecode_size +
+                                                                                       *   idx_to_lit_map_size
+                                                                                       *   bytes) */
+{
+  if (bytecode_size % sizeof (vm_instr_t) != 0)
+  {
+    return false;
+  }
+
+  size_t instructions_number = bytecode_size / sizeof (vm_instr_t);
+  size_t encoded_offset = 0;
+
+  for (size_t instr_index = 0; instr_index < instructions_number; instr_index++)
+  {
+    vm_instr_t instr;
+
+    if (!jrt_read_from_buffer_by_offset (encoded_p, encoded_size, &encoded_offset, &instr.op_idx)
+        || instr.op_idx >= VM_OP__COUNT)
+    {
+      return false;
+    }
+
+    uint8_t args_num = serializer_instr_args_num[instr.op_idx];
+
+    for (uint8_t arg_index = 0;
+         arg_index < sizeof (instr.data.raw_args) / sizeof (instr.data.raw_args[0]);
+         arg_index++)
+    {
+      if (arg_index >= args_num)
+      {
+        instr.data.raw_args[arg_index] = VM_IDX_EMPTY;
+      }
+      else if (!jrt_read_from_buffer_by_offset (encoded_p,
+                                                encoded_size,
+                                                &encoded_offset,
+                                                &instr.data.raw_args[arg_index]))
+      {
+        return false;
+      }
+    }
+
+    memcpy (out_bytecode_and_idx_map_p + instr_index * sizeof (vm_instr_t), &instr, sizeof (vm_instr_t));
+  }
+
+  size_t blocks_count = JERRY_ALIGNUP (instructions_number, BLOCK_SIZE) / BLOCK_SIZE;
+
+  return (lit_id_hash_table_decode_snapshot_map_compact (encoded_p,
+                                                         encoded_size,
+                                                         &encoded_offset,
+                                                         blocks_count,
+                                                         out_bytecode_and_idx_map_p + bytecode_size,
+                                                         idx_to_lit_map_size)
+          && encoded_offset == encoded_size);
+} /* serializer_decode_bytecode_with_idx_map_compact */
+
 #endif /* JERRY_ENABLE_SNAPSHOT */
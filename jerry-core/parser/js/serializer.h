@@ -32,7 +32,9 @@ vm_instr_t serializer_get_instr (const bytecode_data_header_t *, vm_instr_counte
 lit_cpointer_t serializer_get_literal_cp_by_uid (uint8_t, const bytecode_data_header_t *, vm_instr_counter_t);
 void serializer_set_scope (scopes_tree);
 void serializer_dump_subscope (scopes_tree);
-const bytecode_data_header_t *serializer_merge_scopes_into_bytecode (void);
+const bytecode_data_header_t *serializer_merge_scopes_into_bytecode (const lit_utf8_byte_t *,
+                                                                     const bytecode_source_range_t *,
+                                                                     uint32_t);
 void serializer_dump_op_meta (op_meta);
 void serializer_dump_var_decl (op_meta);
 vm_instr_counter_t serializer_get_current_instr_counter (void);
@@ -40,7 +42,11 @@ vm_instr_counter_t serializer_count_instrs_in_subscopes (void);
 void serializer_set_writing_position (vm_instr_counter_t);
 void serializer_rewrite_op_meta (vm_instr_counter_t, op_meta);
 void serializer_remove_bytecode_data (const bytecode_data_header_t *);
+uint32_t serializer_free_unused_literals (void);
 void serializer_free (void);
+void serializer_get_image_regions (mem_image_regions_t *);
+bool serializer_is_bytecode_in_heap (void);
+void serializer_init_from_image (void);
 
 #ifdef JERRY_ENABLE_SNAPSHOT
 /*
@@ -53,6 +59,11 @@ bool serializer_dump_bytecode_with_idx_map (uint8_t *, size_t, size_t *, const b
 const bytecode_data_header_t *
 serializer_load_bytecode_with_idx_map (const uint8_t *, uint32_t, uint32_t,
                                        const lit_mem_to_snapshot_id_map_entry_t *, uint32_t, bool);
+
+uint32_t serializer_get_bytecode_literals (const bytecode_data_header_t *, lit_cpointer_t *, uint32_t);
+
+bool serializer_encode_bytecode_with_idx_map_compact (const uint8_t *, uint32_t, uint32_t, uint8_t *, size_t, size_t *);
+bool serializer_decode_bytecode_with_idx_map_compact (const uint8_t *, size_t, uint32_t, uint32_t, uint8_t *);
 #endif /* JERRY_ENABLE_SNAPSHOT */
 
 #endif /* SERIALIZER_H */
@@ -148,14 +148,21 @@ rcs_chunked_list_t::insert_new (rcs_chunked_list_t::node_t* after_p) /**< the no
   JERRY_ASSERT (tail_p != NULL);
   assert_node_is_correct (after_p);
 
+  node_t *next_node_p = get_next (after_p);
+
   set_next (after_p, node_p);
   if (tail_p == after_p)
   {
+    JERRY_ASSERT (next_node_p == NULL);
     tail_p = node_p;
   }
+  else
+  {
+    set_prev (next_node_p, node_p);
+  }
 
   set_prev (node_p, after_p);
-  set_next (node_p, NULL);
+  set_next (node_p, next_node_p);
 
   assert_node_is_correct (node_p);
 
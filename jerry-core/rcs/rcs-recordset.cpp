@@ -274,6 +274,7 @@ rcs_recordset_t::alloc_record_in_place (rcs_record_t* place_p, /**< where to ini
       }
 
       init_free_record (free_rec_p, free_size, place_p);
+      set_prev (next_record_p, free_rec_p);
     }
   }
   else if (free_size != 0)
@@ -425,7 +426,7 @@ rcs_recordset_t::alloc_space_for_record (size_t bytes, /**< size */
       }
       else
       {
-        JERRY_ASSERT (!is_record_free (rec_p));
+        JERRY_ASSERT (!is_record_free (next_rec_p));
       }
     }
   }
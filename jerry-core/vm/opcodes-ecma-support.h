@@ -37,6 +37,6 @@
 bool vm_is_reg_variable (vm_idx_t);
 ecma_completion_value_t get_variable_value (vm_frame_ctx_t *, vm_idx_t, bool);
 ecma_completion_value_t set_variable_value (vm_frame_ctx_t *, vm_instr_counter_t, vm_idx_t, ecma_value_t);
-ecma_completion_value_t vm_fill_varg_list (vm_frame_ctx_t *, ecma_length_t, ecma_collection_header_t *);
+ecma_completion_value_t vm_fill_varg_list (vm_frame_ctx_t *, ecma_length_t, ecma_value_t[], ecma_length_t *);
 extern void vm_fill_params_list (vm_frame_ctx_t *, ecma_length_t, ecma_collection_header_t *);
 #endif /* OPCODES_ECMA_SUPPORT_H */
@@ -22,6 +22,11 @@
 /**
  * Fill arguments' list
  *
+ * Note:
+ *      the values, written to the list, should be freed with ecma_free_value
+ *      (including the case, when an argument's evaluation completed abruptly,
+ *       as the arguments, evaluated before, are already placed into the list)
+ *
  * @return empty completion value if argument list was filled successfully,
  *         otherwise - not normal completion value indicating completion type
  *         of last expression evaluated
@@ -29,14 +34,14 @@
 ecma_completion_value_t
 vm_fill_varg_list (vm_frame_ctx_t *frame_ctx_p, /**< interpreter context */
                    ecma_length_t args_number, /**< number of arguments */
-                   ecma_collection_header_t *arg_collection_p) /** collection to fill with argument values */
+                   ecma_value_t arg_values[], /**< out: arguments' values
+                                               *        (should have space for args_number values) */
+                   ecma_length_t *out_arg_number_p) /**< out: number of arguments, successfully evaluated */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  ecma_length_t arg_index;
-  for (arg_index = 0;
-       arg_index < args_number && ecma_is_completion_value_empty (ret_value);
-       arg_index++)
+  ecma_length_t arg_index = 0;
+  while (arg_index < args_number && ecma_is_completion_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (evaluate_arg,
                     vm_loop (frame_ctx_p, NULL),
@@ -52,9 +57,7 @@ vm_fill_varg_list (vm_frame_ctx_t *frame_ctx_p, /**< interpreter context */
                     get_variable_value (frame_ctx_p, varg_var_idx, false),
                     ret_value);
 
-    ecma_append_to_values_collection (arg_collection_p,
-                                      ecma_get_completion_value_value (get_arg_completion),
-                                      true);
+    arg_values[arg_index++] = ecma_copy_value (ecma_get_completion_value_value (get_arg_completion), true);
 
     ECMA_FINALIZE (get_arg);
 
@@ -63,6 +66,8 @@ vm_fill_varg_list (vm_frame_ctx_t *frame_ctx_p, /**< interpreter context */
     ECMA_FINALIZE (evaluate_arg);
   }
 
+  *out_arg_number_p = arg_index;
+
   return ret_value;
 } /* vm_fill_varg_list */
 
@@ -477,37 +477,57 @@ opfunc_var_decl (vm_instr_t instr, /**< instruction */
 } /* opfunc_var_decl */
 
 /**
- * Function declaration helper
+ * Get template of function, described by currently executed 'Function declaration' / 'Function expression'
+ * instruction (see also: ecma_op_create_function_template)
  *
- * @return completion value
- *         returned value must be freed with ecma_free_completion_value.
+ * Note:
+ *      upon call, the frame's position should point to first instruction after the function
+ *      declaration / expression instruction, and upon return, the position points
+ *      to first instruction of the function's code
+ *
+ * @return pointer to the template (the reference should be released with ecma_deref_object)
  */
-static ecma_completion_value_t
-function_declaration (vm_frame_ctx_t *frame_ctx_p, /**< interpreter context */
-                      lit_cpointer_t function_name_lit_cp, /**< compressed pointer to literal with function name */
-                      ecma_collection_header_t *formal_params_collection_p) /** formal parameters collection */
+static ecma_object_t *
+vm_get_function_template (vm_frame_ctx_t *frame_ctx_p, /**< interpreter context */
+                          ecma_length_t params_number, /**< number of the function's formal parameters */
+                          vm_instr_counter_t *out_function_code_end_oc_p) /**< out: position of first instruction
+                                                                          *        after the function's code */
 {
-  const bool is_configurable_bindings = frame_ctx_p->is_eval_code;
+  const vm_instr_counter_t params_oc = frame_ctx_p->pos;
 
-  const vm_instr_counter_t function_code_end_oc = (vm_instr_counter_t) (
-    vm_read_instr_counter_from_meta (OPCODE_META_TYPE_FUNCTION_END, frame_ctx_p) + frame_ctx_p->pos);
+  frame_ctx_p->pos = (vm_instr_counter_t) (frame_ctx_p->pos + params_number);
+
+  *out_function_code_end_oc_p = (vm_instr_counter_t) (vm_read_instr_counter_from_meta (OPCODE_META_TYPE_FUNCTION_END,
+                                                                                       frame_ctx_p)
+                                                      + frame_ctx_p->pos);
   frame_ctx_p->pos++;
 
-  ecma_string_t *function_name_string_p = ecma_new_ecma_string_from_lit_cp (function_name_lit_cp);
+  const vm_instr_counter_t function_first_instr_pos = frame_ctx_p->pos;
 
-  ecma_completion_value_t ret_value = ecma_op_function_declaration (frame_ctx_p->lex_env_p,
-                                                                    function_name_string_p,
-                                                                    frame_ctx_p->bytecode_header_p,
-                                                                    frame_ctx_p->pos,
-                                                                    formal_params_collection_p,
-                                                                    frame_ctx_p->is_strict,
-                                                                    is_configurable_bindings);
-  ecma_deref_ecma_string (function_name_string_p);
+  ecma_object_t *template_p = ecma_op_function_template_cache_lookup (frame_ctx_p->bytecode_header_p,
+                                                                      function_first_instr_pos);
 
-  frame_ctx_p->pos = function_code_end_oc;
+  if (template_p == NULL)
+  {
+    ecma_collection_header_t *formal_params_collection_p = NULL;
 
-  return ret_value;
-} /* function_declaration */
+    if (params_number != 0)
+    {
+      formal_params_collection_p = ecma_new_strings_collection (NULL, 0);
+
+      frame_ctx_p->pos = params_oc;
+      vm_fill_params_list (frame_ctx_p, params_number, formal_params_collection_p);
+      frame_ctx_p->pos = function_first_instr_pos;
+    }
+
+    template_p = ecma_op_create_function_template (formal_params_collection_p,
+                                                   frame_ctx_p->is_strict,
+                                                   frame_ctx_p->bytecode_header_p,
+                                                   function_first_instr_pos);
+  }
+
+  return template_p;
+} /* vm_get_function_template */
 
 /**
  * 'Function declaration' opcode handler.
@@ -528,24 +548,22 @@ opfunc_func_decl_n (vm_instr_t instr, /**< instruction */
 
   frame_ctx_p->pos++;
 
-  ecma_completion_value_t ret_value;
+  const bool is_configurable_bindings = frame_ctx_p->is_eval_code;
 
-  ecma_collection_header_t *formal_params_collection_p;
+  vm_instr_counter_t function_code_end_oc;
+  ecma_object_t *template_p = vm_get_function_template (frame_ctx_p, params_number, &function_code_end_oc);
 
-  if (params_number != 0)
-  {
-    formal_params_collection_p = ecma_new_strings_collection (NULL, 0);
+  ecma_string_t *function_name_string_p = ecma_new_ecma_string_from_lit_cp (function_name_lit_cp);
 
-    vm_fill_params_list (frame_ctx_p, params_number, formal_params_collection_p);
-  }
-  else
-  {
-    formal_params_collection_p = NULL;
-  }
+  ecma_completion_value_t ret_value = ecma_op_function_declaration (frame_ctx_p->lex_env_p,
+                                                                    function_name_string_p,
+                                                                    template_p,
+                                                                    frame_ctx_p->is_strict,
+                                                                    is_configurable_bindings);
+  ecma_deref_ecma_string (function_name_string_p);
+  ecma_deref_object (template_p);
 
-  ret_value = function_declaration (frame_ctx_p,
-                                    function_name_lit_cp,
-                                    formal_params_collection_p);
+  frame_ctx_p->pos = function_code_end_oc;
 
   return ret_value;
 } /* opfunc_func_decl_n */
@@ -572,23 +590,7 @@ opfunc_func_expr_n (vm_instr_t instr, /**< instruction */
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
   vm_instr_counter_t function_code_end_oc;
-
-  ecma_collection_header_t *formal_params_collection_p;
-
-  if (params_number != 0)
-  {
-    formal_params_collection_p = ecma_new_strings_collection (NULL, 0);
-
-    vm_fill_params_list (frame_ctx_p, params_number, formal_params_collection_p);
-  }
-  else
-  {
-    formal_params_collection_p = NULL;
-  }
-
-  function_code_end_oc = (vm_instr_counter_t) (vm_read_instr_counter_from_meta (OPCODE_META_TYPE_FUNCTION_END,
-                                                                                frame_ctx_p) + frame_ctx_p->pos);
-  frame_ctx_p->pos++;
+  ecma_object_t *template_p = vm_get_function_template (frame_ctx_p, params_number, &function_code_end_oc);
 
   ecma_object_t *scope_p;
   ecma_string_t *function_name_string_p = NULL;
@@ -610,11 +612,7 @@ opfunc_func_expr_n (vm_instr_t instr, /**< instruction */
     ecma_ref_object (scope_p);
   }
 
-  ecma_object_t *func_obj_p = ecma_op_create_function_object (formal_params_collection_p,
-                                                              scope_p,
-                                                              frame_ctx_p->is_strict,
-                                                              frame_ctx_p->bytecode_header_p,
-                                                              frame_ctx_p->pos);
+  ecma_object_t *func_obj_p = ecma_op_create_function_object (template_p, scope_p);
 
   ret_value = set_variable_value (frame_ctx_p, lit_oc,
                                   dst_var_idx,
@@ -630,6 +628,7 @@ opfunc_func_expr_n (vm_instr_t instr, /**< instruction */
 
   ecma_deref_object (func_obj_p);
   ecma_deref_object (scope_p);
+  ecma_deref_object (template_p);
 
   frame_ctx_p->pos = function_code_end_oc;
 
@@ -781,12 +780,13 @@ opfunc_call_n (vm_instr_t instr, /**< instruction */
                                                                         function_var_idx,
                                                                         &call_flags);
 
-  ecma_collection_header_t *arg_collection_p = ecma_new_values_collection (NULL, 0, true);
+  ecma_value_t *arg_values = vm_stack_frame_alloc_args (&frame_ctx_p->stack_frame, args_number_idx);
 
+  ecma_length_t args_read;
   ecma_completion_value_t get_arg_completion = vm_fill_varg_list (frame_ctx_p,
                                                                   args_number_idx,
-                                                                  arg_collection_p);
-  ecma_length_t args_read = arg_collection_p->unit_number;
+                                                                  arg_values,
+                                                                  &args_read);
 
   if (ecma_is_completion_value_empty (get_arg_completion))
   {
@@ -808,7 +808,8 @@ opfunc_call_n (vm_instr_t instr, /**< instruction */
       ECMA_TRY_CATCH (call_ret_value,
                       ecma_op_function_call (func_obj_p,
                                              this_value,
-                                             arg_collection_p),
+                                             arg_values,
+                                             args_read),
                       ret_value);
 
       ret_value = set_variable_value (frame_ctx_p, lit_oc,
@@ -835,7 +836,15 @@ opfunc_call_n (vm_instr_t instr, /**< instruction */
     ret_value = get_arg_completion;
   }
 
-  ecma_free_values_collection (arg_collection_p, true);
+  for (ecma_length_t arg_index = 0;
+       arg_index < args_read;
+       arg_index++)
+  {
+    ecma_free_value (arg_values[arg_index], true);
+  }
+
+  vm_stack_frame_free_args (&frame_ctx_p->stack_frame, arg_values, args_number_idx);
+
   ecma_free_value (this_value, true);
 
   ECMA_FINALIZE (func_value);
@@ -868,12 +877,13 @@ opfunc_construct_n (vm_instr_t instr, /**< instruction */
 
   frame_ctx_p->pos++;
 
-  ecma_collection_header_t *arg_collection_p = ecma_new_values_collection (NULL, 0, true);
+  ecma_value_t *arg_values = vm_stack_frame_alloc_args (&frame_ctx_p->stack_frame, args_number);
 
+  ecma_length_t args_read;
   ecma_completion_value_t get_arg_completion = vm_fill_varg_list (frame_ctx_p,
                                                                   args_number,
-                                                                  arg_collection_p);
-  ecma_length_t args_read = arg_collection_p->unit_number;
+                                                                  arg_values,
+                                                                  &args_read);
 
   if (ecma_is_completion_value_empty (get_arg_completion))
   {
@@ -889,7 +899,8 @@ opfunc_construct_n (vm_instr_t instr, /**< instruction */
 
       ECMA_TRY_CATCH (construction_ret_value,
                       ecma_op_function_construct (constructor_obj_p,
-                                                  arg_collection_p),
+                                                  arg_values,
+                                                  args_read),
                       ret_value);
 
       ret_value = set_variable_value (frame_ctx_p, lit_oc, lhs_var_idx,
@@ -905,7 +916,14 @@ opfunc_construct_n (vm_instr_t instr, /**< instruction */
     ret_value = get_arg_completion;
   }
 
-  ecma_free_values_collection (arg_collection_p, true);
+  for (ecma_length_t arg_index = 0;
+       arg_index < args_read;
+       arg_index++)
+  {
+    ecma_free_value (arg_values[arg_index], true);
+  }
+
+  vm_stack_frame_free_args (&frame_ctx_p->stack_frame, arg_values, args_number);
 
   ECMA_FINALIZE (constructor_value);
 
@@ -936,30 +954,18 @@ opfunc_array_decl (vm_instr_t instr, /**< instruction */
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  ecma_collection_header_t *arg_collection_p = ecma_new_values_collection (NULL, 0, true);
+  ecma_value_t *arg_values = vm_stack_frame_alloc_args (&frame_ctx_p->stack_frame, args_number);
 
+  ecma_length_t args_read;
   ecma_completion_value_t get_arg_completion = vm_fill_varg_list (frame_ctx_p,
                                                                   args_number,
-                                                                  arg_collection_p);
-  ecma_length_t args_read = arg_collection_p->unit_number;
+                                                                  arg_values,
+                                                                  &args_read);
 
   if (ecma_is_completion_value_empty (get_arg_completion))
   {
     JERRY_ASSERT (args_read == args_number);
 
-    MEM_DEFINE_LOCAL_ARRAY (arg_values, args_read, ecma_value_t);
-
-    ecma_collection_iterator_t arg_collection_iter;
-    ecma_collection_iterator_init (&arg_collection_iter,
-                                   arg_collection_p);
-
-    for (ecma_length_t arg_index = 0;
-         ecma_collection_iterator_next (&arg_collection_iter);
-         arg_index++)
-    {
-      arg_values[arg_index] = *arg_collection_iter.current_value_p;
-    }
-
     ECMA_TRY_CATCH (array_obj_value,
                     ecma_op_create_array_object (arg_values,
                                                  args_number,
@@ -971,8 +977,6 @@ opfunc_array_decl (vm_instr_t instr, /**< instruction */
                                     array_obj_value);
 
     ECMA_FINALIZE (array_obj_value);
-
-    MEM_FINALIZE_LOCAL_ARRAY (arg_values);
   }
   else
   {
@@ -981,7 +985,14 @@ opfunc_array_decl (vm_instr_t instr, /**< instruction */
     ret_value = get_arg_completion;
   }
 
-  ecma_free_values_collection (arg_collection_p, true);
+  for (ecma_length_t arg_index = 0;
+       arg_index < args_read;
+       arg_index++)
+  {
+    ecma_free_value (arg_values[arg_index], true);
+  }
+
+  vm_stack_frame_free_args (&frame_ctx_p->stack_frame, arg_values, args_number);
 
   return ret_value;
 } /* opfunc_array_decl */
@@ -1723,6 +1734,9 @@ opfunc_meta (vm_instr_t instr, /**< instruction */
     case OPCODE_META_TYPE_CALL_SITE_INFO:
     case OPCODE_META_TYPE_FUNCTION_END:
     case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
+    case OPCODE_META_TYPE_LAZY_FUNCTION:
+    case OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED:
+    case OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY:
     {
       JERRY_UNREACHABLE ();
     }
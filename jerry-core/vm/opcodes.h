@@ -139,7 +139,16 @@ typedef enum
   OPCODE_META_TYPE_END_TRY_CATCH_FINALLY, /**< mark of end of try-catch, try-finally, try-catch-finally blocks */
   OPCODE_META_TYPE_SCOPE_CODE_FLAGS, /**< set of flags indicating various properties of the scope's code
                                       *   (See also: opcode_scope_code_flags_t) */
-  OPCODE_META_TYPE_END_FOR_IN /**< end of for-in statement */
+  OPCODE_META_TYPE_END_FOR_IN, /**< end of for-in statement */
+  OPCODE_META_TYPE_LAZY_FUNCTION, /**< index (idx, idx) of source text range of a function, which code
+                                   *   is not compiled yet, in the byte-code's source ranges table
+                                   *   (see also: parser_parse_lazy_function) */
+  OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED, /**< compressed pointer to byte-code, compiled from source text of
+                                            *   a lazy function (see also: OPCODE_META_TYPE_LAZY_FUNCTION) */
+  OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY /**< index (idx, idx) of source text range of body of a function,
+                                              *   nested into a lazy function, in the byte-code's source
+                                              *   ranges table (follows the lazy function's
+                                              *   OPCODE_META_TYPE_LAZY_FUNCTION instruction) */
 } opcode_meta_type;
 
 typedef enum : vm_idx_t
@@ -592,6 +592,21 @@ pp_op_meta (const bytecode_data_header_t *bytecode_data_p,
 
           break;
         }
+        case OPCODE_META_TYPE_LAZY_FUNCTION:
+        {
+          printf ("lazy function: source range %d;", OC (2, 3));
+          break;
+        }
+        case OPCODE_META_TYPE_LAZY_FUNCTION_COMPILED:
+        {
+          printf ("lazy function: [compiled];");
+          break;
+        }
+        case OPCODE_META_TYPE_LAZY_FUNCTION_NESTED_BODY:
+        {
+          printf ("lazy function: nested function's body source range %d;", OC (2, 3));
+          break;
+        }
         default:
         {
           JERRY_UNREACHABLE ();
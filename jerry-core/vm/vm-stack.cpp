@@ -75,15 +75,18 @@ vm_stack_get_top_frame (void)
  */
 void
 vm_stack_add_frame (vm_stack_frame_t *frame_p, /**< frame to initialize */
-                    ecma_value_t *regs_p, /**< array of register variables' values */
+                    ecma_value_t *regs_p, /**< array of register variables' values,
+                                           *   followed by VM_STACK_FRAME_ARGS_AREA_SIZE slots
+                                           *   of the frame's argument area */
                     uint32_t regs_num, /**< total number of register variables */
                     uint32_t local_vars_regs_num, /**< number of register variables,
                                                    *   used for local variables */
                     uint32_t arg_regs_num, /**< number of register variables,
                                             *   used for arguments */
-                    ecma_collection_header_t *arguments_p) /**< collection of arguments
-                                                            *   (for case, their values
-                                                            *    are moved to registers) */
+                    const ecma_value_t *arg_values_p, /**< list of arguments
+                                                       *   (for case, their values
+                                                       *    are moved to registers) */
+                    ecma_length_t arg_values_num) /**< number of arguments in the list */
 {
   frame_p->prev_frame_p = vm_stack_top_frame_p;
   vm_stack_top_frame_p = frame_p;
@@ -93,6 +96,8 @@ vm_stack_add_frame (vm_stack_frame_t *frame_p, /**< frame to initialize */
   frame_p->current_slot_index = 0;
   frame_p->regs_p = regs_p;
   frame_p->regs_number = regs_num;
+  frame_p->args_area_p = regs_p + regs_num;
+  frame_p->args_area_top = 0;
 
   JERRY_ASSERT (regs_num >= VM_SPECIAL_REGS_NUMBER);
 
@@ -108,17 +113,11 @@ vm_stack_add_frame (vm_stack_frame_t *frame_p, /**< frame to initialize */
     regs_p[i] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
 
-  if (arg_regs_num != 0)
+  const uint32_t arg_values_to_regs_num = JERRY_MIN (arg_regs_num, arg_values_num);
+
+  for (uint32_t i = 0; i < arg_values_to_regs_num; i++)
   {
-    ecma_collection_iterator_t args_iterator;
-    ecma_collection_iterator_init (&args_iterator, arguments_p);
-
-    for (uint32_t i = regs_num - arg_regs_num;
-         i < regs_num && ecma_collection_iterator_next (&args_iterator);
-         i++)
-    {
-      regs_p[i] = ecma_copy_value (*args_iterator.current_value_p, false);
-    }
+    regs_p[regs_num - arg_regs_num + i] = ecma_copy_value (arg_values_p[i], false);
   }
 } /* vm_stack_add_frame */
 
@@ -136,6 +135,8 @@ vm_stack_free_frame (vm_stack_frame_t *frame_p) /**< frame to initialize */
 
   vm_stack_top_frame_p = frame_p->prev_frame_p;
 
+  JERRY_ASSERT (frame_p->args_area_top == 0);
+
   while (frame_p->top_chunk_p != NULL)
   {
     vm_stack_pop (frame_p);
@@ -149,6 +150,66 @@ vm_stack_free_frame (vm_stack_frame_t *frame_p) /**< frame to initialize */
   }
 } /* vm_stack_free_frame */
 
+/**
+ * Allocate place for values of a call's arguments
+ *
+ * Note:
+ *      the place is taken from the frame's argument area, if there are enough free slots,
+ *      otherwise it is allocated on heap;
+ *      the places should be freed with vm_stack_frame_free_args in reverse order of allocation
+ *
+ * @return pointer to place for the specified number of values,
+ *         or NULL - if the number is zero
+ */
+ecma_value_t *
+vm_stack_frame_alloc_args (vm_stack_frame_t *frame_p, /**< stack frame */
+                           ecma_length_t args_number) /**< number of arguments */
+{
+  if (args_number == 0)
+  {
+    return NULL;
+  }
+  else if (likely (args_number <= VM_STACK_FRAME_ARGS_AREA_SIZE - frame_p->args_area_top))
+  {
+    ecma_value_t *args_p = frame_p->args_area_p + frame_p->args_area_top;
+    frame_p->args_area_top += args_number;
+
+    return args_p;
+  }
+  else
+  {
+    return (ecma_value_t *) mem_heap_alloc_block (args_number * sizeof (ecma_value_t), MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+} /* vm_stack_frame_alloc_args */
+
+/**
+ * Free place for values of a call's arguments, allocated with vm_stack_frame_alloc_args
+ *
+ * Note:
+ *      the values themselves are not freed
+ */
+void
+vm_stack_frame_free_args (vm_stack_frame_t *frame_p, /**< stack frame */
+                          ecma_value_t *args_p, /**< place to free */
+                          ecma_length_t args_number) /**< number of arguments */
+{
+  if (args_number == 0)
+  {
+    JERRY_ASSERT (args_p == NULL);
+  }
+  else if (likely (args_p >= frame_p->args_area_p
+                   && args_p < frame_p->args_area_p + VM_STACK_FRAME_ARGS_AREA_SIZE))
+  {
+    JERRY_ASSERT (args_p + args_number == frame_p->args_area_p + frame_p->args_area_top);
+
+    frame_p->args_area_top -= args_number;
+  }
+  else
+  {
+    mem_heap_free_block (args_p);
+  }
+} /* vm_stack_frame_free_args */
+
 /**
  * Get value of specified register variable
  *
@@ -31,6 +31,11 @@
  */
 #define VM_STACK_FRAME_INLINED_VALUES_NUMBER CONFIG_VM_STACK_FRAME_INLINED_VALUES_NUMBER
 
+/**
+ * Number of value slots in stack frame's argument area
+ */
+#define VM_STACK_FRAME_ARGS_AREA_SIZE CONFIG_VM_STACK_FRAME_ARGS_AREA_SIZE
+
 /**
  * Header of a ECMA stack frame's chunk
  */
@@ -53,6 +58,8 @@ typedef struct vm_stack_frame_t
                                                                       *   (instead of being placed on heap) */
   ecma_value_t *regs_p; /**< register variables */
   uint32_t regs_number; /**< number of register variables */
+  ecma_value_t *args_area_p; /**< argument area (VM_STACK_FRAME_ARGS_AREA_SIZE slots after register variables) */
+  uint32_t args_area_top; /**< number of occupied slots in the argument area */
 } vm_stack_frame_t;
 
 extern void vm_stack_init (void);
@@ -60,8 +67,11 @@ extern void vm_stack_finalize (void);
 extern vm_stack_frame_t *
 vm_stack_get_top_frame (void);
 extern void
-vm_stack_add_frame (vm_stack_frame_t *, ecma_value_t *, uint32_t, uint32_t, uint32_t, ecma_collection_header_t *);
+vm_stack_add_frame (vm_stack_frame_t *, ecma_value_t *, uint32_t, uint32_t, uint32_t,
+                    const ecma_value_t *, ecma_length_t);
 extern void vm_stack_free_frame (vm_stack_frame_t *);
+extern ecma_value_t *vm_stack_frame_alloc_args (vm_stack_frame_t *, ecma_length_t);
+extern void vm_stack_frame_free_args (vm_stack_frame_t *, ecma_value_t *, ecma_length_t);
 extern ecma_value_t vm_stack_frame_get_reg_value (vm_stack_frame_t *, uint32_t);
 extern void vm_stack_frame_set_reg_value (vm_stack_frame_t *, uint32_t, ecma_value_t);
 extern void vm_stack_push_value (vm_stack_frame_t *, ecma_value_t);
@@ -380,6 +380,31 @@ vm_finalize (void)
   __program = NULL;
 } /* vm_finalize */
 
+/**
+ * Add memory region, containing pointer to the program's byte-code, to list of heap image's regions
+ *
+ * Note:
+ *      the interpreter should not be running at the moment
+ */
+void
+vm_get_image_regions (mem_image_regions_t *regions_p) /**< in-out: list of regions */
+{
+  JERRY_ASSERT (vm_top_context_p == NULL);
+
+  mem_image_regions_add (regions_p, &__program, sizeof (__program));
+} /* vm_get_image_regions */
+
+/**
+ * Initialize interpreter after pointer to the program's byte-code was restored from a heap image
+ */
+void
+vm_init_from_image (void)
+{
+  vm_top_context_p = NULL;
+
+  vm_stack_init ();
+} /* vm_init_from_image */
+
 /**
  * Run global code
  */
@@ -393,26 +418,7 @@ vm_run_global (void)
   interp_mem_stats_print_legend ();
 #endif /* MEM_STATS */
 
-  bool is_strict = false;
-  vm_instr_counter_t start_pos = 0;
-
-  opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (__program, start_pos++);
-
-  if (scope_flags & OPCODE_SCOPE_CODE_FLAGS_STRICT)
-  {
-    is_strict = true;
-  }
-
-  ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
-  ecma_object_t *lex_env_p = ecma_get_global_environment ();
-
-  ecma_completion_value_t completion = vm_run_from_pos (__program,
-                                                        start_pos,
-                                                        ecma_make_object_value (glob_obj_p),
-                                                        lex_env_p,
-                                                        is_strict,
-                                                        false,
-                                                        NULL);
+  ecma_completion_value_t completion = vm_run_global_code (__program);
 
   jerry_completion_code_t ret_code;
 
@@ -431,14 +437,47 @@ vm_run_global (void)
 
   ecma_free_completion_value (completion);
 
-  ecma_deref_object (glob_obj_p);
-  ecma_deref_object (lex_env_p);
-
   JERRY_ASSERT (vm_top_context_p == NULL);
 
   return ret_code;
 } /* vm_run_global */
 
+/**
+ * Run specified global code byte-code
+ *
+ * Note:
+ *      the code can be run both from top level, and from a native handler, called during execution of other code
+ *
+ * @return completion value (return completion with undefined value or throw completion)
+ */
+ecma_completion_value_t
+vm_run_global_code (const bytecode_data_header_t *bytecode_data_p) /**< byte-code data header */
+{
+  vm_instr_counter_t start_pos = 0;
+  opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (bytecode_data_p, start_pos++);
+  bool is_strict = ((scope_flags & OPCODE_SCOPE_CODE_FLAGS_STRICT) != 0);
+
+  ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
+  ecma_object_t *lex_env_p = ecma_get_global_environment ();
+
+  ecma_completion_value_t completion = vm_run_from_pos (bytecode_data_p,
+                                                        start_pos,
+                                                        ecma_make_object_value (glob_obj_p),
+                                                        lex_env_p,
+                                                        is_strict,
+                                                        false,
+                                                        NULL,
+                                                        0);
+
+  JERRY_ASSERT (ecma_is_completion_value_return (completion)
+                || ecma_is_completion_value_throw (completion));
+
+  ecma_deref_object (glob_obj_p);
+  ecma_deref_object (lex_env_p);
+
+  return completion;
+} /* vm_run_global_code */
+
 /**
  * Run specified eval-mode bytecode
  *
@@ -481,7 +520,8 @@ vm_run_eval (const bytecode_data_header_t *bytecode_data_p, /**< byte-code data
                                                         lex_env_p,
                                                         is_strict,
                                                         true,
-                                                        NULL);
+                                                        NULL,
+                                                        0);
 
   if (ecma_is_completion_value_return (completion))
   {
@@ -598,12 +638,13 @@ vm_run_from_pos (const bytecode_data_header_t *header_p, /**< byte-code data hea
                  ecma_object_t *lex_env_p, /**< lexical environment to use */
                  bool is_strict, /**< is the code is strict mode code (ECMA-262 v5, 10.1.1) */
                  bool is_eval_code, /**< is the code is eval code (ECMA-262 v5, 10.1) */
-                 ecma_collection_header_t *arg_collection_p) /**<
-                                                              * - collection of function call arguments,
-                                                              *   if arguments for the called function
-                                                              *   are placed on registers;
-                                                              * - NULL - otherwise.
-                                                              */
+                 const ecma_value_t *arg_values_p, /**<
+                                                    * - list of function call arguments,
+                                                    *   if arguments for the called function
+                                                    *   are placed on registers;
+                                                    * - NULL - otherwise.
+                                                    */
+                 ecma_length_t arg_values_num) /**< number of arguments in the list */
 {
   ecma_completion_value_t completion;
 
@@ -617,7 +658,8 @@ vm_run_from_pos (const bytecode_data_header_t *header_p, /**< byte-code data hea
 
   uint32_t regs_num = VM_SPECIAL_REGS_NUMBER + tmp_regs_num + local_var_regs_num + arg_regs_num;
 
-  MEM_DEFINE_LOCAL_ARRAY (regs, regs_num, ecma_value_t);
+  /* the frame's argument area is placed right after the register variables */
+  MEM_DEFINE_LOCAL_ARRAY (regs, regs_num + VM_STACK_FRAME_ARGS_AREA_SIZE, ecma_value_t);
 
   vm_frame_ctx_t frame_ctx;
   frame_ctx.bytecode_header_p = header_p;
@@ -628,7 +670,13 @@ vm_run_from_pos (const bytecode_data_header_t *header_p, /**< byte-code data hea
   frame_ctx.is_call_in_direct_eval_form = false;
   frame_ctx.tmp_num_p = ecma_alloc_number ();
 
-  vm_stack_add_frame (&frame_ctx.stack_frame, regs, regs_num, local_var_regs_num, arg_regs_num, arg_collection_p);
+  vm_stack_add_frame (&frame_ctx.stack_frame,
+                      regs,
+                      regs_num,
+                      local_var_regs_num,
+                      arg_regs_num,
+                      arg_values_p,
+                      arg_values_num);
   vm_stack_frame_set_reg_value (&frame_ctx.stack_frame,
                                 VM_REG_SPECIAL_THIS_BINDING,
                                 ecma_copy_value (this_binding_value, false));
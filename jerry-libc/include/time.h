@@ -0,0 +1,48 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_TIME_H
+#define JERRY_LIBC_TIME_H
+
+#ifdef __cplusplus
+# define EXTERN_C "C"
+#else /* !__cplusplus */
+# define EXTERN_C
+#endif /* !__cplusplus */
+
+/**
+ * Time value with nanosecond resolution
+ *
+ * Note:
+ *      the layout is the one, used by the platforms' system calls; the guard macro is the one,
+ *      used by host headers, so that the structure is not redefined, if they are also included
+ */
+#ifndef _STRUCT_TIMESPEC
+#define _STRUCT_TIMESPEC struct timespec
+struct timespec
+{
+  long int tv_sec; /**< seconds */
+  long int tv_nsec; /**< nanoseconds */
+};
+#endif /* !_STRUCT_TIMESPEC */
+
+/**
+ * Clock that is not affected by changes of system time
+ */
+#define CLOCK_MONOTONIC (1)
+
+extern EXTERN_C int clock_gettime (int, struct timespec *);
+
+#endif /* !JERRY_LIBC_TIME_H */
@@ -28,6 +28,7 @@
 #include <sys/resource.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <time.h>
 
 #include "jerry-libc-defs.h"
 
@@ -384,3 +385,31 @@ fwrite (const void *ptr, /**< data to write */
   return bytes_written / size;
 } /* fwrite */
 
+/**
+ * Get time of the specified clock
+ *
+ * Note:
+ *      there is no clock_gettime system call on the platform,
+ *      so time of day is returned for any clock
+ *
+ * @return 0 - upon success,
+ *         -1 - otherwise
+ */
+int
+clock_gettime (int clock_id __attr_unused___, /**< clock identifier */
+               struct timespec *tp) /**< out: time */
+{
+  struct timeval tv;
+
+  long int ret = syscall_2 (SYS_gettimeofday, (long int) &tv, 0);
+
+  if (ret != 0)
+  {
+    return -1;
+  }
+
+  tp->tv_sec = tv.tv_sec;
+  tp->tv_nsec = tv.tv_usec * 1000;
+
+  return 0;
+} /* clock_gettime */
@@ -28,6 +28,7 @@
 #include <sys/resource.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <time.h>
 
 #include "jerry-libc-defs.h"
 
@@ -384,6 +385,21 @@ fwrite (const void *ptr, /**< data to write */
   return bytes_written / size;
 } /* fwrite */
 
+/**
+ * Get time of the specified clock
+ *
+ * @return 0 - upon success,
+ *         -1 - otherwise
+ */
+int
+clock_gettime (int clock_id, /**< clock identifier */
+               struct timespec *tp) /**< out: time */
+{
+  long int ret = syscall_2 (__NR_clock_gettime, clock_id, (long int) tp);
+
+  return (ret == 0) ? 0 : -1;
+} /* clock_gettime */
+
 // FIXME
 #if 0
 /**
@@ -19,6 +19,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include "jerry-libc-defs.h"
 
@@ -61,3 +62,14 @@ fwrite (const void *ptr __attr_unused___, /**< data to write */
   return size * nmemb;
 } /* fwrite */
 
+/**
+ * clock_gettime
+ *
+ * @return -1 (no clocks are available)
+ */
+int
+clock_gettime (int clock_id __attr_unused___, /**< clock identifier */
+               struct timespec *tp __attr_unused___) /**< out: time */
+{
+  return -1;
+} /* clock_gettime */
@@ -190,6 +190,10 @@ main (int argc,
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--lazy-functions", argv[i]))
+    {
+      flags |= JERRY_FLAG_LAZY_FUNCTIONS;
+    }
     else if (!strcmp ("--log-level", argv[i]))
     {
       flags |= JERRY_FLAG_ENABLE_LOG;
@@ -283,7 +287,7 @@ main (int argc,
 
       jerry_completion_code_t ret_code = JERRY_COMPLETION_CODE_OK;
 
-      if (!jerry_parse (source_p, source_size))
+      if (!jerry_parse (source_p, source_size, true))
       {
         /* unhandled SyntaxError */
         ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
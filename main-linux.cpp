@@ -17,6 +17,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
 #include "jerry.h"
 #include "jrt/jrt.h"
 
@@ -30,6 +37,11 @@
  */
 #define JERRY_BUFFER_SIZE (1048576)
 
+/**
+ * Maximum size of a source code chunk, read from file during parse (see also: read_source_chunk)
+ */
+#define JERRY_SOURCE_CHUNK_SIZE (4096)
+
 /**
  * Standalone Jerry exit codes
  */
@@ -110,6 +122,7 @@ read_sources (const char *script_file_names[],
   }
 }
 
+#ifndef JERRY_ENABLE_SNAPSHOT_MMAP
 static bool
 read_snapshot (const char *snapshot_file_name_p,
                size_t *out_snapshot_size_p)
@@ -162,6 +175,69 @@ read_snapshot (const char *snapshot_file_name_p,
   fclose (file);
   return true;
 } /* read_snapshot */
+#else /* JERRY_ENABLE_SNAPSHOT_MMAP */
+/**
+ * Map snapshot file to memory for reading, so that the snapshot could be executed in place
+ * (see also: jerry_exec_snapshot)
+ *
+ * @return pointer to the mapped snapshot - upon success,
+ *         NULL - otherwise
+ */
+static const void *
+map_snapshot (const char *snapshot_file_name_p, /**< snapshot file name */
+              size_t *out_snapshot_size_p) /**< out: snapshot size */
+{
+  JERRY_ASSERT (snapshot_file_name_p != NULL);
+  JERRY_ASSERT (out_snapshot_size_p != NULL);
+
+  *out_snapshot_size_p = 0;
+
+  int fd = open (snapshot_file_name_p, O_RDONLY);
+
+  if (fd < 0)
+  {
+    return NULL;
+  }
+
+  struct stat snapshot_file_stat;
+
+  if (fstat (fd, &snapshot_file_stat) != 0
+      || snapshot_file_stat.st_size <= 0)
+  {
+    close (fd);
+    return NULL;
+  }
+
+  size_t snapshot_size = (size_t) snapshot_file_stat.st_size;
+  void *snapshot_p = mmap (NULL, snapshot_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  close (fd);
+
+  if (snapshot_p == MAP_FAILED)
+  {
+    return NULL;
+  }
+
+  *out_snapshot_size_p = snapshot_size;
+
+  return snapshot_p;
+} /* map_snapshot */
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
+/**
+ * Read next chunk of script source from file (see also: jerry_parse_stream)
+ *
+ * @return number of bytes read
+ */
+static size_t
+read_source_chunk (jerry_api_char_t *buffer_p, /**< buffer to read the chunk to */
+                   size_t buffer_size, /**< free space in the buffer */
+                   void *user_data_p) /**< the file */
+{
+  FILE *file = (FILE *) user_data_p;
+
+  return fread (buffer_p, 1u, buffer_size < JERRY_SOURCE_CHUNK_SIZE ? buffer_size : JERRY_SOURCE_CHUNK_SIZE, file);
+} /* read_source_chunk */
 
 /**
  * Provide the 'assert' implementation for the engine.
@@ -216,6 +292,7 @@ main (int argc,
 
   bool is_dump_snapshot_mode = false;
   bool is_dump_snapshot_mode_for_global_or_eval = false;
+  bool is_dump_compact_snapshot = false;
   const char *dump_snapshot_file_name_p = NULL;
 
 #ifdef JERRY_ENABLE_LOG
@@ -250,6 +327,14 @@ main (int argc,
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--lazy-functions", argv[i]))
+    {
+      flags |= JERRY_FLAG_LAZY_FUNCTIONS;
+    }
+    else if (!strcmp ("--snapshot-stats", argv[i]))
+    {
+      flags |= JERRY_FLAG_SNAPSHOT_STATS;
+    }
     else if (!strcmp ("--dump-snapshot-for-global", argv[i])
              || !strcmp ("--dump-snapshot-for-eval", argv[i]))
     {
@@ -269,6 +354,10 @@ main (int argc,
         return JERRY_STANDALONE_EXIT_CODE_FAIL;
       }
     }
+    else if (!strcmp ("--compact-snapshot", argv[i]))
+    {
+      is_dump_compact_snapshot = true;
+    }
     else if (!strcmp ("--exec-snapshot", argv[i]))
     {
       if (++i < argc)
@@ -336,6 +425,11 @@ main (int argc,
       return JERRY_STANDALONE_EXIT_CODE_FAIL;
     }
   }
+  else if (is_dump_compact_snapshot)
+  {
+    JERRY_ERROR_MSG ("--compact-snapshot argument is passed without --dump-snapshot argument\n");
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
 
   if (files_counter == 0
       && exec_snapshots_count == 0)
@@ -383,10 +477,38 @@ main (int argc,
     jerry_completion_code_t ret_code = JERRY_COMPLETION_CODE_OK;
 
     bool is_ok = true;
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+    /* mapped snapshots are referenced by the engine until it is stopped */
+    const void *mapped_snapshots_p[JERRY_MAX_COMMAND_LINE_ARGS];
+    size_t mapped_snapshot_sizes[JERRY_MAX_COMMAND_LINE_ARGS];
+    int mapped_snapshots_count = 0;
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
     for (int i = 0; i < exec_snapshots_count; i++)
     {
       size_t snapshot_size;
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+      const void *snapshot_p = map_snapshot (exec_snapshot_file_names[i], &snapshot_size);
+
+      if (snapshot_p == NULL)
+      {
+        ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+      }
+      else
+      {
+        mapped_snapshots_p[mapped_snapshots_count] = snapshot_p;
+        mapped_snapshot_sizes[mapped_snapshots_count] = snapshot_size;
+        mapped_snapshots_count++;
+
+        jerry_api_value_t ret_value;
+        ret_code = jerry_exec_snapshot (snapshot_p,
+                                        snapshot_size,
+                                        false,
+                                        &ret_value);
+        JERRY_ASSERT (ret_value.type == JERRY_API_DATA_TYPE_UNDEFINED);
+      }
+#else /* JERRY_ENABLE_SNAPSHOT_MMAP */
       if (!read_snapshot (exec_snapshot_file_names[i], &snapshot_size))
       {
         ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
@@ -400,6 +522,7 @@ main (int argc,
                                         &ret_value);
         JERRY_ASSERT (ret_value.type == JERRY_API_DATA_TYPE_UNDEFINED);
       }
+#endif /* !JERRY_ENABLE_SNAPSHOT_MMAP */
 
       if (ret_code != JERRY_COMPLETION_CODE_OK)
       {
@@ -409,7 +532,33 @@ main (int argc,
       }
     }
 
-    if (is_ok)
+    if (is_ok && files_counter == 1 && !is_dump_snapshot_mode)
+    {
+      /* single script is parsed while being read */
+      FILE *file = fopen (file_names[0], "r");
+
+      if (file == NULL)
+      {
+        JERRY_ERROR_MSG ("Failed to read script N%d\n", 1);
+
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      bool is_parsed = jerry_parse_stream (read_source_chunk, file, buffer, sizeof (buffer), true);
+
+      fclose (file);
+
+      if (!is_parsed)
+      {
+        /* unhandled SyntaxError */
+        ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+      }
+      else if ((flags & JERRY_FLAG_PARSE_ONLY) == 0)
+      {
+        ret_code = jerry_run ();
+      }
+    }
+    else if (is_ok)
     {
       size_t source_size;
       const jerry_api_char_t *source_p = NULL;
@@ -435,6 +584,21 @@ main (int argc,
                                                                 is_dump_snapshot_mode_for_global_or_eval,
                                                                 snapshot_dump_buffer,
                                                                 JERRY_BUFFER_SIZE);
+          const uint8_t *snapshot_p = snapshot_dump_buffer;
+
+          if (snapshot_size != 0
+              && is_dump_compact_snapshot)
+          {
+            static uint8_t compact_snapshot_dump_buffer[ JERRY_BUFFER_SIZE ];
+
+            snapshot_size = jerry_compact_snapshot (snapshot_dump_buffer,
+                                                    snapshot_size,
+                                                    true,
+                                                    compact_snapshot_dump_buffer,
+                                                    JERRY_BUFFER_SIZE);
+            snapshot_p = compact_snapshot_dump_buffer;
+          }
+
           if (snapshot_size == 0)
           {
             ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
@@ -442,13 +606,13 @@ main (int argc,
           else
           {
             FILE *snapshot_file_p = fopen (dump_snapshot_file_name_p, "w");
-            fwrite (snapshot_dump_buffer, sizeof (uint8_t), snapshot_size, snapshot_file_p);
+            fwrite (snapshot_p, sizeof (uint8_t), snapshot_size, snapshot_file_p);
             fclose (snapshot_file_p);
           }
         }
         else
         {
-          if (!jerry_parse (source_p, source_size))
+          if (!jerry_parse (source_p, source_size, true))
           {
             /* unhandled SyntaxError */
             ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
@@ -463,6 +627,13 @@ main (int argc,
 
     jerry_cleanup ();
 
+#ifdef JERRY_ENABLE_SNAPSHOT_MMAP
+    for (int i = 0; i < mapped_snapshots_count; i++)
+    {
+      munmap ((void *) mapped_snapshots_p[i], mapped_snapshot_sizes[i]);
+    }
+#endif /* JERRY_ENABLE_SNAPSHOT_MMAP */
+
 #ifdef JERRY_ENABLE_LOG
     if (jerry_log_file && jerry_log_file != stdout)
     {
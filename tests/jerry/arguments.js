@@ -129,3 +129,134 @@ fn_expr (1);
 (function () {
  var a = [arguments];
 })();
+
+function lazy_args (a, b) {
+  assert (arguments.length === 3);
+  assert (arguments[0] === 1);
+  assert (arguments[2] === 3);
+  assert (arguments[3] === undefined);
+
+  a = 'a';
+  assert (arguments[0] === 'a');
+
+  arguments[1] = 'b';
+  assert (b === 'b');
+
+  var keys = Object.keys (arguments);
+  assert (keys.length === 3);
+  assert (keys[0] === '0' && keys[1] === '1' && keys[2] === '2');
+
+  assert (arguments.callee === lazy_args);
+  assert (Object.prototype.toString.call (arguments) === '[object Arguments]');
+}
+
+lazy_args (1, 2, 3);
+
+function lazy_args_not_extensible (a) {
+  Object.preventExtensions (arguments);
+  assert (!Object.isExtensible (arguments));
+  assert (arguments.length === 1);
+  assert (arguments[0] === a);
+
+  arguments.x = 1;
+  assert (arguments.x === undefined);
+}
+
+lazy_args_not_extensible ({});
+
+function lazy_args_for_in () {
+  var obj = Object.create (arguments);
+  var count = 0;
+
+  for (var prop in obj) {
+    count++;
+  }
+
+  assert (count === 2);
+  assert (obj[1] === 'y');
+}
+
+lazy_args_for_in ('x', 'y');
+
+function lazy_args_strict (a) {
+  'use strict';
+
+  a = 2;
+  assert (arguments[0] === 1);
+  assert (arguments.length === 1);
+  check_type_error_for_property (arguments, 'callee');
+}
+
+function check_type_error_for_property (obj, prop) {
+  try {
+    var v = obj[prop];
+    assert (false);
+  }
+  catch (e) {
+    assert (e instanceof TypeError);
+  }
+}
+
+lazy_args_strict (1);
+
+function f_deferred (a, b)
+{
+  'use strict';
+
+  a = 10;
+
+  if (b)
+  {
+    return arguments;
+  }
+
+  return a;
+}
+
+assert (f_deferred (1, false) === 10);
+var args = f_deferred (1, true, 3);
+assert (args.length === 3 && args[0] === 1 && args[1] === true && args[2] === 3);
+
+function f_deferred_mapped (a)
+{
+  a = 'x';
+  var get_args = function () { return 0; };
+
+  return [eval ('arguments'), get_args ()];
+}
+
+args = f_deferred_mapped ('a', 'b')[0];
+assert (args.length === 2 && args[0] === 'x' && args[1] === 'b');
+
+function f_deferred_assigned (a)
+{
+  arguments = a;
+  return arguments;
+}
+
+assert (f_deferred_assigned (5) === 5);
+
+function f_deferred_nested (a)
+{
+  var inner = f_deferred_nested_inner (a + 1, a + 2);
+
+  return [arguments[0], inner[0], inner[1]];
+}
+
+function f_deferred_nested_inner ()
+{
+  return arguments;
+}
+
+args = f_deferred_nested (1);
+assert (args[0] === 1 && args[1] === 2 && args[2] === 3);
+
+try
+{
+  (function () { throw arguments; }) (1, 2);
+  assert (false);
+}
+catch (e)
+{
+  assert (e.length === 2 && e[1] === 2);
+}
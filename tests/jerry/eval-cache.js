@@ -0,0 +1,109 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// repeatedly evaluated code produces the same results
+var sum = 0;
+for (var i = 0; i < 100; i++)
+{
+  sum += eval ("1 + 2 * 3");
+}
+assert (sum === 700);
+
+// variables are resolved in the context of each evaluation
+function f (x)
+{
+  return eval ("x * 2");
+}
+
+for (var i = 0; i < 10; i++)
+{
+  assert (f (i) === i * 2);
+}
+
+// declarations are instantiated upon each evaluation
+for (var i = 0; i < 10; i++)
+{
+  eval ("var declared_in_eval = " + (i % 2) + "; function g () { return declared_in_eval; }");
+  assert (g () === i % 2);
+}
+
+var closures = [];
+for (var i = 0; i < 5; i++)
+{
+  closures.push (eval ("(function (v) { return function () { return v; }; })")(i));
+}
+for (var i = 0; i < 5; i++)
+{
+  assert (closures[i] () === i);
+}
+
+// code, evaluating itself
+var src = "depth++ < 5 ? eval (src) : depth";
+var depth = 0;
+assert (eval (src) === 6);
+
+// same source, evaluated as strict and non-strict mode code
+function strict_eval ()
+{
+  "use strict";
+  return eval ("var v_strict = 1; typeof v_strict");
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (eval ("var v_strict = 1; typeof v_strict") === "number");
+  assert (strict_eval () === "number");
+}
+
+function strict_eval_this ()
+{
+  "use strict";
+  return eval ("this");
+}
+
+assert (eval ("this") === this);
+assert (strict_eval_this () === undefined);
+assert ((0, eval) ("this") === this);
+
+// errors are reported upon each evaluation
+for (var i = 0; i < 3; i++)
+{
+  try
+  {
+    eval ("var = 1;");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+
+  try
+  {
+    eval ("undefined_variable_in_eval");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof ReferenceError);
+  }
+}
+
+// many different sources
+for (var i = 0; i < 500; i++)
+{
+  assert (eval ("[" + i + ", " + i % 7 + "]")[0] === i);
+  assert (eval ("1 + 2 * 3") === 7);
+}
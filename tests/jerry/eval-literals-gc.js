@@ -0,0 +1,44 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var kept = [];
+
+for (var i = 0; i < 10000; i++)
+{
+  var str = eval ("'literal_string_number_" + i + "'");
+  assert (str === "literal_string_number_" + i);
+
+  assert (eval ("(" + (i + 0.5) + ")") === i + 0.5);
+
+  if (i % 1000 === 0)
+  {
+    /* string values, created from the eval code's literals, should outlive the code */
+    kept.push (eval ("'kept_" + i + "'"));
+  }
+}
+
+for (var j = 0; j < kept.length; j++)
+{
+  assert (kept[j] === "kept_" + (j * 1000));
+}
+
+try
+{
+  eval ("var syntax_error_" + i + " = ;");
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof SyntaxError);
+}
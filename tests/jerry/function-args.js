@@ -70,3 +70,35 @@ with ({})
 {
   assert (f2 () === this);
 }
+
+function sum ()
+{
+  var s = 0;
+
+  for (var k = 0; k < arguments.length; k++)
+  {
+    s += arguments[k];
+  }
+
+  return s;
+}
+
+function sum3 (a, b, c)
+{
+  return a + b + c;
+}
+
+assert (sum3 (1, sum3 (2, 3, sum3 (4, 5, 6)), 7) === 28);
+assert (sum (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12) === 78);
+assert (sum (1, 2, 3, sum (4, 5, 6, sum (7, 8, 9, 10), 11), 12) === 78);
+assert (sum (sum3 (1, 2, 3), [4, 5, sum (6, 7)].length, new Array (1, 2, 3, 4, 5, 6, 7, 8, 9).length) === 18);
+
+try {
+  sum (1, 2, 3, sum3 (4, 5, undefined_variable), 6);
+  assert (false);
+}
+catch (e) {
+  assert (e instanceof ReferenceError);
+}
+
+assert (sum3 (1, 2, sum (3, 4, 5, 6, 7, 8, 9)) === 45);
@@ -0,0 +1,116 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Closures created from the same function literal share code but have separate scopes
+var closures = [];
+for (var i = 0; i < 32; i++)
+{
+  closures.push ((function (v) {
+    return function (a, b, c) {
+      return v + a + b + c;
+    };
+  }) (i));
+}
+
+for (var i = 0; i < closures.length; i++)
+{
+  assert (closures[i].length === 3);
+  assert (closures[i] (1, 2, 3) === i + 6);
+  assert (closures[i] !== closures[(i + 1) % closures.length]);
+  assert (closures[i].prototype !== closures[(i + 1) % closures.length].prototype);
+}
+
+closures[0].x = 1;
+assert (closures[1].x === undefined);
+
+// Declarations inside a repeatedly called function
+function make_counter (start)
+{
+  function counter (step)
+  {
+    start += step;
+    return start;
+  }
+
+  return counter;
+}
+
+var c1 = make_counter (10);
+var c2 = make_counter (100);
+assert (c1 (1) === 11);
+assert (c2 (2) === 102);
+assert (c1 (1) === 12);
+assert (c1.length === 1 && c2.length === 1);
+
+// Strictness and argument mapping are preserved for every closure
+function make_strict ()
+{
+  return function (a) {
+    'use strict';
+    arguments[0] = 2;
+    return a;
+  };
+}
+
+function make_sloppy ()
+{
+  return function (a) {
+    arguments[0] = 2;
+    return a;
+  };
+}
+
+for (var i = 0; i < 4; i++)
+{
+  var f = make_strict ();
+  assert (f (1) === 1);
+
+  try
+  {
+    f.caller;
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof TypeError);
+  }
+
+  assert (make_sloppy () (1) === 2);
+}
+
+// Many distinct function literals, more than fit into the template cache at once
+var sum = 0;
+for (var i = 0; i < 4; i++)
+{
+  sum += eval ('(function (a) { return a + ' + i + '; })') (1);
+  sum += (function (a) { return a + 1; }) (1);
+  sum += (function (a, b) { return a + b; }) (1, 2);
+  sum += (function () { return 3; }) ();
+  sum += (function (a) { return a * 2; }) (2);
+  sum += (function (a) { return a * 3; }) (2);
+  sum += (function (a) { return a * 4; }) (2);
+  sum += (function (a) { return a * 5; }) (2);
+  sum += (function (a) { return a * 6; }) (2);
+  sum += (function (a) { return a * 7; }) (2);
+  sum += (function (a) { return a * 8; }) (2);
+  sum += (function (a) { return a * 9; }) (2);
+  sum += (function (a) { return a * 10; }) (2);
+  sum += (function (a) { return a * 11; }) (2);
+  sum += (function (a) { return a * 12; }) (2);
+  sum += (function (a) { return a * 13; }) (2);
+  sum += (function (a) { return a * 14; }) (2);
+  sum += (function (a) { return a * 15; }) (2);
+  sum += (function (a) { return a * 16; }) (2);
+}
+assert (sum === 4 * (1 + 2 + 3 + 3 + 2 * (2 + 3 + 4 + 5 + 6 + 7 + 8 + 9 + 10 + 11 + 12 + 13 + 14 + 15 + 16)) + (0 + 1 + 2 + 3));
@@ -73,3 +73,49 @@ try {
   assert (e.message === "foo");
   assert (e instanceof ReferenceError);
 }
+
+// Forwarding of the arguments object.
+function forward ()
+{
+  return addNum.apply (this, arguments);
+}
+
+assert (forward () === 0);
+assert (forward (1, 2, 3) === 6);
+
+function forwardMapped (a, b)
+{
+  a = 10;
+  return addNum.apply (this, arguments);
+}
+
+assert (forwardMapped (1, 2, 3) === 15);
+
+function forwardStrict (a, b)
+{
+  'use strict';
+  a = 10;
+  return addNum.apply (this, arguments);
+}
+
+assert (forwardStrict (1, 2, 3) === 6);
+
+function forwardModified ()
+{
+  arguments[1] = 20;
+  arguments.length = 2;
+  return addNum.apply (this, arguments);
+}
+
+assert (forwardModified (1, 2, 3) === 21);
+
+// Arrays with holes and inherited elements.
+var holes = [1, , 3];
+assert (addNum.apply (obj, holes) !== addNum.apply (obj, holes));
+
+Array.prototype[1] = 2;
+assert (addNum.apply (obj, holes) === 6);
+delete Array.prototype[1];
+
+// Array-like objects.
+assert (addNum.apply (obj, { length: 2, 0: 5, 1: 6, 2: 7 }) === 11);
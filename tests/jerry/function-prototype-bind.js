@@ -138,3 +138,36 @@ assert(bound.length === 1);
 bound = foo.bind(null, 9, 8);
 assert(bound.length === 0);
 
+
+function sumArgs ()
+{
+  var s = 0;
+  for (var i = 0; i < arguments.length; i++)
+  {
+    s += arguments[i];
+  }
+  return s;
+}
+
+var bound = sumArgs.bind (null, 1, 2, 3);
+assert (bound () === 6);
+assert (bound (4) === 10);
+assert (bound (4, 5, 6, 7, 8, 9, 10, 11, 12) === 78);
+
+bound = sumArgs.bind (null, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+assert (bound () === 55);
+assert (bound (11) === 66);
+
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+var BoundPoint = Point.bind (null, { v: 1 });
+var point = new BoundPoint ({ v: 2 });
+assert (point instanceof Point);
+assert (point.x.v === 1 && point.y.v === 2);
+
+var boundTwice = bound.bind (null, 11, 12);
+assert (boundTwice (13) === 91);
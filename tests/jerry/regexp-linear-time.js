@@ -0,0 +1,72 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var r, m;
+var str = "";
+
+for (var i = 0; i < 64; i++)
+{
+  str += "a";
+}
+
+// Nested iterations need exponential time, if matched with backtracking
+r = new RegExp ("(a+)+b");
+assert (r.exec (str) === null);
+
+m = r.exec (str + "b");
+assert (m[0] === str + "b");
+assert (m[1] === str);
+
+r = new RegExp ("^(a|aa)*$");
+assert (r.exec (str + "c") === null);
+assert (r.exec (str)[1] === "a");
+
+r = new RegExp ("(?:a*)*b", "g");
+assert (r.exec (str) === null);
+assert (r.lastIndex === 0);
+
+r = new RegExp ("(x+x+)+y");
+assert (r.exec ("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx") === null);
+
+// Priority of alternatives and iterations
+m = new RegExp ("(a|ab)(c|bcd)(d*)").exec ("abcd");
+assert (m[1] === "a" && m[2] === "bcd" && m[3] === "");
+
+m = new RegExp ("(a+?)(a*)").exec ("aaa");
+assert (m[1] === "a" && m[2] === "aa");
+
+m = new RegExp ("(?:(a)|b)+").exec ("ab");
+assert (m[0] === "ab" && m[1] === undefined);
+
+m = new RegExp ("(a){2,3}?(a*)").exec ("aaaa");
+assert (m[0] === "aaaa" && m[1] === "a" && m[2] === "aa");
+
+m = new RegExp ("(b)?c").exec ("ac");
+assert (m.index === 1 && m[1] === undefined);
+
+// Index and lastIndex of leftmost match
+r = new RegExp ("b+|c", "g");
+m = r.exec ("aabbcb");
+assert (m.index === 2 && m[0] === "bb" && r.lastIndex === 4);
+m = r.exec ("aabbcb");
+assert (m.index === 4 && m[0] === "c" && r.lastIndex === 5);
+
+// Patterns with backreferences are matched with backtracking
+m = new RegExp ("(a+)+\\1b").exec ("aaab");
+assert (m[0] === "aaab" && m[1] === "a");
+
+// Captures, nested into an iterated group, are reset at start of each iteration (ECMA-262 v5, 15.10.2.5)
+m = new RegExp ("(z)((a+)?(b+)?(c))*").exec ("zaacbbbcac");
+assert (m.length === 6);
+assert (m[0] === "zaacbbbcac" && m[1] === "z" && m[2] === "ac" && m[3] === "a" && m[4] === undefined && m[5] === "c");
@@ -112,3 +112,22 @@ assert(String.prototype.indexOf.call(test_object, "Obj") === 8);
 
 // check coercible - Number
 assert(String.prototype.indexOf.call(123, "2") === 1);
+
+// check empty search string with position
+assert("abc".indexOf("", 2) === 2);
+assert("abc".indexOf("", 5) === 3);
+
+// check long strings
+var long_str = "0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+assert(long_str.indexOf("0123") === 0);
+assert(long_str.indexOf("0123", 1) === 36);
+assert(long_str.indexOf("XYZ") === 69);
+assert(long_str.indexOf("9A") === 45);
+assert(long_str.indexOf("9a", 10) === -1);
+assert(long_str.indexOf("Z", 71) === 71);
+assert(long_str.indexOf("Z", 72) === -1);
+
+// check non-ascii strings
+assert("árvíztűrő tükörfúrógép".indexOf("tük") === 10);
+assert("árvíztűrő tükörfúrógép".indexOf("r", 3) === 7);
+assert("𐐀中文𐐀中文".indexOf("中", 3) === 6);
@@ -126,3 +126,20 @@ assert(String.prototype.lastIndexOf.call(test_object, "Obj") === 8);
 
 // check coercible - Number
 assert(String.prototype.lastIndexOf.call(123, "2") === 1);
+
+// check empty search string with position
+assert("abc".lastIndexOf("", 1) === 1);
+assert("abc".lastIndexOf("") === 3);
+
+// check long strings
+var long_str = "0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+assert(long_str.lastIndexOf("0123") === 36);
+assert(long_str.lastIndexOf("0123", 35) === 0);
+assert(long_str.lastIndexOf("9", 44) === 9);
+assert(long_str.lastIndexOf("XYZ", 100) === 69);
+assert(long_str.lastIndexOf("a0") === -1);
+
+// check non-ascii strings
+assert("árvíztűrő tükörfúrógép".lastIndexOf("r") === 17);
+assert("árvíztűrő tükörfúrógép".lastIndexOf("r", 14) === 14);
+assert("𐐀中文𐐀中文".lastIndexOf("𐐀") === 4);
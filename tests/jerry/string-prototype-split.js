@@ -159,3 +159,29 @@ catch (e)
   assert (e instanceof ReferenceError);
   assert (e.message === "foo");
 }
+
+/* Check string separators */
+res = "a,b,,c,".split(",");
+assert (res.length === 5);
+assert (res[0] === "a" && res[1] === "b" && res[2] === "" && res[3] === "c" && res[4] === "");
+
+res = ",a".split(",");
+assert (res.length === 2);
+assert (res[0] === "" && res[1] === "a");
+
+res = "a,b,c".split(",", 2);
+assert (res.length === 2);
+assert (res[0] === "a" && res[1] === "b");
+
+res = "abc".split("abcd");
+assert (res.length === 1);
+assert (res[0] === "abc");
+
+res = "field_one::field_two::field_three::field_four::".split("::");
+assert (res.length === 5);
+assert (res[2] === "field_three");
+assert (res[4] === "");
+
+res = "árvíz, tükör, 中文".split(", ");
+assert (res.length === 3);
+assert (res[0] === "árvíz" && res[1] === "tükör" && res[2] === "中文");
@@ -310,6 +310,24 @@ static bool foreach_subset (const jerry_api_string_t *, const jerry_api_value_t
   (*count_p)++;
   return true;
 }
+
+/**
+ * Read source by chunks of two bytes from a zero-terminated string, advancing the string pointer
+ */
+static size_t
+read_source_chunk (jerry_api_char_t *buffer_p, size_t buffer_size, void *user_data)
+{
+  const char **source_p = reinterpret_cast<const char **>(user_data);
+  size_t chunk_size = 0;
+
+  while (chunk_size < 2 && chunk_size < buffer_size && **source_p != '\0')
+  {
+    buffer_p[chunk_size++] = (jerry_api_char_t) *(*source_p)++;
+  }
+
+  return chunk_size;
+}
+
 int
 main (void)
 {
@@ -327,7 +345,7 @@ main (void)
   jerry_api_value_t res, args[2];
   char buffer[32];
 
-  is_ok = jerry_parse ((jerry_api_char_t *)test_source, strlen (test_source));
+  is_ok = jerry_parse ((jerry_api_char_t *)test_source, strlen (test_source), false);
   JERRY_ASSERT (is_ok);
 
   is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
@@ -657,6 +675,69 @@ main (void)
 
   jerry_api_release_value (&val_t);
 
+  // Test: eval code cache
+  jerry_api_eval_cache_stats_t eval_cache_stats_before, eval_cache_stats_after;
+  const char *cached_eval_code_src_p = "1 + 2";
+
+  jerry_api_get_eval_cache_stats (&eval_cache_stats_before);
+
+  for (int i = 0; i < 3; i++)
+  {
+    status = jerry_api_eval ((jerry_api_char_t *) cached_eval_code_src_p,
+                             strlen (cached_eval_code_src_p),
+                             false,
+                             false,
+                             &val_t);
+    JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (val_t.type == JERRY_API_DATA_TYPE_FLOAT64 && val_t.v_float64 == 3.0);
+    jerry_api_release_value (&val_t);
+  }
+
+  jerry_api_get_eval_cache_stats (&eval_cache_stats_after);
+  JERRY_ASSERT (eval_cache_stats_after.misses == eval_cache_stats_before.misses + 1);
+  JERRY_ASSERT (eval_cache_stats_after.hits == eval_cache_stats_before.hits + 2);
+  JERRY_ASSERT (eval_cache_stats_after.size > 0
+                && eval_cache_stats_after.size <= eval_cache_stats_after.size_limit);
+
+  jerry_api_set_eval_cache_size_limit (0);
+  jerry_api_get_eval_cache_stats (&eval_cache_stats_after);
+  JERRY_ASSERT (eval_cache_stats_after.entries_count == 0 && eval_cache_stats_after.size == 0);
+
+  // Test: precompiled scripts
+  const char *script_src_p = ("var script_runs = (typeof script_runs === 'undefined') ? 1 : script_runs + 1;"
+                              "function script_get_runs () { return script_runs; }");
+  jerry_api_script_t *script_p = jerry_api_compile_script ((jerry_api_char_t *) script_src_p,
+                                                           strlen (script_src_p),
+                                                           false);
+  JERRY_ASSERT (script_p != NULL);
+
+  for (int i = 1; i <= 3; i++)
+  {
+    status = jerry_api_run_script (script_p, &val_t);
+    JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (val_t.type == JERRY_API_DATA_TYPE_UNDEFINED);
+
+    is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "script_runs", &val_t);
+    JERRY_ASSERT (is_ok && val_t.type == JERRY_API_DATA_TYPE_FLOAT64 && val_t.v_float64 == i);
+  }
+
+  jerry_api_release_script (script_p);
+
+  const char *throwing_script_src_p = "throw new Error ();";
+  script_p = jerry_api_compile_script ((jerry_api_char_t *) throwing_script_src_p,
+                                       strlen (throwing_script_src_p),
+                                       false);
+  JERRY_ASSERT (script_p != NULL);
+  status = jerry_api_run_script (script_p, &val_t);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION);
+  jerry_api_release_script (script_p);
+
+  const char *invalid_script_src_p = "var var;";
+  script_p = jerry_api_compile_script ((jerry_api_char_t *) invalid_script_src_p,
+                                       strlen (invalid_script_src_p),
+                                       false);
+  JERRY_ASSERT (script_p == NULL);
+
   // cleanup.
   jerry_api_release_object (global_obj_p);
 
@@ -676,7 +757,7 @@ main (void)
                                          magic_string_lengths);
 
   const char *ms_code_src_p = "var global = {}; var console = [1]; var process = 1;";
-  is_ok = jerry_parse ((jerry_api_char_t *) ms_code_src_p, strlen (ms_code_src_p));
+  is_ok = jerry_parse ((jerry_api_char_t *) ms_code_src_p, strlen (ms_code_src_p), false);
   JERRY_ASSERT (is_ok);
 
   is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
@@ -684,6 +765,29 @@ main (void)
 
   jerry_cleanup ();
 
+  // Streamed source
+  static jerry_api_char_t stream_buffer[128];
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  const char *stream_src_p = "var s = 'stream\u00e9d'; /* comment\r\n */\r\nif (s.length !== 8) { throw s; }";
+  is_ok = jerry_parse_stream (read_source_chunk, &stream_src_p, stream_buffer, sizeof (stream_buffer), false);
+  JERRY_ASSERT (is_ok && *stream_src_p == '\0');
+  is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok);
+  jerry_cleanup ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  const char *invalid_stream_src_p = "var s = 1;\nvar var;";
+  is_ok = jerry_parse_stream (read_source_chunk, &invalid_stream_src_p, stream_buffer, sizeof (stream_buffer), false);
+  JERRY_ASSERT (!is_ok);
+  jerry_cleanup ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  const char *large_stream_src_p = "var s = 1;\nvar t = 2;";
+  is_ok = jerry_parse_stream (read_source_chunk, &large_stream_src_p, stream_buffer, 12, false);
+  JERRY_ASSERT (!is_ok);
+  jerry_cleanup ();
+
   // Dump / execute snapshot
   static uint8_t global_mode_snapshot_buffer[1024];
   static uint8_t eval_mode_snapshot_buffer[1024];
@@ -735,5 +839,221 @@ main (void)
 
   jerry_cleanup ();
 
+  // Snapshot, placed in a buffer that is not aligned enough to use its idx-to-literal map in place
+  static uint8_t unaligned_snapshot_buffer[1024 + 1];
+  memcpy (unaligned_snapshot_buffer + 1, eval_mode_snapshot_buffer, eval_mode_snapshot_size);
+
+  jerry_init (JERRY_FLAG_SHOW_OPCODES);
+
+  is_ok = (jerry_exec_snapshot (unaligned_snapshot_buffer + 1,
+                                eval_mode_snapshot_size,
+                                false,
+                                &res) == JERRY_COMPLETION_CODE_OK);
+
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  sz = jerry_api_string_to_char_buffer (res.v_string, (jerry_api_char_t *) buffer, 20);
+  JERRY_ASSERT (sz == 20);
+  jerry_api_release_value (&res);
+  JERRY_ASSERT (!strncmp (buffer, "string from snapshot", (size_t) sz));
+
+  // Truncated snapshot
+  is_ok = (jerry_exec_snapshot (eval_mode_snapshot_buffer,
+                                eval_mode_snapshot_size - 8,
+                                false,
+                                &res) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT);
+  JERRY_ASSERT (is_ok);
+
+  // Compact snapshots, with and without compression
+  static uint8_t compact_snapshot_buffer[1024];
+  size_t compact_snapshot_size = 0;
+
+  for (int is_compress = 0; is_compress <= 1; is_compress++)
+  {
+    size_t prev_compact_snapshot_size = compact_snapshot_size;
+    compact_snapshot_size = jerry_compact_snapshot (eval_mode_snapshot_buffer,
+                                                    eval_mode_snapshot_size,
+                                                    is_compress != 0,
+                                                    compact_snapshot_buffer,
+                                                    sizeof (compact_snapshot_buffer));
+    JERRY_ASSERT (compact_snapshot_size != 0
+                  && compact_snapshot_size < eval_mode_snapshot_size);
+    JERRY_ASSERT (prev_compact_snapshot_size == 0
+                  || compact_snapshot_size <= prev_compact_snapshot_size);
+
+    is_ok = (jerry_exec_snapshot (compact_snapshot_buffer,
+                                  compact_snapshot_size,
+                                  false,
+                                  &res) == JERRY_COMPLETION_CODE_OK);
+
+    JERRY_ASSERT (is_ok
+                  && res.type == JERRY_API_DATA_TYPE_STRING);
+    sz = jerry_api_string_to_char_buffer (res.v_string, (jerry_api_char_t *) buffer, 20);
+    JERRY_ASSERT (sz == 20);
+    jerry_api_release_value (&res);
+    JERRY_ASSERT (!strncmp (buffer, "string from snapshot", (size_t) sz));
+
+    is_ok = (jerry_exec_snapshot (compact_snapshot_buffer,
+                                  compact_snapshot_size - 1,
+                                  false,
+                                  &res) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_FORMAT);
+    JERRY_ASSERT (is_ok);
+  }
+
+  // Only regular snapshots can be converted to compact snapshots
+  JERRY_ASSERT (jerry_compact_snapshot (compact_snapshot_buffer,
+                                        compact_snapshot_size,
+                                        false,
+                                        unaligned_snapshot_buffer,
+                                        sizeof (unaligned_snapshot_buffer)) == 0);
+
+  jerry_cleanup ();
+
+  // Dump / execute snapshot bundle
+  static uint8_t bundle_buffer[2048];
+
+  const char *bundle_code_b_p = "var b_result = 'shared string' + 'b';";
+  const char *bundle_code_a_p = "(function () { return 'shared string'; }) ();";
+  const char *bundle_code_c_p = "var c_result = b_result + 'c';";
+
+  jerry_api_snapshot_bundle_source_t bundle_sources[] =
+  {
+    { "handler_b", (const jerry_api_char_t *) bundle_code_b_p, strlen (bundle_code_b_p), true },
+    { "handler_a", (const jerry_api_char_t *) bundle_code_a_p, strlen (bundle_code_a_p), false },
+    { "handler_c", (const jerry_api_char_t *) bundle_code_c_p, strlen (bundle_code_c_p), true },
+    { "handler_a", (const jerry_api_char_t *) bundle_code_c_p, strlen (bundle_code_c_p), true }
+  };
+
+  jerry_init (JERRY_FLAG_SHOW_OPCODES);
+  size_t bundle_size = jerry_parse_and_save_snapshot_bundle (bundle_sources,
+                                                             3,
+                                                             bundle_buffer,
+                                                             sizeof (bundle_buffer));
+  JERRY_ASSERT (bundle_size != 0);
+  jerry_cleanup ();
+
+  // Names of bundle's entries should be unique
+  jerry_init (JERRY_FLAG_SHOW_OPCODES);
+  JERRY_ASSERT (jerry_parse_and_save_snapshot_bundle (bundle_sources,
+                                                      4,
+                                                      eval_mode_snapshot_buffer,
+                                                      sizeof (eval_mode_snapshot_buffer)) == 0);
+  jerry_cleanup ();
+
+  jerry_init (JERRY_FLAG_SHOW_OPCODES);
+
+  is_ok = (jerry_exec_snapshot_bundle_entry (bundle_buffer,
+                                             bundle_size,
+                                             "handler_a",
+                                             false,
+                                             &res) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  sz = jerry_api_string_to_char_buffer (res.v_string, (jerry_api_char_t *) buffer, 13);
+  JERRY_ASSERT (sz == 13);
+  jerry_api_release_value (&res);
+  JERRY_ASSERT (!strncmp (buffer, "shared string", (size_t) sz));
+
+  is_ok = (jerry_exec_snapshot_bundle_entry (bundle_buffer,
+                                             bundle_size,
+                                             "handler_b",
+                                             false,
+                                             &res) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_UNDEFINED);
+
+  is_ok = (jerry_exec_snapshot_bundle_entry (bundle_buffer,
+                                             bundle_size,
+                                             "handler_c",
+                                             true,
+                                             &res) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_UNDEFINED);
+
+  global_obj_p = jerry_api_get_global ();
+  is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "c_result", &res);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  sz = jerry_api_string_to_char_buffer (res.v_string, (jerry_api_char_t *) buffer, 15);
+  JERRY_ASSERT (sz == 15);
+  JERRY_ASSERT (!strncmp (buffer, "shared stringbc", (size_t) sz));
+  jerry_api_release_value (&res);
+  jerry_api_release_object (global_obj_p);
+
+  JERRY_ASSERT (jerry_exec_snapshot_bundle_entry (bundle_buffer,
+                                                  bundle_size,
+                                                  "handler",
+                                                  false,
+                                                  &res) == JERRY_COMPLETION_CODE_SNAPSHOT_ENTRY_NOT_FOUND);
+
+  // Bundles and snapshots are not interchangeable
+  JERRY_ASSERT (jerry_exec_snapshot (bundle_buffer,
+                                     bundle_size,
+                                     false,
+                                     &res) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION);
+  JERRY_ASSERT (jerry_exec_snapshot_bundle_entry (global_mode_snapshot_buffer,
+                                                  global_mode_snapshot_size,
+                                                  "handler_a",
+                                                  false,
+                                                  &res) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT_VERSION);
+
+  jerry_cleanup ();
+
+  // Save heap image after running initialization script and restore engine from the image
+  static uint8_t heap_image_buffer[2 * CONFIG_MEM_HEAP_AREA_SIZE];
+
+  const char *init_code_p = "var lib = { greet : function (name) { return 'hello, ' + name; } };";
+  const char *request_code_p = "lib.greet ('image');";
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_api_eval ((jerry_api_char_t *) init_code_p,
+                                strlen (init_code_p),
+                                false,
+                                false,
+                                &res) == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  JERRY_ASSERT (jerry_save_heap_image (heap_image_buffer, 1024) == 0);
+  size_t heap_image_size = jerry_save_heap_image (heap_image_buffer, sizeof (heap_image_buffer));
+  JERRY_ASSERT (heap_image_size != 0);
+  jerry_cleanup ();
+
+  JERRY_ASSERT (jerry_init_from_heap_image (JERRY_FLAG_EMPTY, heap_image_buffer, heap_image_size));
+  is_ok = (jerry_api_eval ((jerry_api_char_t *) request_code_p,
+                           strlen (request_code_p),
+                           false,
+                           false,
+                           &res) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  sz = jerry_api_string_to_char_buffer (res.v_string, (jerry_api_char_t *) buffer, 12);
+  JERRY_ASSERT (sz == 12);
+  JERRY_ASSERT (!strncmp (buffer, "hello, image", (size_t) sz));
+  jerry_api_release_value (&res);
+  jerry_cleanup ();
+
+  // The image can be restored repeatedly
+  JERRY_ASSERT (jerry_init_from_heap_image (JERRY_FLAG_EMPTY, heap_image_buffer, heap_image_size));
+  global_obj_p = jerry_api_get_global ();
+  is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "lib", &res);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_OBJECT);
+  jerry_api_release_value (&res);
+  jerry_api_release_object (global_obj_p);
+  jerry_cleanup ();
+
+  // Truncated or corrupted image is rejected, and the engine is initialized in the usual way
+  JERRY_ASSERT (!jerry_init_from_heap_image (JERRY_FLAG_EMPTY, heap_image_buffer, heap_image_size - 1));
+  global_obj_p = jerry_api_get_global ();
+  is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "lib", &res);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_UNDEFINED);
+  jerry_api_release_object (global_obj_p);
+  jerry_cleanup ();
+
+  heap_image_buffer[sizeof (uint64_t)] ^= 0xffu;
+  JERRY_ASSERT (!jerry_init_from_heap_image (JERRY_FLAG_EMPTY, heap_image_buffer, heap_image_size));
+  jerry_cleanup ();
+
   return 0;
 }
@@ -0,0 +1,91 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+#include "config.h"
+
+#include "test-common.h"
+
+// Size of the script's source, which is about a third of the engine's heap
+#define test_source_size (88 * 1024)
+
+// Statement, repeated in body of the script's lazy function
+#define test_statement "  a = inc (a); /* padding padding padding padding padding padding padding padding */\n"
+
+char test_source[test_source_size + 1024];
+size_t test_source_length = 0;
+
+/**
+ * Append text to the script's source
+ */
+static void
+append_source (const char *text_p) /**< text to append */
+{
+  size_t text_length = strlen (text_p);
+  JERRY_ASSERT (test_source_length + text_length <= sizeof (test_source));
+
+  memcpy (test_source + test_source_length, text_p, text_length);
+  test_source_length += text_length;
+} /* append_source */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  /*
+   * Large lazy function with nested functions: its source text and the nested functions' bodies should be
+   * referenced in the script's source buffer, and not copied to the heap, upon parse and compilation
+   */
+  append_source ("var calls = 0;\n"
+                 "function f (a) {\n"
+                 "  function inc (b) {\n"
+                 "    calls++;\n"
+                 "    var add = function (c) { return function () { return c + 1; } (); };\n"
+                 "    return add (b);\n"
+                 "  }\n");
+
+  const uint32_t statements_num = (uint32_t) ((test_source_size - 1024) / strlen (test_statement));
+
+  for (uint32_t i = 0; i < statements_num; i++)
+  {
+    append_source (test_statement);
+  }
+
+  append_source ("  return a;\n"
+                 "}\n"
+                 "if (f (0) !== calls || calls === 0) {\n"
+                 "  throw new Error ('Unexpected result of lazy function');\n"
+                 "}\n"
+                 "calls = 0;\n"
+                 "if (f (1) !== calls + 1) {\n"
+                 "  throw new Error ('Unexpected result of lazy function');\n"
+                 "}\n");
+
+  JERRY_ASSERT (test_source_length > test_source_size - 1024);
+
+  jerry_init (JERRY_FLAG_LAZY_FUNCTIONS);
+
+  bool is_ok = jerry_parse ((jerry_api_char_t *) test_source, test_source_length, true);
+  JERRY_ASSERT (is_ok);
+
+  is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok);
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
@@ -68,6 +68,24 @@ main (int __attr_unused___ argc,
   mem_init ();
   lit_init ();
 
+  // Check build-time and run-time classification hashes are equal, and every magic string is recognized
+  JERRY_ASSERT (lit_utf8_string_classify_hash ((const lit_utf8_byte_t *) "prototype", 9)
+                == LIT_CLASSIFY_HASH_CONST ("prototype"));
+
+  for (lit_magic_string_id_t msi = (lit_magic_string_id_t) 0;
+       msi < LIT_MAGIC_STRING__COUNT;
+       msi = (lit_magic_string_id_t) (msi + 1))
+  {
+    lit_magic_string_id_t found_msi;
+    JERRY_ASSERT (lit_is_utf8_string_magic (lit_get_magic_string_utf8 (msi),
+                                            lit_get_magic_string_size (msi),
+                                            &found_msi));
+    JERRY_ASSERT (found_msi == msi);
+  }
+
+  lit_magic_string_id_t not_found_msi;
+  JERRY_ASSERT (!lit_is_utf8_string_magic ((const lit_utf8_byte_t *) "prototypes", 10, &not_found_msi));
+  JERRY_ASSERT (not_found_msi == LIT_MAGIC_STRING__COUNT);
 
   for (uint32_t i = 0; i < test_iters; i++)
   {
@@ -133,10 +151,58 @@ main (int __attr_unused___ argc,
     // Check empty string exists
     JERRY_ASSERT (lit_find_literal_by_utf8_string (NULL, 0));
 
+    // Free literals, except for those with even indices, and check that the kept literals are still found
+    for (uint32_t j = 0; j < test_sub_iters; j += 2)
+    {
+      literal_t lit;
+      if (ptrs[j])
+      {
+        lit = lit_find_literal_by_utf8_string (ptrs[j], lengths[j]);
+      }
+      else
+      {
+        lit = lit_find_literal_by_num (numbers[j]);
+      }
+      lit_mark_literal (lit_cpointer_t::compress (lit));
+    }
+
+    lit_free_unmarked_literals ();
+
+    for (uint32_t j = 0; j < test_sub_iters; j += 2)
+    {
+      if (ptrs[j])
+      {
+        literal_t lit = lit_find_literal_by_utf8_string (ptrs[j], lengths[j]);
+        JERRY_ASSERT (lit != NULL);
+        JERRY_ASSERT (lit_literal_equal_type_utf8 (lit, ptrs[j], lengths[j]));
+      }
+      else
+      {
+        literal_t lit = lit_find_literal_by_num (numbers[j]);
+        JERRY_ASSERT (lit != NULL);
+        JERRY_ASSERT (lit_literal_equal_type_num (lit, numbers[j]));
+      }
+    }
+
     lit_storage.cleanup ();
     JERRY_ASSERT (lit_storage.get_first () == NULL);
   }
 
+  // Check lookups among many literals, after several grows of the storage's index
+  for (uint32_t i = 0; i < 512; i++)
+  {
+    lit_create_literal_from_num ((ecma_number_t) i);
+  }
+
+  for (uint32_t i = 0; i < 512; i++)
+  {
+    literal_t lit = lit_find_literal_by_num ((ecma_number_t) i);
+    JERRY_ASSERT (lit != NULL);
+    JERRY_ASSERT (lit_literal_equal_type_num (lit, (ecma_number_t) i));
+  }
+
+  lit_storage.cleanup ();
+
   lit_finalize ();
   mem_finalize (true);
   return 0;
@@ -0,0 +1,132 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jrt.h"
+#include "jrt-lz.h"
+
+#include "test-common.h"
+
+// Iterations count
+#define test_iters 256
+
+// Maximum size of data to compress
+#define test_max_data_size 4096
+
+// Size of buffer for compressed data (incompressible data grows a little upon compression)
+#define test_compressed_buffer_size (test_max_data_size + test_max_data_size / 8 + 16)
+
+uint8_t data[test_max_data_size];
+uint8_t compressed[test_compressed_buffer_size];
+uint8_t decompressed[test_max_data_size + 1];
+uint32_t hash_table[JRT_LZ_HASH_TABLE_SIZE / sizeof (uint32_t)];
+
+/**
+ * Fill data with random bytes
+ *
+ * Note:
+ *      with small alphabet and frequent repeats of earlier parts, the data is compressible,
+ *      and with full alphabet and no repeats, the data is incompressible
+ */
+static void
+generate_data (size_t size, /**< size of the data */
+               bool is_compressible) /**< whether the data should be compressible */
+{
+  size_t i = 0;
+
+  while (i < size)
+  {
+    if (is_compressible && i >= 8 && rand () % 2 == 0)
+    {
+      size_t offset = 1 + (size_t) rand () % i;
+      size_t length = 1 + (size_t) rand () % 64;
+
+      for (size_t j = 0; j < length && i < size; j++, i++)
+      {
+        data[i] = data[i - offset];
+      }
+    }
+    else
+    {
+      data[i++] = (uint8_t) (is_compressible ? 'a' + rand () % 4 : rand ());
+    }
+  }
+} /* generate_data */
+
+/**
+ * Compress the data, check that it is decompressed to the original data,
+ * and that truncated or mis-sized compressed data is rejected
+ */
+static void
+test_round_trip (size_t size, /**< size of the data */
+                 bool is_compressible) /**< whether the data should be compressible */
+{
+  generate_data (size, is_compressible);
+
+  size_t compressed_size = jrt_lz_compress (data, size, compressed, sizeof (compressed), hash_table);
+  JERRY_ASSERT (compressed_size != 0);
+
+  if (is_compressible && size >= 256)
+  {
+    JERRY_ASSERT (compressed_size < size);
+  }
+
+  memset (decompressed, 0, sizeof (decompressed));
+  JERRY_ASSERT (jrt_lz_decompress (compressed, compressed_size, decompressed, size));
+  JERRY_ASSERT (memcmp (data, decompressed, size) == 0);
+
+  // Insufficient buffer for compressed data
+  if (compressed_size > 1)
+  {
+    JERRY_ASSERT (jrt_lz_compress (data, size, compressed, compressed_size - 1, hash_table) == 0);
+    JERRY_ASSERT (jrt_lz_compress (data, size, compressed, sizeof (compressed), hash_table) == compressed_size);
+  }
+
+  // Truncated compressed data
+  for (size_t truncated_size = 0; truncated_size < compressed_size; truncated_size++)
+  {
+    JERRY_ASSERT (!jrt_lz_decompress (compressed, truncated_size, decompressed, size));
+  }
+
+  // Uncompressed size, not equal to the original one
+  JERRY_ASSERT (!jrt_lz_decompress (compressed, compressed_size, decompressed, size - 1));
+  JERRY_ASSERT (!jrt_lz_decompress (compressed, compressed_size, decompressed, size + 1));
+} /* test_round_trip */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  for (uint32_t i = 0; i < test_iters; i++)
+  {
+    size_t size = 1 + (size_t) rand () % test_max_data_size;
+
+    test_round_trip (size, true);
+    test_round_trip (size, false);
+  }
+
+  // Boundary sizes, including data, shorter than minimal match
+  for (size_t size = 1; size <= 16; size++)
+  {
+    test_round_trip (size, true);
+    test_round_trip (size, false);
+  }
+
+  test_round_trip (test_max_data_size, true);
+  test_round_trip (test_max_data_size, false);
+
+  return 0;
+} /* main */
@@ -15,6 +15,7 @@
 
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "lit-literal.h"
 
 #include "test-common.h"
 
@@ -40,6 +41,19 @@ main (int __attr_unused___ argc,
     (const lit_utf8_byte_t *) "-Infinity",
     (const lit_utf8_byte_t *) "0",
     (const lit_utf8_byte_t *) "0",
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+    (const lit_utf8_byte_t *) "0.1",
+    (const lit_utf8_byte_t *) "123.456",
+    (const lit_utf8_byte_t *) "1.4797937213853585",
+    (const lit_utf8_byte_t *) "5e-324",
+    (const lit_utf8_byte_t *) "1.7976931348623157e+308",
+    (const lit_utf8_byte_t *) "-1.2345678901234568e-300",
+    (const lit_utf8_byte_t *) "37609587960547416",
+    (const lit_utf8_byte_t *) "33485031802883828",
+    (const lit_utf8_byte_t *) "24207548237828310",
+    (const lit_utf8_byte_t *) "-58759631516505260",
+    (const lit_utf8_byte_t *) "6.0995758e-316",
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
   };
 
   const ecma_number_t nums[] =
@@ -54,22 +68,48 @@ main (int __attr_unused___ argc,
     (ecma_number_t) INFINITY,
     (ecma_number_t) -INFINITY,
     (ecma_number_t) +0.0,
-    (ecma_number_t) -0.0
+    (ecma_number_t) -0.0,
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+    (ecma_number_t) 0.1,
+    (ecma_number_t) 123.456,
+    (ecma_number_t) 1.4797937213853585,
+    (ecma_number_t) 5e-324,
+    (ecma_number_t) 1.7976931348623157e+308,
+    (ecma_number_t) -1.2345678901234567e-300,
+    (ecma_number_t) 37609587960547416.0,
+    (ecma_number_t) 33485031802883828.0,
+    (ecma_number_t) 24207548237828310.0,
+    (ecma_number_t) -58759631516505260.0,
+    (ecma_number_t) 6.0995758e-316,
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
   };
 
-  for (uint32_t i = 0;
-       i < sizeof (nums) / sizeof (nums[0]);
-       i++)
-  {
-    lit_utf8_byte_t str[64];
+  mem_init ();
+  lit_init ();
 
-    lit_utf8_size_t str_size = ecma_number_to_utf8_string (nums[i], str, sizeof (str));
+  JERRY_STATIC_ASSERT (sizeof (strings) / sizeof (strings[0]) == sizeof (nums) / sizeof (nums[0]));
 
-    if (strncmp ((char *) str, (char *) strings[i], str_size) != 0)
+  /* the second pass checks results, which could be taken from the number to string conversion cache */
+  for (uint32_t pass = 0; pass < 2; pass++)
+  {
+    for (uint32_t i = 0;
+         i < sizeof (nums) / sizeof (nums[0]);
+         i++)
     {
-      return 1;
+      lit_utf8_byte_t str[64];
+
+      lit_utf8_size_t str_size = ecma_number_to_utf8_string (nums[i], str, sizeof (str));
+
+      if (str_size != lit_zt_utf8_string_size (strings[i])
+          || strncmp ((char *) str, (char *) strings[i], str_size) != 0)
+      {
+        return 1;
+      }
     }
   }
 
+  lit_finalize ();
+  mem_finalize (true);
+
   return 0;
 } /* main */
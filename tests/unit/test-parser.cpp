@@ -111,7 +111,7 @@ main (int __attr_unused___ argc,
 
   serializer_init ();
   parser_set_show_instrs (true);
-  parse_status = parser_parse_script ((jerry_api_char_t *) program1, strlen (program1), &bytecode_data_p);
+  parse_status = parser_parse_script ((jerry_api_char_t *) program1, strlen (program1), false, &bytecode_data_p, NULL);
 
   JERRY_ASSERT (parse_status == JSP_STATUS_OK && bytecode_data_p != NULL);
 
@@ -137,12 +137,50 @@ main (int __attr_unused___ argc,
 
   serializer_init ();
   parser_set_show_instrs (true);
-  parse_status = parser_parse_script ((jerry_api_char_t *) program2, strlen (program2), &bytecode_data_p);
+  parse_status = parser_parse_script ((jerry_api_char_t *) program2, strlen (program2), false, &bytecode_data_p, NULL);
 
   JERRY_ASSERT (parse_status == JSP_STATUS_SYNTAX_ERROR && bytecode_data_p == NULL);
 
   serializer_free ();
 
+  // #3
+  char program3[] = "print ('ran'); function f () { var = ; }";
+
+  serializer_init ();
+  parser_set_show_instrs (true);
+  parser_set_lazy_functions (true);
+  parse_status = parser_parse_script ((jerry_api_char_t *) program3, strlen (program3), true, &bytecode_data_p, NULL);
+
+  /* early errors in body of lazy function are reported during parse of the script */
+  JERRY_ASSERT (parse_status == JSP_STATUS_SYNTAX_ERROR && bytecode_data_p == NULL);
+
+  parser_set_lazy_functions (false);
+  serializer_free ();
+
+  // #4
+  char program4[] = "function f (a) { function g () { return a; } return g (); }";
+
+  serializer_init ();
+  parser_set_show_instrs (true);
+  parser_set_lazy_functions (true);
+  parse_status = parser_parse_script ((jerry_api_char_t *) program4, strlen (program4), true, &bytecode_data_p, NULL);
+
+  JERRY_ASSERT (parse_status == JSP_STATUS_OK && bytecode_data_p != NULL);
+
+  bool is_lazy_function_found = false;
+  for (vm_instr_counter_t i = 0; i < bytecode_data_p->instrs_count; i++)
+  {
+    if (bytecode_data_p->instrs_p[i].op_idx == VM_OP_META
+        && bytecode_data_p->instrs_p[i].data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION)
+    {
+      is_lazy_function_found = true;
+    }
+  }
+  JERRY_ASSERT (is_lazy_function_found);
+
+  parser_set_lazy_functions (false);
+  serializer_free ();
+
   mem_finalize (false);
 
   return 0;
@@ -47,6 +47,23 @@ main (int __attr_unused___ argc,
     (const jerry_api_char_t *) "-Infinity",
     (const jerry_api_char_t *) "0",
     (const jerry_api_char_t *) "0",
+    (const jerry_api_char_t *) " 123456789\n",
+    (const jerry_api_char_t *) "-42",
+    (const jerry_api_char_t *) "12a",
+    (const jerry_api_char_t *) "1 2",
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+    (const jerry_api_char_t *) "0.1",
+    (const jerry_api_char_t *) "3.14159",
+    (const jerry_api_char_t *) "1234567890",
+    (const jerry_api_char_t *) "9007199254740993",
+    (const jerry_api_char_t *) "270324219641533200",
+    (const jerry_api_char_t *) "15331034967400529.0",
+    (const jerry_api_char_t *) "1e22",
+    (const jerry_api_char_t *) "1e23",
+    (const jerry_api_char_t *) "12e-5",
+    (const jerry_api_char_t *) "1.7976931348623157e308",
+    (const jerry_api_char_t *) "5e-324",
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
   };
 
   const ecma_number_t nums[] =
@@ -68,9 +85,28 @@ main (int __attr_unused___ argc,
     (ecma_number_t) INFINITY,
     (ecma_number_t) -INFINITY,
     (ecma_number_t) +0.0,
-    (ecma_number_t) -0.0
+    (ecma_number_t) -0.0,
+    (ecma_number_t) 123456789.0,
+    (ecma_number_t) -42.0,
+    (ecma_number_t) NAN,
+    (ecma_number_t) NAN,
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+    (ecma_number_t) 0.1,
+    (ecma_number_t) 3.14159,
+    (ecma_number_t) 1234567890.0,
+    (ecma_number_t) 9007199254740992.0,
+    (ecma_number_t) 270324219641533200.0,
+    (ecma_number_t) 15331034967400529.0,
+    (ecma_number_t) 1e22,
+    (ecma_number_t) 1e23,
+    (ecma_number_t) 12e-5,
+    (ecma_number_t) 1.7976931348623157e308,
+    (ecma_number_t) 5e-324,
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
   };
 
+  JERRY_STATIC_ASSERT (sizeof (strings) / sizeof (strings[0]) == sizeof (nums) / sizeof (nums[0]));
+
   for (uint32_t i = 0;
        i < sizeof (nums) / sizeof (nums[0]);
        i++)
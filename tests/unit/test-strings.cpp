@@ -219,6 +219,65 @@ main (int __attr_unused___ argc,
   JERRY_ASSERT (lit_utf8_iterator_is_eos (&iter));
   JERRY_ASSERT (code_unit == 0xDF48);
 
+  /* Substring search, compared to a naive search, on strings of a small alphabet to get many partial matches */
+  for (int i = 0; i < test_iters; i++)
+  {
+    lit_utf8_byte_t haystack[256];
+    lit_utf8_byte_t needle[8];
+
+    lit_utf8_size_t haystack_size = (lit_utf8_size_t) (rand () % (int) sizeof (haystack));
+    lit_utf8_size_t needle_size = (lit_utf8_size_t) (rand () % (int) sizeof (needle));
+
+    for (lit_utf8_size_t k = 0; k < haystack_size; k++)
+    {
+      haystack[k] = (lit_utf8_byte_t) ('a' + rand () % 3);
+    }
+
+    for (lit_utf8_size_t k = 0; k < needle_size; k++)
+    {
+      needle[k] = (lit_utf8_byte_t) ('a' + rand () % 3);
+    }
+
+    lit_utf8_size_t start_offset = (lit_utf8_size_t) (rand () % ((int) haystack_size + 1));
+
+    bool is_found_expected = false;
+    lit_utf8_size_t offset_expected = 0;
+
+    for (lit_utf8_size_t k = start_offset; k + needle_size <= haystack_size; k++)
+    {
+      if (memcmp (haystack + k, needle, needle_size) == 0)
+      {
+        is_found_expected = true;
+        offset_expected = k;
+        break;
+      }
+    }
+
+    lit_utf8_size_t offset;
+    bool is_found = lit_utf8_string_find (haystack, haystack_size, needle, needle_size, start_offset, &offset);
+
+    JERRY_ASSERT (is_found == is_found_expected);
+    JERRY_ASSERT (!is_found || offset == offset_expected);
+
+    is_found_expected = false;
+
+    for (lit_utf8_size_t k = start_offset + 1; k-- > 0;)
+    {
+      if (k + needle_size <= haystack_size
+          && memcmp (haystack + k, needle, needle_size) == 0)
+      {
+        is_found_expected = true;
+        offset_expected = k;
+        break;
+      }
+    }
+
+    is_found = lit_utf8_string_find_last (haystack, haystack_size, needle, needle_size, start_offset, &offset);
+
+    JERRY_ASSERT (is_found == is_found_expected);
+    JERRY_ASSERT (!is_found || offset == offset_expected);
+  }
+
   mem_finalize (true);
   return 0;
 }
@@ -0,0 +1,95 @@
+#!/bin/bash
+
+# Copyright 2015 Samsung Electronics Co., Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares size, load time and run time of regular and compact snapshots.
+#
+# Usage: snapshot-compact-benchmark.sh <jerry binary> <script.js> [<script.js> ...]
+#
+# The times are measured inside of the engine (see also: --snapshot-stats), so that loading
+# (decoding) of a snapshot is reported separately from execution of its code, and process
+# startup is not accounted in either. Each script is wrapped into a function that is never called,
+# so that execution of the snapshot's code consists only of instantiation of the function.
+
+if [ $# -lt 2 ]
+then
+  echo "Usage: $0 <jerry binary> <script.js> [<script.js> ...]"
+  exit 1
+fi
+
+JERRY=$1
+shift
+
+ITERS=${ITERS:-100}
+TMP_DIR=`mktemp -d`
+trap "rm -rf $TMP_DIR" EXIT
+
+function measure_time()
+{
+  local snapshot=$1
+  local load_total=0
+  local run_total=0
+
+  for i in `seq $ITERS`
+  do
+    local stats
+    stats=`$JERRY --exec-snapshot $snapshot --snapshot-stats 2> /dev/null` || return 1
+
+    local load=`echo "$stats" | sed -n 's/^Snapshot load time (us): *//p'`
+    local run=`echo "$stats" | sed -n 's/^Snapshot run time (us): *//p'`
+
+    load_total=$(( load_total + load ))
+    run_total=$(( run_total + run ))
+  done
+
+  echo "$(( load_total / ITERS )) $(( run_total / ITERS ))"
+}
+
+printf "%-40s %10s %10s %8s %10s %10s %10s %10s\n" "Script" "Size" "Compact" "Ratio" \
+  "Load, us" "Compact" "Run, us" "Compact"
+
+for test in "$@"
+do
+  name=`basename $test`
+
+  if [ ! -f $test ]
+  then
+    printf "%-40s %s\n" "$name" "not found"
+    continue
+  fi
+
+  source=$TMP_DIR/$name
+  (echo "function __bench () {"; cat $test; echo "}") > $source
+
+  $JERRY $source --dump-snapshot-for-global $TMP_DIR/plain.snapshot > /dev/null 2>&1
+  $JERRY $source --dump-snapshot-for-global $TMP_DIR/compact.snapshot --compact-snapshot > /dev/null 2>&1
+
+  if [ ! -s $TMP_DIR/plain.snapshot ] || [ ! -s $TMP_DIR/compact.snapshot ]
+  then
+    printf "%-40s %s\n" "$name" "snapshot dump failed"
+    continue
+  fi
+
+  plain_size=`stat -c %s $TMP_DIR/plain.snapshot`
+  compact_size=`stat -c %s $TMP_DIR/compact.snapshot`
+  plain_times=(`measure_time $TMP_DIR/plain.snapshot`)
+  compact_times=(`measure_time $TMP_DIR/compact.snapshot`)
+
+  printf "%-40s %10d %10d %7d%% %10s %10s %10s %10s\n" "$name" $plain_size $compact_size \
+    $(( compact_size * 100 / plain_size )) "${plain_times[0]}" "${compact_times[0]}" \
+    "${plain_times[1]}" "${compact_times[1]}"
+
+  rm -f $TMP_DIR/plain.snapshot $TMP_DIR/compact.snapshot
+done